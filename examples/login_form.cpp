@@ -3,6 +3,7 @@
 #include <guilib/components/push_button.h>
 #include <guilib/components/radio_group.h>
 #include <guilib/components/drop_down.h>
+#include <guilib/components/layout_panel.h>
 
 #include <assets_path.h>
 #include <GLFW/glfw3.h>
@@ -32,9 +33,6 @@ static void SetupMainMenuComponents()
 	Label* label = new Label("No account is logged in at the moment.", glm::vec4(1.0f), arial, 26);
 	Label* dropDownLabel = new Label("Choose the account information to display:", glm::vec4(1.0f), arial, 24);
 	Label* accountInfoText = new Label("", glm::vec4(1.0f), arial, 20);
-	label->SetPosition({ 250 - label->GetSize().x / 2, 120 });
-	dropDownLabel->SetPosition({ 250 - dropDownLabel->GetSize().x / 2, 200 });
-	accountInfoText->SetPosition({ 250 - accountInfoText->GetSize().x / 2, 280 });
 
 	dropDownLabel->SetEnabled(false);
 	accountInfoText->SetEnabled(false);
@@ -45,25 +43,48 @@ static void SetupMainMenuComponents()
 	accountInfoDropDown->AddOption("Full Name", 1);
 	accountInfoDropDown->AddOption("Gender", 2);
 
-	accountInfoDropDown->SetPosition({ 250, 240 });
 	accountInfoDropDown->SetSize({ 200, 40 });
 	accountInfoDropDown->SetEnabled(false);
 
 	// Setup the login and signup buttons
 	PushButton* loginBtn = new PushButton("Log In", arial, 40);
 	loginBtn->SetSize({ 200, 70 });
-	loginBtn->SetPosition({ 384, 445 });
 	loginBtn->SetClickCallback([=]() { mainMenuPage->SetEnabled(false); loginPage->SetEnabled(true); });
 
 	DefineButtonStyle(loginBtn);
 
 	PushButton* signupBtn = new PushButton("Sign Up", arial, 40);
 	signupBtn->SetSize({ 200, 70 });
-	signupBtn->SetPosition({ 116, 445 });
 	signupBtn->SetClickCallback([=]() { mainMenuPage->SetEnabled(false); signupPage->SetEnabled(true); });
 	
 	DefineButtonStyle(signupBtn);
 
+	// Setup the layout, the labels are centered in the space above the buttons and are laid out again whenever their text changes
+	LayoutPanel* layout = new LayoutPanel(LayoutDirection::COLUMN);
+	layout->SetFillViewport(true);
+	layout->SetPadding(20);
+	layout->SetAlignment(LayoutAlignment::CENTER);
+
+	LayoutPanel* content = new LayoutPanel(LayoutDirection::COLUMN);
+	content->SetSpacing(20);
+	content->SetJustification(LayoutJustification::CENTER);
+	content->SetAlignment(LayoutAlignment::CENTER);
+	content->AddChild(label);
+	content->AddChild(dropDownLabel);
+	content->AddChild(accountInfoDropDown);
+	content->AddChild(accountInfoText);
+
+	LayoutPanel* buttons = new LayoutPanel(LayoutDirection::ROW);
+	buttons->SetSpacing(60);
+	buttons->AddChild(signupBtn);
+	buttons->AddChild(loginBtn);
+
+	layout->AddChild(content, 1.0f);
+	layout->AddChild(buttons);
+
+	mainMenuPage->AddComponent("Layout", layout);
+	mainMenuPage->AddComponent("ContentLayout", content);
+	mainMenuPage->AddComponent("ButtonLayout", buttons);
 	mainMenuPage->AddComponent("Label", label);
 	mainMenuPage->AddComponent("DropDownLabel", dropDownLabel);
 	mainMenuPage->AddComponent("AccountInfoLabel", accountInfoText);
@@ -373,7 +394,6 @@ int main(int argc, char** argv)
 				accountInfoDropDown->SetEnabled(true);
 
 				text->SetText("You are logged in!");
-				text->SetPosition({ 250 - text->GetSize().x / 2, 120 });
 
 				switch (accountInfoDropDown->GetSelectedOption())
 				{
@@ -388,8 +408,6 @@ int main(int argc, char** argv)
 					break;
 				}
 
-				accountInfoText->SetPosition({ 250 - accountInfoText->GetSize().x / 2, 300 });
-
 				if (accountInfoDropDown->GetSelectedOption() >= 0)
 					accountInfoText->SetEnabled(true);
 			}
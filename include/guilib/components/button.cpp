@@ -1,84 +1,122 @@
 #include <components/button.h>
-#include <utilities/input_system.h>
 
 namespace GUILib
 {
-	Button::Button() { this->InitializeComponent(); }
-	
+	Button::Button() : 
+		Button(2)
+	{}
+
+	Button::Button(uint8_t colorChannels) : 
+		m_visualState(VisualStateTable::GetInstance().Create(colorChannels))
+	{ 
+		this->InitializeComponent(); 
+	}
+
+	Button::~Button() { VisualStateTable::GetInstance().Destroy(m_visualState); }
+
 	void Button::InitializeComponent()
 	{
 		m_shaders = ResourceLoader::GetInstance().GetShaders("Geometry");
 		m_geometry = *ResourceLoader::GetInstance().GetGeometry("Square");
 
 		m_position = m_size = { 0, 0 };
-		m_currentBorderColor = m_baseBorderColor = m_hoverBorderColor = m_clickedBorderColor = { 0.0f, 0.0f, 0.0f, 1.0f };
+		this->SetBorderColor({ 0.0f, 0.0f, 0.0f, 1.0f }, ComponentEvent::NO_EVENT | ComponentEvent::HOVERED_EVENT | ComponentEvent::CLICKED_EVENT);
 		m_borderThickness = 4;
 	}
 
-	void Button::SetPosition(glm::ivec2 pos) { m_position = pos; }
+	void Button::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->UpdateSpatialIndexEntry();
+		this->MarkChildTransformsDirty();
+	}
 
-	void Button::SetSize(glm::ivec2 size) { m_size = size; }
+	void Button::SetSize(glm::ivec2 size)
+	{
+		m_size = size;
+		this->UpdateSpatialIndexEntry();
+		this->InvalidateLayout();
+	}
 
 	void Button::SetColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentColor = m_baseColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::FILL_CHANNEL, color, eventEnum);
 	}
 
 	void Button::SetBorderColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if(eventEnum & ComponentEvent::NO_EVENT)
-			m_currentBorderColor = m_baseBorderColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverBorderColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedBorderColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, color, eventEnum);
+	}
+
+	void Button::SetColorAnimation(const ColorAnimation& animation)
+	{
+		VisualStateTable::GetInstance().SetAnimation(m_visualState, VisualStateTable::FILL_CHANNEL, animation);
 	}
 
+	void Button::StopColorAnimation() { VisualStateTable::GetInstance().StopAnimation(m_visualState, VisualStateTable::FILL_CHANNEL); }
+
 	void Button::SetBorderThickness(int thickness) { m_borderThickness = thickness; }
 
 	void Button::SetClickCallback(std::function<void()> callbackFunc) { m_onClickCallbackFunc = callbackFunc; }
 
-	bool Button::IsCursorHovering() const
+	void Button::SetDoubleClickCallback(std::function<void()> callbackFunc) { m_onDoubleClickCallbackFunc = callbackFunc; }
+
+	void Button::SetLongPressCallback(std::function<void()> callbackFunc) { m_onLongPressCallbackFunc = callbackFunc; }
+
+	bool Button::HandleEvent(const UIEvent& event)
 	{
-		const glm::vec2 cursorPosition = InputSystem::GetInstance().GetCursorPosition();
+		PointerGesture gestures;
+		const bool isHandled = m_pointerState.HandleEvent(event, gestures);
+		this->ApplyPointerGestures(gestures);
+
+		// Only a pending long press has to be timed by the update
+		if (m_pointerState.IsUpdateRequired())
+			this->SetUpdateRequired(true);
+
+		return isHandled;
+	}
 
-		return
-			cursorPosition.x >= m_position.x - (m_size.x / 2.0f) && cursorPosition.x <= m_position.x + (m_size.x / 2.0f) &&
-			cursorPosition.y >= m_position.y - (m_size.y / 2.0f) && cursorPosition.y <= m_position.y + (m_size.y / 2.0f);
+	bool Button::GetInteractionBounds(glm::vec2& min, glm::vec2& max) const
+	{
+		min = glm::vec2(m_position) - (glm::vec2(m_size) / 2.0f);
+		max = glm::vec2(m_position) + (glm::vec2(m_size) / 2.0f);
+		return true;
 	}
 
 	const glm::ivec2& Button::GetPosition() const { return m_position; }
 
 	const glm::ivec2& Button::GetSize() const { return m_size; }
 
-	const glm::vec4& Button::GetColor(ComponentEvent eventEnum) const
+	bool Button::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		size = m_size;
+		anchor = size / 2;
+		return true;
+	}
+
+	void Button::ArrangeLayout(glm::ivec2 size) { this->SetSize(size); }
+
+	glm::vec4 Button::GetColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedColor;
-		}
-
-		return m_baseColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::FILL_CHANNEL, eventEnum);
 	}
 
-	const glm::vec4& Button::GetBorderColor(ComponentEvent eventEnum) const
+	glm::vec4 Button::GetBorderColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseBorderColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverBorderColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedBorderColor;
-		}
-
-		return m_baseBorderColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, eventEnum);
 	}
 
 	const int& Button::GetBorderThickness() const { return m_borderThickness; }
+
+	void Button::ApplyPointerGestures(PointerGesture gestures)
+	{
+		m_pointerState.ApplyVisualState(m_visualState, gestures);
+
+		if ((gestures & PointerGesture::CLICK) && m_onClickCallbackFunc)
+			m_onClickCallbackFunc();
+		if ((gestures & PointerGesture::DOUBLE_CLICK) && m_onDoubleClickCallbackFunc)
+			m_onDoubleClickCallbackFunc();
+		if ((gestures & PointerGesture::LONG_PRESS) && m_onLongPressCallbackFunc)
+			m_onLongPressCallbackFunc();
+	}
 }
@@ -2,6 +2,9 @@
 #define BUTTON_H
 
 #include <components/component.h>
+#include <components/visual_state_table.h>
+#include <components/pointer_state_machine.h>
+#include <functional>
 
 namespace GUILib
 {
@@ -16,13 +19,16 @@ namespace GUILib
 		*/
 		Button();
 
-		virtual ~Button() = default;
+		/**
+		* @brief Destroys the button's entry in the visual state table.
+		*/
+		virtual ~Button();
 
 		/**
 		* @brief Sets the current position of the button component.
 		* @param[in] pos - The new position of the component.
 		*/
-		virtual void SetPosition(glm::ivec2 pos);
+		virtual void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the current size of the button component.
@@ -46,6 +52,19 @@ namespace GUILib
 		*/
 		void SetBorderColor(glm::vec4 color, ComponentEvent eventEnum);
 
+		/**
+		* @brief Animates the button color with a color animation, which is displayed in place of the colors of the component events
+		* until it is stopped. The animation is evaluated on the GPU, so continuous effects (such as pulsing) don't require the component
+		* to be updated.
+		* @param[in] animation - The animation descriptor, its start time is on the tween manager's clock.
+		*/
+		void SetColorAnimation(const ColorAnimation& animation);
+
+		/**
+		* @brief Stops the button color animation, the colors of the component events are displayed again.
+		*/
+		void StopColorAnimation();
+
 		/**
 		* @brief Sets the border thickness of this button component.
 		* @param[in] thickness - The new border thickness of the component.
@@ -58,6 +77,27 @@ namespace GUILib
 		*/
 		void SetClickCallback(std::function<void()> callbackFunc);
 
+		/**
+		* @brief Attaches the given function as a callback which is called when the button component is double-clicked.
+		* The clicks making up the double-click still call the click callback function.
+		* @param[in] callbackFunc - The function to be attached as the callback.
+		*/
+		void SetDoubleClickCallback(std::function<void()> callbackFunc);
+
+		/**
+		* @brief Attaches the given function as a callback which is called when the button component is pressed for a while without being
+		* released, the press then doesn't count as a click.
+		* @param[in] callbackFunc - The function to be attached as the callback.
+		*/
+		void SetLongPressCallback(std::function<void()> callbackFunc);
+
+		/**
+		* @brief Handles the pointer events dispatched to the button component, which drive its pointer state machine.
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the event is a pointer event (other than scrolling), FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event) override;
+
 		/**
 		* @brief Updates the logic of the button component.
 		*/
@@ -73,7 +113,7 @@ namespace GUILib
 		* @brief Returns the current position of the button component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
 
 		/**
 		* @brief Returns the size of this button component.
@@ -81,6 +121,29 @@ namespace GUILib
 		*/
 		const glm::ivec2& GetSize() const;
 
+		/**
+		* @brief Measures the box which the button occupies when arranged by a layout panel, which is the size of the button.
+		* @param[out] size - The size of the component's box.
+		* @param[out] anchor - The offset of the component's position from the top-left corner of its box.
+		* @return TRUE, as buttons always occupy a box.
+		*/
+		bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const override;
+
+		/**
+		* @brief Resizes the button to the size of the box given by the layout panel arranging it.
+		* @param[in] size - The new size of the component.
+		*/
+		void ArrangeLayout(glm::ivec2 size) override;
+
+		/**
+		* @brief Retrieves the bounds of the button component, these are used for hit testing.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, as buttons always respond to the cursor.
+		*/
+		bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const override;
+
 		/**
 		* @brief Returns the button color which is displayed when the specified component event occurs.
 		* @param[in] eventEnum - The component event to retrieve the attached color from.
@@ -88,7 +151,7 @@ namespace GUILib
 		*
 		* @return The button color attached to the specified event.
 		*/
-		const glm::vec4& GetColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the button border color which is displayed when the specified component event occurs.
@@ -97,7 +160,7 @@ namespace GUILib
 		*
 		* @return The button border color attached to the specified event.
 		*/
-		const glm::vec4& GetBorderColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetBorderColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the thickness of the button component's border.
@@ -105,23 +168,29 @@ namespace GUILib
 		*/
 		const int& GetBorderThickness() const;
 	protected:
+		/**
+		* @brief This is a class constructor for buttons which display more colors than the fill and border colors.
+		* @param[in] colorChannels - The number of color channels of the button's entry in the visual state table.
+		*/
+		Button(uint8_t colorChannels);
+
 		/**
 		* @brief Initialises the button component.
 		*/
 		virtual void InitializeComponent() override;
 
 		/**
-		* @brief Checks if the cursor is hovering on the button.
-		* @return TRUE if cursor is hovering on button, FALSE otherwise.
+		* @brief Displays the visual state of the button's pointer state, and calls the callback functions of the gestures given.
+		* @param[in] gestures - The gestures detected by the button's pointer state machine.
 		*/
-		virtual bool IsCursorHovering() const;
+		void ApplyPointerGestures(PointerGesture gestures);
 	protected:
 		glm::ivec2 m_position, m_size;
-		glm::vec4 m_baseColor, m_hoverColor, m_clickedColor, m_currentColor;
-		glm::vec4 m_baseBorderColor, m_hoverBorderColor, m_clickedBorderColor, m_currentBorderColor;
+		VisualStateTable::Handle m_visualState; // The button's colors, stored in the visual state table's FILL and BORDER channels
 		int m_borderThickness;
 
-		std::function<void()> m_onClickCallbackFunc;
+		PointerStateMachine m_pointerState;
+		std::function<void()> m_onClickCallbackFunc, m_onDoubleClickCallbackFunc, m_onLongPressCallbackFunc;
 	};
 }
 
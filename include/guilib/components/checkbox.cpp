@@ -1,16 +1,16 @@
 #include <components/checkbox.h>
-#include <graphics/animation.h>
-#include <utilities/input_system.h>
 #include <external/glm/glm/gtc/matrix_transform.hpp>
 
 namespace GUILib
 {
 	Checkbox::Checkbox() : 
-		m_isChecked(false)
+		m_visualState(VisualStateTable::GetInstance().Create(2)), m_isChecked(false)
 	{ 
 		this->InitializeComponent(); 
 	}
 
+	Checkbox::~Checkbox() { VisualStateTable::GetInstance().Destroy(m_visualState); }
+
 	void Checkbox::InitializeComponent()
 	{
 		m_shaders = ResourceLoader::GetInstance().GetShaders("Geometry");
@@ -20,11 +20,11 @@ namespace GUILib
 		m_position = { 0, 0 };
 		m_scale = 30;
 
-		m_currentColor = m_baseColor = { 0.6f, 0.6, 0.6f, 1.0f };
-		m_hoverColor = { 0.8f, 0.8f, 0.8f, 1.0f };
-		m_clickedColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+		this->SetColor({ 0.6f, 0.6, 0.6f, 1.0f }, ComponentEvent::NO_EVENT);
+		this->SetColor({ 0.8f, 0.8f, 0.8f, 1.0f }, ComponentEvent::HOVERED_EVENT);
+		this->SetColor({ 1.0f, 1.0f, 1.0f, 1.0f }, ComponentEvent::CLICKED_EVENT);
 
-		m_currentBorderColor = m_baseBorderColor = m_hoverBorderColor = m_clickedBorderColor = { 0.0f, 0.0f, 0.0f, 1.0f };
+		this->SetBorderColor({ 0.0f, 0.0f, 0.0f, 1.0f }, ComponentEvent::NO_EVENT | ComponentEvent::HOVERED_EVENT | ComponentEvent::CLICKED_EVENT);
 		m_borderThickness = 4;
 
 		m_checkmarkColor = { 1.0f, 0.0f, 0.0f, 1.0f };
@@ -32,84 +32,71 @@ namespace GUILib
 
 	void Checkbox::SetCheckedState(bool checked) { m_isChecked = checked; }
 
-	void Checkbox::SetPosition(glm::ivec2 pos) { m_position = pos; }
+	void Checkbox::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->UpdateSpatialIndexEntry();
+		this->MarkChildTransformsDirty();
+	}
 
-	void Checkbox::SetScaleSize(int scale) { m_scale = scale; }
+	void Checkbox::SetScaleSize(int scale)
+	{
+		m_scale = scale;
+		this->UpdateSpatialIndexEntry();
+		this->InvalidateLayout();
+	}
 
 	void Checkbox::SetColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentColor = m_baseColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::FILL_CHANNEL, color, eventEnum);
 	}
 
 	void Checkbox::SetBorderColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentBorderColor = m_baseBorderColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverBorderColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedBorderColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, color, eventEnum);
+	}
+
+	void Checkbox::SetColorAnimation(const ColorAnimation& animation)
+	{
+		VisualStateTable::GetInstance().SetAnimation(m_visualState, VisualStateTable::FILL_CHANNEL, animation);
 	}
 
+	void Checkbox::StopColorAnimation() { VisualStateTable::GetInstance().StopAnimation(m_visualState, VisualStateTable::FILL_CHANNEL); }
+
 	void Checkbox::SetBorderThickness(int thickness) { m_borderThickness = thickness; }
 
 	void Checkbox::SetCheckmarkColor(glm::vec4 color) { m_checkmarkColor = color; }
 
-	bool Checkbox::IsCursorHovering() const
+	bool Checkbox::GetInteractionBounds(glm::vec2& min, glm::vec2& max) const
 	{
-		const glm::vec2 cursorPosition = InputSystem::GetInstance().GetCursorPosition();
-
-		return
-			cursorPosition.x >= m_position.x - (m_scale / 2.0f) && cursorPosition.x <= m_position.x + (m_scale / 2.0f) &&
-			cursorPosition.y >= m_position.y - (m_scale / 2.0f) && cursorPosition.y <= m_position.y + (m_scale / 2.0f);
+		min = glm::vec2(m_position) - (m_scale / 2.0f);
+		max = glm::vec2(m_position) + (m_scale / 2.0f);
+		return true;
 	}
 
 	void Checkbox::Update(float deltaTime)
 	{
-		static bool isButtonHeld = false;
-		if (this->IsCursorHovering())
-		{
-			if (InputSystem::GetInstance().WasMouseButtonPressed(MouseButtonCode::MOUSE_BUTTON_LEFT))
-			{
-				m_currentColor = m_clickedColor;
-				m_currentBorderColor = m_clickedBorderColor;
-
-				// A button click can span several frames, so prevent the repeatedly checked switches
-				if (!isButtonHeld)
-					m_isChecked = !m_isChecked;
-
-				isButtonHeld = true;
-			}
-			else
-			{
-				if (isButtonHeld)
-				{
-					m_currentColor = m_hoverColor;
-					m_currentBorderColor = m_hoverBorderColor;
-				}
-				else
-				{
-					m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_baseColor, m_hoverColor, 8.0f, deltaTime);
-					m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_baseBorderColor, m_hoverBorderColor, 8.0f, deltaTime);
-				}
-
-				isButtonHeld = false;
-			}
-		}
-		else
-		{
-			m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_hoverColor, m_baseColor, 8.0f, deltaTime);
-			m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_hoverBorderColor, m_baseBorderColor, 8.0f, deltaTime);
-		}
+		this->ApplyPointerGestures(m_pointerState.Update(deltaTime));
+		this->SetUpdateRequired(m_pointerState.IsUpdateRequired());
+	}
+
+	bool Checkbox::HandleEvent(const UIEvent& event)
+	{
+		PointerGesture gestures;
+		const bool isHandled = m_pointerState.HandleEvent(event, gestures);
+		this->ApplyPointerGestures(gestures);
+
+		// Only a pending long press has to be timed by the update
+		if (m_pointerState.IsUpdateRequired())
+			this->SetUpdateRequired(true);
+
+		return isHandled;
 	}
 
 	void Checkbox::Render(const Viewport& viewport) const
 	{
+		const VisualStateTable& visualStates = VisualStateTable::GetInstance();
+
 		/// Render the border first ///
 		// Construct the model matrix
 		glm::mat4 modelMatrix = glm::mat4(1.0f);
@@ -122,7 +109,7 @@ namespace GUILib
 		m_shaders->SetUniform("useTextures", false);
 		m_shaders->SetUniformGLM("model", modelMatrix);
 		m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
-		m_shaders->SetUniformGLM("color", m_currentBorderColor);
+		visualStates.SetColorUniforms(m_visualState, VisualStateTable::BORDER_CHANNEL, *m_shaders);
 
 		m_geometry.vao->Bind();
 		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
@@ -135,11 +122,12 @@ namespace GUILib
 
 		// Setup the required shader uniforms
 		m_shaders->SetUniformGLM("model", modelMatrix);
-		m_shaders->SetUniformGLM("color", m_currentColor);
+		visualStates.SetColorUniforms(m_visualState, VisualStateTable::FILL_CHANNEL, *m_shaders);
 
 		// Render the checkbox
 		m_geometry.vao->Bind();
 		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+		visualStates.ResetColorUniforms(m_visualState, *m_shaders);
 
 		if (m_isChecked) // Render the checkmark if the checkbox is checked
 		{
@@ -166,31 +154,25 @@ namespace GUILib
 
 	const int& Checkbox::GetScaleSize() const { return m_scale; }
 
-	const glm::vec4& Checkbox::GetColor(ComponentEvent eventEnum) const
+	glm::vec4 Checkbox::GetColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedColor;
-		}
-
-		return m_baseColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::FILL_CHANNEL, eventEnum);
 	}
 
-	const glm::vec4& Checkbox::GetBorderColor(ComponentEvent eventEnum) const
+	glm::vec4 Checkbox::GetBorderColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseBorderColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverBorderColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedBorderColor;
-		}
-
-		return m_baseBorderColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, eventEnum);
 	}
 
 	const glm::vec4& Checkbox::GetCheckmarkColor() const { return m_checkmarkColor; }
 
 	const int& Checkbox::GetBorderThickness() const { return m_borderThickness; }
+
+	void Checkbox::ApplyPointerGestures(PointerGesture gestures)
+	{
+		m_pointerState.ApplyVisualState(m_visualState, gestures);
+
+		if (gestures & PointerGesture::CLICK)
+			m_isChecked = !m_isChecked;
+	}
 }
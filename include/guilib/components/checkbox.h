@@ -2,6 +2,8 @@
 #define CHECKBOX_H
 
 #include <components/component.h>
+#include <components/visual_state_table.h>
+#include <components/pointer_state_machine.h>
 
 namespace GUILib
 {
@@ -17,7 +19,10 @@ namespace GUILib
 		*/
 		Checkbox();
 
-		~Checkbox() = default;
+		/**
+		* @brief Destroys the checkbox's entry in the visual state table.
+		*/
+		~Checkbox();
 
 		/**
 		* @brief Sets whether the checkbox is checked or not.
@@ -29,7 +34,7 @@ namespace GUILib
 		* @brief Sets the current position of the checkbox component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the current scale size of the checkbox component.
@@ -54,6 +59,19 @@ namespace GUILib
 		*/
 		void SetBorderColor(glm::vec4 color, ComponentEvent eventEnum);
 
+		/**
+		* @brief Animates the checkbox color with a color animation, which is displayed in place of the colors of the component events
+		* until it is stopped. The animation is evaluated on the GPU, so continuous effects (such as pulsing) don't require the component
+		* to be updated.
+		* @param[in] animation - The animation descriptor, its start time is on the tween manager's clock.
+		*/
+		void SetColorAnimation(const ColorAnimation& animation);
+
+		/**
+		* @brief Stops the checkbox color animation, the colors of the component events are displayed again.
+		*/
+		void StopColorAnimation();
+
 		/**
 		* @brief Sets the border thickness of this checkbox component.
 		* @param[in] thickness - The new border thickness of the component.
@@ -71,6 +89,13 @@ namespace GUILib
 		*/
 		void Update(float deltaTime) override;
 
+		/**
+		* @brief Handles the pointer events dispatched to the checkbox component, which drive its pointer state machine.
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the event is a pointer event (other than scrolling), FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event) override;
+
 		/**
 		* @brief Renders the checkbox component.
 		* @param[in] viewport - The viewport where the component is being rendered to.
@@ -87,7 +112,7 @@ namespace GUILib
 		* @brief Returns the current position of the checkbox component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
 
 		/**
 		* @brief Returns the scale size of the checkbox component.
@@ -95,6 +120,15 @@ namespace GUILib
 		*/
 		const int& GetScaleSize() const;
 
+		/**
+		* @brief Retrieves the bounds of the checkbox component, these are used for hit testing.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, as checkboxes always respond to the cursor.
+		*/
+		bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const override;
+
 		/**
 		* @brief Returns the checkbox color which is displayed when the specified component event occurs.
 		* @param[in] eventEnum - The component event to retrieve the attached color from.
@@ -102,7 +136,7 @@ namespace GUILib
 		*
 		* @return The checkbox color attached to the specified event.
 		*/
-		const glm::vec4& GetColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the checkbox border color which is displayed when the specified component event occurs.
@@ -111,7 +145,7 @@ namespace GUILib
 		*
 		* @return The checkbox border color attached to the specified event.
 		*/
-		const glm::vec4& GetBorderColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetBorderColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the thickness of the checkbox component's border.
@@ -131,19 +165,19 @@ namespace GUILib
 		void InitializeComponent() override;
 
 		/**
-		* @brief Checks if the cursor is hovering on the checkbox.
-		* @return TRUE if cursor is hovering on checkbox, FALSE otherwise.
+		* @brief Displays the visual state of the checkbox's pointer state, and applies the gestures given.
+		* @param[in] gestures - The gestures detected by the checkbox's pointer state machine.
 		*/
-		bool IsCursorHovering() const;
+		void ApplyPointerGestures(PointerGesture gestures);
 	protected:
 		ResourceLoader::Geometry m_checkmarkGeometry;
 
 		glm::ivec2 m_position;
-		glm::vec4 m_baseColor, m_hoverColor, m_clickedColor, m_currentColor;
-		glm::vec4 m_baseBorderColor, m_hoverBorderColor, m_clickedBorderColor, m_currentBorderColor;
+		VisualStateTable::Handle m_visualState; // The checkbox's colors, stored in the visual state table's FILL and BORDER channels
 		glm::vec4 m_checkmarkColor;
 		int m_scale, m_borderThickness;
 
+		PointerStateMachine m_pointerState;
 		bool m_isChecked;
 	};
 }
@@ -1,12 +1,233 @@
 #include <components/component.h>
+#include <components/interface_frame.h>
+#include <utilities/spatial_index.h>
+#include <algorithm>
 
 namespace GUILib
 {
 	Component::Component() :
-		m_shaders(nullptr), m_isEnabled(true)
+		m_shaders(nullptr), m_isEnabled(true), m_frame(nullptr), m_spatialIndex(nullptr), m_spatialIndexEntry(SpatialIndex::INVALID_ENTRY),
+		m_parent(nullptr), m_localPosition({ 0, 0 }), m_isTransformDirty(false), m_transformQueueFrame(nullptr), m_isUpdateRequired(true),
+		m_isInUpdateList(false)
 	{}
 
-	void Component::SetEnabled(bool enable) { m_isEnabled = enable; }
+	Component::~Component()
+	{
+		this->SetParent(nullptr);
+		for (Component* child : m_children)
+			child->m_parent = nullptr;
+
+		if (m_transformQueueFrame)
+		{
+			std::vector<Component*>& queue = m_transformQueueFrame->m_transformUpdateList;
+			queue.erase(std::find(queue.begin(), queue.end(), this));
+		}
+	}
+
+	void Component::SetEnabled(bool enable)
+	{
+		m_isEnabled = enable;
+		if (m_spatialIndex)
+			m_spatialIndex->SetActive(m_spatialIndexEntry, enable);
+	}
+
+	void Component::SetParent(Component* parent)
+	{
+		if (parent == m_parent)
+			return;
+
+		Component* previousParent = m_parent;
+		if (previousParent)
+			previousParent->m_children.erase(std::find(previousParent->m_children.begin(), previousParent->m_children.end(), this));
+
+		m_parent = parent;
+		if (parent)
+		{
+			// Move the component (and its children) to its local position within the new parent
+			parent->m_children.emplace_back(this);
+			if (!m_isTransformDirty)
+				this->MarkSubtreeDirty();
+
+			parent->QueueChildTransformUpdate();
+		}
+
+		// Both parents' layouts have changed, as they have lost or gained a child
+		if (previousParent)
+			previousParent->OnChildLayoutInvalidated(this);
+		if (parent)
+			parent->OnChildLayoutInvalidated(this);
+	}
+
+	void Component::SetLocalPosition(glm::ivec2 position)
+	{
+		if (position == m_localPosition)
+			return;
+
+		m_localPosition = position;
+		if (m_parent && !m_isTransformDirty)
+		{
+			this->MarkSubtreeDirty();
+			m_parent->QueueChildTransformUpdate();
+		}
+	}
+
+	void Component::Update(float /*deltaTime*/) {}
+
+	bool Component::HandleEvent(const UIEvent& /*event*/) { return false; }
 
 	bool Component::IsEnabled() const { return m_isEnabled; }
+
+	bool Component::IsUpdateRequired() const { return m_isUpdateRequired; }
+
+	Component* Component::GetParent() const { return m_parent; }
+
+	const std::vector<Component*>& Component::GetChildren() const { return m_children; }
+
+	const glm::ivec2& Component::GetLocalPosition() const { return m_localPosition; }
+
+	bool Component::GetInteractionBounds(glm::vec2& /*min*/, glm::vec2& /*max*/) const { return false; }
+
+	bool Component::GetRenderBounds(glm::vec2& min, glm::vec2& max) const
+	{
+		bool hasBounds = this->GetInteractionBounds(min, max);
+		for (const Component* child : m_children)
+		{
+			glm::vec2 childMin, childMax;
+			if (!child->IsEnabled() || !child->GetRenderBounds(childMin, childMax))
+				continue;
+
+			min = hasBounds ? glm::min(min, childMin) : childMin;
+			max = hasBounds ? glm::max(max, childMax) : childMax;
+			hasBounds = true;
+		}
+
+		return hasBounds;
+	}
+
+	bool Component::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		// The box is found relative to the component's position, the children's local positions are used as their own positions may not
+		// have been updated yet
+		glm::vec2 min, max;
+		bool hasBox = this->GetInteractionBounds(min, max);
+		if (hasBox)
+		{
+			min -= glm::vec2(this->GetPosition());
+			max -= glm::vec2(this->GetPosition());
+		}
+
+		for (const Component* child : m_children)
+		{
+			glm::ivec2 childSize, childAnchor;
+			if (!child->IsEnabled() || !child->MeasureLayout(childSize, childAnchor))
+				continue;
+
+			const glm::vec2 childMin(child->m_localPosition - childAnchor);
+			min = hasBox ? glm::min(min, childMin) : childMin;
+			max = hasBox ? glm::max(max, childMin + glm::vec2(childSize)) : childMin + glm::vec2(childSize);
+			hasBox = true;
+		}
+
+		if (!hasBox)
+			return false;
+
+		size = glm::ivec2(glm::ceil(max - min));
+		anchor = -glm::ivec2(glm::floor(min));
+		return true;
+	}
+
+	void Component::ArrangeLayout(glm::ivec2 /*size*/) {}
+
+	void Component::OnViewportResized(const Viewport& /*viewport*/) {}
+
+	void Component::SetUpdateRequired(bool required)
+	{
+		m_isUpdateRequired = required;
+
+		// The interface frame drops components which no longer require updating from its update list, so they have to be added back
+		if (required && m_frame && !m_isInUpdateList)
+		{
+			m_frame->m_updateList.emplace_back(this);
+			m_isInUpdateList = true;
+		}
+	}
+
+	void Component::MarkChildTransformsDirty()
+	{
+		// Children which are already marked belong to a subtree which is already queued to be repositioned
+		bool isChildMarked = false;
+		for (Component* child : m_children)
+		{
+			if (!child->m_isTransformDirty)
+			{
+				child->MarkSubtreeDirty();
+				isChildMarked = true;
+			}
+		}
+
+		if (isChildMarked)
+			this->QueueChildTransformUpdate();
+	}
+
+	void Component::UpdateChildTransforms()
+	{
+		const glm::ivec2 position = this->GetPosition();
+		for (Component* child : m_children)
+		{
+			if (!child->m_isTransformDirty)
+				continue;
+
+			// Moving the child doesn't queue its own children again as they're still marked, they're repositioned straight after instead
+			child->m_isTransformDirty = false;
+			child->SetPosition(position + child->m_localPosition);
+			child->UpdateChildTransforms();
+		}
+	}
+
+	void Component::InvalidateLayout()
+	{
+		if (m_parent)
+			m_parent->OnChildLayoutInvalidated(this);
+	}
+
+	void Component::OnChildLayoutInvalidated(Component* /*child*/) {}
+
+	void Component::MarkSubtreeDirty()
+	{
+		m_isTransformDirty = true;
+		for (Component* child : m_children)
+		{
+			if (!child->m_isTransformDirty)
+				child->MarkSubtreeDirty();
+		}
+	}
+
+	void Component::QueueChildTransformUpdate()
+	{
+		if (m_transformQueueFrame)
+			return;
+
+		const Component* root = this;
+		while (root->m_parent)
+			root = root->m_parent;
+
+		if (root->m_frame)
+		{
+			m_transformQueueFrame = root->m_frame;
+			m_transformQueueFrame->m_transformUpdateList.emplace_back(this);
+		}
+		else
+		{
+			this->UpdateChildTransforms();
+		}
+	}
+
+	void Component::UpdateSpatialIndexEntry()
+	{
+		glm::vec2 min, max;
+		if (m_spatialIndex && this->GetInteractionBounds(min, max))
+			m_spatialIndex->Update(m_spatialIndexEntry, min, max);
+	}
+
+	bool Component::IsTopmostAt(glm::vec2 point) const { return !m_spatialIndex || m_spatialIndex->QueryTopmost(point) == this; }
 }
\ No newline at end of file
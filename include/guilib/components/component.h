@@ -3,12 +3,17 @@
 
 #include <utilities/libexport.h>
 #include <utilities/resource_loader.h>
+#include <utilities/input_system.h>
 #include <graphics/viewport.h>
+#include <vector>
 
 namespace GUILib
 {
 	class ShaderProgram;
 	class ResourceLoader::Geometry;
+	class SpatialIndex;
+	class InterfaceFrame;
+	class Component;
 
 	/**
 	* @brief This enumeration is purposed for specifying the component event which a value should be attached to.
@@ -32,8 +37,29 @@ namespace GUILib
 		return ((int)left & (int)right) == (int)right;
 	}
 
+	/**
+	* @brief An enumeration representing the types of events dispatched to UI components by the interface frame.
+	*/
+	enum class UIEventType { POINTER_ENTER, POINTER_LEAVE, POINTER_MOVE, POINTER_DOWN, POINTER_UP, POINTER_SCROLL, KEY_DOWN, KEY_UP, CHARACTER };
+
+	/**
+	* @brief A struct describing an event dispatched to a UI component.
+	* Pointer events are dispatched to the topmost component under the cursor (or the component which has captured the pointer), and keyboard
+	* events are dispatched to the focused component. If the component doesn't handle the event, then it bubbles up to the component's parent.
+	*/
+	struct UIEvent
+	{
+		UIEventType type;
+		Component* target; // The component the event was dispatched to, before bubbling up to its parents
+		glm::vec2 cursorPosition; // The cursor position (mapped to the interface frame's viewport) when the event occurred
+		const InputEvent* input; // The input event which caused this event, this is nullptr for pointer enter and leave events
+	};
+
 	/**
 	* @brief This is an pure virtual class representing a base for deriving UI components.
+	* Components can contain child components, each child is positioned relative to its parent (refer to SetLocalPosition()). When a
+	* component moves, its children are only marked as out of date, and the whole subtree is repositioned once, either at the end of the
+	* interface frame's update or straight away if the component doesn't belong to an interface frame.
 	*/
 	class LIB_DECLSPEC Component
 	{
@@ -43,7 +69,10 @@ namespace GUILib
 		*/
 		Component();
 
-		virtual ~Component() = default;
+		/**
+		* @brief Detaches the component from its parent and children, the children aren't deleted.
+		*/
+		virtual ~Component();
 
 		/**
 		* @brief Sets whether or not the component is enabled.
@@ -51,13 +80,47 @@ namespace GUILib
 		*/
 		void SetEnabled(bool enable);
 
+		/**
+		* @brief Sets the parent of the component, the component is then positioned relative to its parent and events which the component
+		* doesn't handle bubble up to its parent. The parent doesn't take ownership of the component.
+		* 
+		* @param[in] parent - The parent component, or nullptr if the component has no parent.
+		*/
+		void SetParent(Component* parent);
+
+		/**
+		* @brief Sets the position of the component.
+		* This is required to be overrided by deriving UI component classes. If the component has a parent, then this is overridden whenever
+		* the parent moves, so use SetLocalPosition() instead.
+		* 
+		* @param[in] pos - The new position of the component.
+		*/
+		virtual void SetPosition(glm::ivec2 pos) = 0;
+
+		/**
+		* @brief Sets the position of the component relative to its parent's position, this has no effect if the component has no parent.
+		* @param[in] position - The new local position of the component.
+		*/
+		void SetLocalPosition(glm::ivec2 position);
+
 		/**
 		* @brief Updates the logic of the UI component.
-		* This is required to be overrided by deriving UI component classes.
+		* The interface frame only calls this while the component requires updating (see SetUpdateRequired()), so it is meant for animating
+		* the component. By default it does nothing.
 		* 
 		* @param[in] deltaTime - The elapsed time between the previous and current frame.
 		*/
-		virtual void Update(float deltaTime) = 0;
+		virtual void Update(float deltaTime);
+
+		/**
+		* @brief Handles an event dispatched to the UI component by the interface frame.
+		* Handling an event doesn't wake the component, a component which has to be updated in response to an event marks itself as requiring
+		* updates (see SetUpdateRequired()). By default events aren't handled, so they bubble up to the parent component.
+		*
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the event was handled (which stops it from bubbling up), FALSE otherwise.
+		*/
+		virtual bool HandleEvent(const UIEvent& event);
 
 		/**
 		* @brief Renders the UI component.
@@ -71,15 +134,169 @@ namespace GUILib
 		* @return TRUE if the component is enabled, FALSE otherwise.
 		*/
 		bool IsEnabled() const;
+
+		/**
+		* @brief Returns whether or not the interface frame calls the component's Update() method each frame.
+		* @return TRUE if the component requires updating, FALSE otherwise.
+		*/
+		bool IsUpdateRequired() const;
+
+		/**
+		* @brief Returns the parent of the component.
+		* @return The parent component, or nullptr if the component has no parent.
+		*/
+		Component* GetParent() const;
+
+		/**
+		* @brief Returns the children of the component.
+		* @return The child components, in the order they were added.
+		*/
+		const std::vector<Component*>& GetChildren() const;
+
+		/**
+		* @brief Returns the position of the component.
+		* This is required to be overrided by deriving UI component classes.
+		* 
+		* @return The position of the component.
+		*/
+		virtual const glm::ivec2& GetPosition() const = 0;
+
+		/**
+		* @brief Returns the position of the component relative to its parent's position.
+		* @return The local position of the component.
+		*/
+		const glm::ivec2& GetLocalPosition() const;
+
+		/**
+		* @brief Retrieves the bounds within which the component responds to the cursor, these are used for hit testing.
+		* By default components don't respond to the cursor, so this should be overrided by interactive UI component classes.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE if the component responds to the cursor, FALSE otherwise (in which case the bounds aren't assigned).
+		*/
+		virtual bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const;
+
+		/**
+		* @brief Retrieves the bounds which the component and its enabled children are rendered within, these are used to skip rendering
+		* components outside of the viewport.
+		* By default these are the interaction bounds of the component combined with the render bounds of its children.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE if the bounds are known, FALSE otherwise (in which case the component is always rendered).
+		*/
+		virtual bool GetRenderBounds(glm::vec2& min, glm::vec2& max) const;
+
+		/**
+		* @brief Measures the box which the component occupies when it is arranged by a layout panel.
+		* By default this is the box around the component's interaction bounds and the boxes of its enabled children.
+		*
+		* @param[out] size - The size of the component's box.
+		* @param[out] anchor - The offset of the component's position from the top-left corner of its box.
+		* @return TRUE if the component occupies a box, FALSE otherwise (in which case it takes up no space and isn't positioned).
+		*/
+		virtual bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const;
+
+		/**
+		* @brief Resizes the component to the size of the box given by the layout panel arranging it, this is only done when the component
+		* is stretched or grows to fill space. By default components keep their size.
+		*
+		* @param[in] size - The size of the box which the component has been given.
+		*/
+		virtual void ArrangeLayout(glm::ivec2 size);
+
+		/**
+		* @brief Called when the component is added to an interface frame, and whenever the interface frame's viewport is resized.
+		* By default this does nothing.
+		*
+		* @param[in] viewport - The viewport of the interface frame.
+		*/
+		virtual void OnViewportResized(const Viewport& viewport);
 	protected:
 		/**
 		* @brief Initialises the UI component.
 		*/
 		virtual void InitializeComponent() = 0;
+
+		/**
+		* @brief Sets whether or not the interface frame calls the component's Update() method each frame.
+		* Every component requires updating by default. Components which only change in response to events can stop requiring updates once
+		* they are idle, dispatching an event to the component makes it require updates again.
+		*
+		* @param[in] required - Specifies whether or not the component requires updating.
+		*/
+		void SetUpdateRequired(bool required);
+
+		/**
+		* @brief Marks the children of the component as needing to be repositioned, this should be called whenever the component moves.
+		* The children (and their children) are repositioned once at the end of the interface frame's update, or straight away if the
+		* component doesn't belong to an interface frame.
+		*/
+		void MarkChildTransformsDirty();
+
+		/**
+		* @brief Repositions the children of the component which are out of date straight away, relative to the component's position.
+		*/
+		void UpdateChildTransforms();
+
+		/**
+		* @brief Notifies the component's parent that the component has changed size, this should be called whenever the box measured by
+		* MeasureLayout() changes, so that the layout panel containing the component lays it out again.
+		*/
+		void InvalidateLayout();
+
+		/**
+		* @brief Called when a child of the component has changed size, or has been added to or removed from the component.
+		* By default this does nothing, layout panels override this to lay out their children again.
+		*
+		* @param[in] child - The child whose layout has changed.
+		*/
+		virtual void OnChildLayoutInvalidated(Component* child);
+
+		/**
+		* @brief Updates the component's entry in the spatial index of the interface frame it belongs to.
+		* This should be called whenever the interaction bounds of the component change.
+		*/
+		void UpdateSpatialIndexEntry();
+
+		/**
+		* @brief Checks whether or not the component is the topmost component at the point given, within the interface frame it belongs to.
+		* Components which don't belong to an interface frame (e.g. those within another component) are always considered to be topmost.
+		*
+		* @param[in] point - The point to be looked up.
+		* @return TRUE if no other component is above this component at the point, FALSE otherwise.
+		*/
+		bool IsTopmostAt(glm::vec2 point) const;
 	protected:
 		ShaderProgram* m_shaders;
 		ResourceLoader::Geometry m_geometry;
 		bool m_isEnabled;
+	private:
+		friend class InterfaceFrame;
+
+		/**
+		* @brief Marks the component and all of its descendants as needing to be repositioned.
+		*/
+		void MarkSubtreeDirty();
+
+		/**
+		* @brief Queues the component's children to be repositioned by the interface frame the component's root belongs to, or repositions
+		* them straight away if the root doesn't belong to an interface frame.
+		*/
+		void QueueChildTransformUpdate();
+
+		// The interface frame the component belongs to, along with the component's entry within the frame's spatial index
+		InterfaceFrame* m_frame;
+		SpatialIndex* m_spatialIndex;
+		size_t m_spatialIndexEntry;
+
+		Component* m_parent;
+		std::vector<Component*> m_children;
+		glm::ivec2 m_localPosition;
+		bool m_isTransformDirty; // Whether or not the component's position is out of date relative to its parent
+		InterfaceFrame* m_transformQueueFrame; // The interface frame which the component is queued to reposition its children in
+		bool m_isUpdateRequired, m_isInUpdateList; // Whether or not the component requires updating, and whether it's in the frame's update list
 	};
 }
 
@@ -1,21 +1,20 @@
 #include <components/drop_down.h>
-#include <utilities/input_system.h>
 #include <external/glm/glm/gtc/matrix_transform.hpp>
 
 namespace GUILib
 {
 	DropDown::DropDown(const Viewport& viewport, const Font* font, float fontSize) :
-		m_font(font), m_fontSize(fontSize), m_optionsOffset(0.0f)
+		m_font(font), m_fontSize(fontSize), m_currentSelectedValueID(-1), m_viewportHeight(viewport.GetSize().y), m_optionsOffset(0.0f)
 	{
 		this->InitializeComponent();
-		m_maxVisibleOptions = this->CalculateMaxVisibleOptions(viewport);
+		this->UpdateMaxVisibleOptions();
 	}
 
 	DropDown::~DropDown()
 	{
 		delete m_currentSelectedBox;
-		for (auto& option : m_options)
-			delete option.button;
+		for (auto& optionRow : m_optionRows)
+			delete optionRow.button;
 	}
 
 	void DropDown::InitializeComponent()
@@ -26,6 +25,7 @@ namespace GUILib
 
 		m_currentSelectedBox = new TextBox(m_font, m_fontSize, "No options available", true);
 		m_currentSelectedBox->SetInputState(false); // Make the text box read-only
+		m_currentSelectedBox->SetParent(this);
 
 		m_currentSelectedBox->SetBorderColor({ 0.0f, 0.0f, 0.0f, 1.0f }, ComponentEvent::NO_EVENT);
 		m_currentSelectedBox->SetBorderColor({ 0.0f, 0.0f, 0.0f, 1.0f }, ComponentEvent::HOVERED_EVENT);
@@ -34,22 +34,125 @@ namespace GUILib
 		m_seperatorColor = { 0.8f, 0.8f, 0.8f, 1.0f };
 	}
 
-	int DropDown::CalculateMaxVisibleOptions(const Viewport& viewport) const
+	void DropDown::UpdateMaxVisibleOptions()
 	{
 		const glm::ivec2& size = m_currentSelectedBox->GetSize();
-		const float& borderThickness = m_currentSelectedBox->GetBorderThickness();
-		return (int)((viewport.GetSize().y - m_currentSelectedBox->GetPosition().y - ((float)size.y / 2)) / size.y);
+		m_maxVisibleOptions = std::max((int)((m_viewportHeight - m_currentSelectedBox->GetPosition().y - ((float)size.y / 2)) /
+			std::max(size.y, 1)), 0);
+
+		// Keep the options scrolled within range, as fewer options may fit now
+		m_optionsOffset = std::min(m_optionsOffset, (float)std::max((int)m_options.size() - m_maxVisibleOptions, 0));
+
+		// Release the rows which no longer fit, the pool never holds more rows than there are visible options
+		if ((int)m_optionRows.size() > m_maxVisibleOptions)
+		{
+			m_pointerRouter.Reset(); // The released rows mustn't be routed any more events
+			for (size_t i = (size_t)m_maxVisibleOptions; i < m_optionRows.size(); i++)
+				delete m_optionRows[i].button;
+
+			m_optionRows.resize((size_t)m_maxVisibleOptions);
+		}
+	}
+
+	int DropDown::GetVisibleOptionCount() const
+	{
+		const int firstVisibleOption = (int)m_optionsOffset;
+		return std::max(std::min(firstVisibleOption + m_maxVisibleOptions, (int)m_options.size()) - firstVisibleOption, 0);
+	}
+
+	void DropDown::UpdateOptionRows()
+	{
+		const int firstVisibleOption = (int)m_optionsOffset;
+		const int visibleOptionCount = this->GetVisibleOptionCount();
+
+		// Only create the rows which are visible, as the list is opened and scrolled the same rows are reused for other options
+		while ((int)m_optionRows.size() < visibleOptionCount)
+		{
+			OptionRow optionRow;
+			optionRow.button = this->CreateOptionRow(m_optionRows.size());
+			m_optionRows.emplace_back(optionRow);
+		}
+
+		// Position the rows below the current selected box, relative to the drop-down
+		for (size_t i = 0; i < m_optionRows.size(); i++)
+		{
+			OptionRow& optionRow = m_optionRows[i];
+			if ((int)i >= visibleOptionCount)
+			{
+				optionRow.button->SetEnabled(false);
+				optionRow.optionIndex = -1;
+				continue;
+			}
+
+			const int optionIndex = firstVisibleOption + (int)i;
+			if (optionRow.optionIndex != optionIndex) // The text's glyphs are only generated again when the row displays another option
+			{
+				optionRow.button->SetText(m_options[optionIndex].text);
+				optionRow.optionIndex = optionIndex;
+			}
+
+			optionRow.button->SetLocalPosition({ 0, (m_currentSelectedBox->GetBorderThickness() / 2) +
+				(int)((float)(i + 1) * optionRow.button->GetSize().y) });
+
+			optionRow.button->SetEnabled(true);
+		}
+	}
+
+	PushButton* DropDown::CreateOptionRow(size_t rowIndex)
+	{
+		PushButton* rowButton = new PushButton(std::string(), m_font, m_fontSize);
+		rowButton->SetEnabled(false);
+		rowButton->SetParent(this);
+		rowButton->SetSize(m_currentSelectedBox->GetSize());
+
+		// The row is looked up by its index when clicked, as the pool's array may have been reallocated since the row was created
+		rowButton->SetClickCallback([=]() {
+			const int optionIndex = m_optionRows[rowIndex].optionIndex;
+			if (optionIndex >= 0)
+				this->SetCurrentSelected(m_options[optionIndex].valueID);
+
+			this->ReleaseFocus(); // Deactivate the drop-down
+			});
+
+		rowButton->SetColor(m_currentSelectedBox->GetColor(ComponentEvent::NO_EVENT), ComponentEvent::NO_EVENT);
+		rowButton->SetColor(m_currentSelectedBox->GetColor(ComponentEvent::HOVERED_EVENT), ComponentEvent::HOVERED_EVENT);
+		rowButton->SetColor(m_currentSelectedBox->GetColor(ComponentEvent::CLICKED_EVENT), ComponentEvent::CLICKED_EVENT);
+		rowButton->SetBorderThickness(0);
+		return rowButton;
+	}
+
+	void DropDown::InvalidateOptionRows()
+	{
+		for (auto& optionRow : m_optionRows)
+			optionRow.optionIndex = -1;
+
+		this->SetUpdateRequired(true); // The rows are bound again by the update
+	}
+
+	bool DropDown::IsChildUpdateRequired() const
+	{
+		if (m_currentSelectedBox->IsUpdateRequired())
+			return true;
+
+		// The hidden options aren't updated until the drop-down is activated again
+		if (!m_currentSelectedBox->IsFocused())
+			return false;
+
+		for (const auto& optionRow : m_optionRows)
+		{
+			if (optionRow.optionIndex >= 0 && optionRow.button->IsUpdateRequired())
+				return true;
+		}
+
+		return false;
 	}
 
 	void DropDown::AddOption(std::string_view optionText, int valueID)
 	{
 		/// Precautionary checks ///
 		// Make sure there isn't already an existing option with the same value ID
-		for (const auto& option : m_options)
-		{
-			if (option.valueID == valueID)
-				return;
-		}
+		if (m_optionIndices.find(valueID) != m_optionIndices.end())
+			return;
 
 		// Make sure that the value ID given is larger than 0
 		if (valueID < 0)
@@ -60,38 +163,36 @@ namespace GUILib
 		if (m_options.empty())
 			m_currentSelectedBox->SetHintText("Select an option");
 		
-		// Setup the option object
+		// Add the option into the vector array, it's only displayed by a row once it's scrolled into view
 		SelectionOption option;
+		option.text = optionText;
 		option.valueID = valueID;
 
-		option.button = new PushButton(optionText, m_font, m_fontSize);
-		option.button->SetEnabled(false);
-		option.button->SetSize(m_currentSelectedBox->GetSize());
-
-		option.button->SetClickCallback([=]() {
-			this->SetCurrentSelected(option.valueID);
-			m_currentSelectedBox->SetFocusState(false);
-			});
-
-		option.button->SetColor(m_currentSelectedBox->GetColor(ComponentEvent::NO_EVENT), ComponentEvent::NO_EVENT);
-		option.button->SetColor(m_currentSelectedBox->GetColor(ComponentEvent::HOVERED_EVENT), ComponentEvent::HOVERED_EVENT);
-		option.button->SetColor(m_currentSelectedBox->GetColor(ComponentEvent::CLICKED_EVENT), ComponentEvent::CLICKED_EVENT);
-		option.button->SetBorderThickness(0);
-
-		// Add the option object into the vector array
-		m_options.emplace_back(option);
+		m_optionIndices.emplace(valueID, m_options.size());
+		m_options.emplace_back(std::move(option));
+		this->SetUpdateRequired(true);
 	}
 
 	void DropDown::RemoveOption(int valueID)
 	{
-		for (auto it = m_options.begin(); it != m_options.end(); it++)
-		{
-			if (it->valueID == valueID)
-			{
-				m_options.erase(it);
-				break;
-			}
-		}
+		const auto it = m_optionIndices.find(valueID);
+		if (it == m_optionIndices.end())
+			return;
+
+		// The removed option can't stay selected, so no option is selected and the selected box's text is cleared
+		if (valueID == m_currentSelectedValueID)
+			this->SetCurrentSelected(-1);
+
+		// Keep the remaining options in order, the options after the removed one move down an index
+		const size_t index = it->second;
+		m_optionIndices.erase(it);
+		m_options.erase(m_options.begin() + index);
+		for (size_t i = index; i < m_options.size(); i++)
+			m_optionIndices[m_options[i].valueID] = i;
+
+		m_optionsOffset = std::min(m_optionsOffset, (float)std::max((int)m_options.size() - m_maxVisibleOptions, 0));
+		m_pointerRouter.Reset(); // The row under the cursor may now display another option
+		this->InvalidateOptionRows();
 
 		// Update the drop-down hint text
 		if (m_options.empty())
@@ -101,9 +202,14 @@ namespace GUILib
 	void DropDown::ClearSelectionList()
 	{
 		m_currentSelectedBox->SetHintText("No options available");
-		m_currentSelectedBox->SetFocusState(false);
-		m_currentSelectedValueID = -1;
+		this->ReleaseFocus();
+		this->SetCurrentSelected(-1);
 		m_options.clear();
+		m_optionIndices.clear();
+		m_optionsOffset = 0.0f;
+
+		m_pointerRouter.Reset();
+		this->InvalidateOptionRows();
 	}
 
 	void DropDown::SetCurrentSelected(int valueID)
@@ -115,32 +221,43 @@ namespace GUILib
 		}
 		else
 		{
-			for (const auto& option : m_options)
+			const auto it = m_optionIndices.find(valueID);
+			if (it != m_optionIndices.end())
 			{
-				if (option.valueID == valueID)
-				{
-					m_currentSelectedBox->SetInputText(option.button->GetText());
-					m_currentSelectedValueID = valueID;
-					break;
-				}
+				m_currentSelectedBox->SetInputText(m_options[it->second].text);
+				m_currentSelectedValueID = valueID;
 			}
 		}
+
+		this->SetUpdateRequired(true); // The current selected box is updated to its new text by the drop-down's update
 	}
 
-	void DropDown::SetPosition(glm::ivec2 pos) { m_currentSelectedBox->SetPosition(pos); }
+	void DropDown::SetPosition(glm::ivec2 pos)
+	{
+		m_currentSelectedBox->SetPosition(pos);
+		this->UpdateMaxVisibleOptions();
+		this->UpdateSpatialIndexEntry();
+		this->MarkChildTransformsDirty();
+		this->SetUpdateRequired(true);
+	}
 
 	void DropDown::SetSize(glm::ivec2 size)
 	{
 		m_currentSelectedBox->SetSize(size);
-		for (auto& option : m_options)
-			option.button->SetSize(size);
+		for (auto& optionRow : m_optionRows)
+			optionRow.button->SetSize(size);
+
+		this->UpdateMaxVisibleOptions();
+		this->UpdateSpatialIndexEntry();
+		this->InvalidateLayout();
+		this->SetUpdateRequired(true);
 	}
 
 	void DropDown::SetColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
 		m_currentSelectedBox->SetColor(color, eventEnum);
-		for (auto& option : m_options)
-			option.button->SetColor(color, eventEnum);
+		for (auto& optionRow : m_optionRows)
+			optionRow.button->SetColor(color, eventEnum);
 	}
 
 	void DropDown::SetBorderColor(glm::vec4 color, ComponentEvent eventEnum) { m_currentSelectedBox->SetBorderColor(color, eventEnum); }
@@ -151,50 +268,91 @@ namespace GUILib
 
 	void DropDown::Update(float deltaTime)
 	{
+		// The drop-down is activated while it is focused, which focuses the current selected box
 		if (m_gainedFocus)
 			m_currentSelectedBox->SetFocusState(true);
 		else if (m_lostFocus)
 			m_currentSelectedBox->SetFocusState(false);
 
-		if (m_currentSelectedBox->HasRequestedFocus() && !InputSystem::GetInstance().WasMouseButtonPressed(MouseButtonCode::MOUSE_BUTTON_LEFT))
-			m_requestedFocus = true;
-
 		if (m_currentSelectedBox->IsFocused()) // This means the drop-down has been activated
 		{
-			// Update the selection options offset via the user scrolling
-			const float scrollOffsetY = InputSystem::GetInstance().GetScrollOffset().y;
+			// Bind the visible options to the rows, the rows respond to the cursor straight away, so they're repositioned straight away
+			this->UpdateOptionRows();
+			this->UpdateChildTransforms();
 
+			const int visibleOptionCount = this->GetVisibleOptionCount();
+			for (int i = 0; i < visibleOptionCount; i++)
+			{
+				if (m_optionRows[i].button->IsUpdateRequired())
+					m_optionRows[i].button->Update(deltaTime);
+			}
+		}
+		else
+		{
+			// The hidden options stop receiving events, so the option under the cursor is left, the current selected box keeps its events
+			const Component* hoveredChild = m_pointerRouter.GetHoveredChild();
+			const Component* capturedChild = m_pointerRouter.GetCapturedChild();
+			if ((hoveredChild && hoveredChild != m_currentSelectedBox) || (capturedChild && capturedChild != m_currentSelectedBox))
+				m_pointerRouter.Reset();
+
+			for (auto& optionRow : m_optionRows)
+				optionRow.button->SetEnabled(false);
+		}
+
+		if (m_currentSelectedBox->IsUpdateRequired())
+			m_currentSelectedBox->Update(deltaTime);
+
+		// The visible options are part of the drop-down's bounds while it is activated, so the bounds change whenever it opens or closes
+		this->UpdateSpatialIndexEntry();
+
+		this->ResetActionFocusFlags(); // Reset the gained and lost focus flags to false
+
+		// The drop-down only has to be updated again while any of its children has to be
+		this->SetUpdateRequired(this->IsChildUpdateRequired());
+	}
+
+	bool DropDown::HandleEvent(const UIEvent& event)
+	{
+		// Scrolling the activated drop-down scrolls through the options
+		if (event.type == UIEventType::POINTER_SCROLL && m_currentSelectedBox->IsFocused())
+		{
+			const float scrollOffsetY = event.input->scrollOffset.y;
 			if (scrollOffsetY > 0.0f)
 				m_optionsOffset = std::max(m_optionsOffset - 0.075f, 0.0f);
 			else if (scrollOffsetY < 0.0f)
 				m_optionsOffset = std::min(m_optionsOffset + 0.075f, (float)std::max((int)m_options.size() - m_maxVisibleOptions, 0));
 
-			// Update the selection element buttons
-			const glm::ivec2& dropDownPosition = m_currentSelectedBox->GetPosition();
-			for (int i = (int)m_optionsOffset; i < std::min((int)m_optionsOffset + m_maxVisibleOptions, (int)m_options.size()); i++)
-			{
-				PushButton* optionButton = m_options[i].button;
-				optionButton->SetPosition({ dropDownPosition.x, 
-					dropDownPosition.y + (m_currentSelectedBox->GetBorderThickness() / 2) + 
-					((float)((i - (int)m_optionsOffset) + 1) * optionButton->GetSize().y)});
+			this->SetUpdateRequired(true); // The rows are bound to the options scrolled into view by the update
+			return true;
+		}
 
-				optionButton->SetEnabled(true);
-				optionButton->Update(deltaTime);
+		// The current selected box isn't added to the interface frame either, so it is routed the events while none of the options are hit
+		Component* childUnderCursor = nullptr;
+		if (m_currentSelectedBox->IsFocused())
+		{
+			for (const auto& optionRow : m_optionRows)
+			{
+				if (optionRow.optionIndex >= 0 && PointerEventRouter::HitTest(optionRow.button, event.cursorPosition))
+				{
+					childUnderCursor = optionRow.button;
+					break;
+				}
 			}
 		}
-		else
-		{
-			if (m_isFocused)
-				m_isFocused = false;
 
-			for (auto& option : m_options)
-				option.button->SetEnabled(false);
-		}
+		if (!childUnderCursor && PointerEventRouter::HitTest(m_currentSelectedBox, event.cursorPosition))
+			childUnderCursor = m_currentSelectedBox;
 
-		// Update the current selected option box
-		m_currentSelectedBox->Update(deltaTime);
+		const bool isHandled = m_pointerRouter.Route(event, childUnderCursor);
 
-		this->ResetActionFocusFlags(); // Reset the gained and lost focus flags to false
+		// Pressing the current selected box activates the drop-down
+		if (m_currentSelectedBox->HasRequestedFocus() && !m_isFocused)
+			this->RequestFocus();
+
+		if (this->IsChildUpdateRequired())
+			this->SetUpdateRequired(true);
+
+		return isHandled;
 	}
 
 	void DropDown::Render(const Viewport& viewport) const
@@ -204,14 +362,16 @@ namespace GUILib
 
 		if (m_currentSelectedBox->IsFocused()) // This means the drop-down has been activated
 		{
-			for (int i = (int)m_optionsOffset; i < std::min((int)m_optionsOffset + m_maxVisibleOptions, (int)m_options.size()); i++)
+			// Only the rows bound to an option are rendered, the rows are bound again after the options change when the drop-down updates
+			const int visibleRowCount = std::min(this->GetVisibleOptionCount(), (int)m_optionRows.size());
+			for (int i = 0; i < visibleRowCount && m_optionRows[i].optionIndex >= 0; i++)
 			{
-				/// Render the selection option buttons ///
-				const PushButton* optionButton = m_options[i].button;
+				/// Render the selection option rows ///
+				const PushButton* optionButton = m_optionRows[i].button;
 				optionButton->Render(viewport);
 
 				/// Render the line seperator ///
-				if (i < std::min((int)m_optionsOffset + m_maxVisibleOptions, (int)m_options.size()) - 1)
+				if (i < visibleRowCount - 1)
 				{
 					// Construct the model matrix
 					glm::mat4 model = glm::mat4(1.0f);
@@ -284,9 +444,38 @@ namespace GUILib
 
 	const glm::ivec2& DropDown::GetSize() const { return m_currentSelectedBox->GetSize(); }
 
-	const glm::vec4& DropDown::GetColor(ComponentEvent eventEnum) const { return m_currentSelectedBox->GetColor(eventEnum); }
+	bool DropDown::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		size = m_currentSelectedBox->GetSize();
+		anchor = size / 2;
+		return true;
+	}
+
+	void DropDown::ArrangeLayout(glm::ivec2 size) { this->SetSize(size); }
+
+	void DropDown::OnViewportResized(const Viewport& viewport)
+	{
+		m_viewportHeight = viewport.GetSize().y;
+		this->UpdateMaxVisibleOptions();
+		this->SetUpdateRequired(true);
+	}
+
+	bool DropDown::GetInteractionBounds(glm::vec2& min, glm::vec2& max) const
+	{
+		const glm::vec2 position(m_currentSelectedBox->GetPosition()), size(m_currentSelectedBox->GetSize());
+		min = position - (size / 2.0f);
+		max = position + (size / 2.0f);
+
+		// Extend the bounds downwards over the visible options
+		if (m_currentSelectedBox->IsFocused())
+			max.y += std::min(m_maxVisibleOptions, (int)m_options.size()) * size.y;
+
+		return true;
+	}
+
+	glm::vec4 DropDown::GetColor(ComponentEvent eventEnum) const { return m_currentSelectedBox->GetColor(eventEnum); }
 
-	const glm::vec4& DropDown::GetBorderColor(ComponentEvent eventEnum) const { return m_currentSelectedBox->GetBorderColor(eventEnum); }
+	glm::vec4 DropDown::GetBorderColor(ComponentEvent eventEnum) const { return m_currentSelectedBox->GetBorderColor(eventEnum); }
 	
 	const int& DropDown::GetBorderThickness() const { return m_currentSelectedBox->GetBorderThickness(); }
 
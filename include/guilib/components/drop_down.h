@@ -4,10 +4,19 @@
 #include <components/focusable_component.h>
 #include <components/push_button.h>
 #include <components/textbox.h>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace GUILib
 {
+	/**
+	* @brief This is a class which implements a drop-down list of selectable options.
+	*
+	* The options are only stored as their text and value ID, the drop-down doesn't create a button for each option. Instead the visible
+	* options are displayed by a small pool of row buttons (at most one per visible row), which are rebound to other options as the list
+	* scrolls, so the cost of opening and scrolling the drop-down doesn't depend on the amount of options.
+	*/
 	class LIB_DECLSPEC DropDown : public FocusableComponent
 	{
 	public:
@@ -52,7 +61,7 @@ namespace GUILib
 		* @brief Sets the current position of the drop-down component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the current size of the drop-down component.
@@ -94,6 +103,15 @@ namespace GUILib
 		*/
 		void Update(float deltaTime) override;
 
+		/**
+		* @brief Routes the pointer events dispatched to the drop-down to the current selected box, or to the visible option under the cursor
+		* while the drop-down is activated, as neither of them are added to the interface frame themselves. Pressing the current selected box
+		* activates the drop-down (by focusing it), and scrolling the activated drop-down scrolls through the options.
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the event is handled by the drop-down or the child which the event was routed to, FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event) override;
+
 		/**
 		* @brief Renders the drop-down component.
 		* @param[in] viewport - The viewport where the component is being rendered to.
@@ -110,7 +128,7 @@ namespace GUILib
 		* @brief Returns the current position of the drop-down component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
 
 		/**
 		* @brief Returns the size of this drop-down component.
@@ -118,6 +136,35 @@ namespace GUILib
 		*/
 		const glm::ivec2& GetSize() const;
 
+		/**
+		* @brief Measures the box which the drop-down occupies when arranged by a layout panel, which is the size of its selection box (the options list isn't included).
+		* @param[out] size - The size of the component's box.
+		* @param[out] anchor - The offset of the component's position from the top-left corner of its box.
+		* @return TRUE, as drop-downs always occupy a box.
+		*/
+		bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const override;
+
+		/**
+		* @brief Resizes the drop-down to the size of the box given by the layout panel arranging it.
+		* @param[in] size - The new size of the component.
+		*/
+		void ArrangeLayout(glm::ivec2 size) override;
+
+		/**
+		* @brief Recalculates the max amount of options visible at one time, as it depends on the height of the viewport.
+		* @param[in] viewport - The viewport of the interface frame the drop-down belongs to.
+		*/
+		void OnViewportResized(const Viewport& viewport) override;
+
+		/**
+		* @brief Retrieves the bounds of the drop-down component, including the visible options while the drop-down is activated, these are used for hit testing.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, as drop-downs always respond to the cursor.
+		*/
+		bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const override;
+
 		/**
 		* @brief Returns the drop-down color which is displayed when the specified component event occurs.
 		* @param[in] eventEnum - The component event to retrieve the attached color from.
@@ -125,7 +172,7 @@ namespace GUILib
 		*
 		* @return The drop-down color attached to the specified event.
 		*/
-		const glm::vec4& GetColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the drop-down border color which is displayed when the specified component event occurs.
@@ -134,7 +181,7 @@ namespace GUILib
 		*
 		* @return The drop-down border color attached to the specified event.
 		*/
-		const glm::vec4& GetBorderColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetBorderColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the thickness of the drop-down component's border.
@@ -150,22 +197,60 @@ namespace GUILib
 	private:
 		struct SelectionOption
 		{
-			PushButton* button = nullptr;
+			std::string text;
 			int valueID = -1;
 		};
 
+		struct OptionRow
+		{
+			PushButton* button = nullptr;
+			int optionIndex = -1; // The index of the option displayed by the row, or -1 if the row isn't bound to an option
+		};
+
 		/**
 		* @brief Initialises the drop-down component.
 		*/
 		void InitializeComponent() override;
 
 		/**
-		* @brief Calculates the max amount of options can be displayed at one time by the drop-down component.
-		* 
-		* @param[in] viewport - The viewport which the component is being rendered to.
-		* @return The max amount of options visible at one time.
+		* @brief Calculates the max amount of options can be displayed at one time by the drop-down component, which is the amount that fit
+		* between the selection box and the bottom of the viewport. This is recalculated whenever the drop-down moves or resizes, and whenever
+		* the viewport is resized.
+		*/
+		void UpdateMaxVisibleOptions();
+
+		/**
+		* @brief Returns the amount of options currently visible while the drop-down is activated, which are the options from the scroll
+		* offset onwards that fit below the selection box.
+		* @return The amount of visible options.
+		*/
+		int GetVisibleOptionCount() const;
+
+		/**
+		* @brief Binds the visible options to the option rows and positions the rows below the selection box, creating rows when there are
+		* more visible options than rows. A row's text is only set again when it's bound to another option.
+		*/
+		void UpdateOptionRows();
+
+		/**
+		* @brief Creates the row button at the specified index of the pool, which selects the option bound to the row when clicked.
+		* @param[in] rowIndex - The index of the row in the pool.
+		* @return The row's button.
+		*/
+		PushButton* CreateOptionRow(size_t rowIndex);
+
+		/**
+		* @brief Unbinds every option row, this must be called whenever the options move to other indices (or are removed), so that the rows
+		* are bound again (and their text set again) when they are next updated.
+		*/
+		void InvalidateOptionRows();
+
+		/**
+		* @brief Checks whether the current selected box or any of the visible options require updating, the drop-down updates them as they
+		* aren't added to the interface frame.
+		* @return TRUE if any of the drop-down's children require updating, FALSE otherwise.
 		*/
-		int CalculateMaxVisibleOptions(const Viewport& viewport) const;
+		bool IsChildUpdateRequired() const;
 	private:
 		const Font* m_font;
 		float m_fontSize;
@@ -175,8 +260,12 @@ namespace GUILib
 		int m_currentSelectedValueID;
 
 		std::vector<SelectionOption> m_options;
+		std::unordered_map<int, size_t> m_optionIndices; // The index of each option in the options array, by value ID
+		std::vector<OptionRow> m_optionRows;
 		int m_maxVisibleOptions;
+		int m_viewportHeight; // The height of the viewport which the component is being rendered to
 		float m_optionsOffset;
+		PointerEventRouter m_pointerRouter; // Routes the pointer events to the current selected box and the visible options
 
 		ResourceLoader::Geometry m_triangleGeometry;
 	};
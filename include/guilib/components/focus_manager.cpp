@@ -0,0 +1,131 @@
+#include <components/focus_manager.h>
+#include <components/focusable_component.h>
+
+namespace GUILib
+{
+	FocusManager::FocusManager() :
+		m_focused(nullptr), m_focusRequest(nullptr)
+	{}
+
+	FocusManager::FocusManager(FocusManager&& temp) noexcept :
+		m_focused(nullptr), m_focusRequest(nullptr)
+	{
+		*this = std::move(temp);
+	}
+
+	FocusManager::~FocusManager()
+	{
+		for (FocusableComponent* component : m_focusList)
+			component->m_focusManager = nullptr;
+	}
+
+	void FocusManager::Register(FocusableComponent* component)
+	{
+		if (!component || component->m_focusManager == this)
+			return;
+
+		component->m_focusManager = this;
+		component->m_focusIndex = m_focusList.size();
+		m_focusList.emplace_back(component);
+
+		// A component which is already focused takes over focus
+		if (component->IsFocused())
+			this->SetFocus(component);
+	}
+
+	void FocusManager::Unregister(FocusableComponent* component)
+	{
+		if (!component || component->m_focusManager != this)
+			return;
+
+		// Keep the tab order of the remaining components, only the components after the removed one have to be re-indexed
+		m_focusList.erase(m_focusList.begin() + component->m_focusIndex);
+		for (size_t i = component->m_focusIndex; i < m_focusList.size(); i++)
+			m_focusList[i]->m_focusIndex = i;
+
+		if (m_focused == component)
+			m_focused = nullptr;
+		if (m_focusRequest == component)
+			m_focusRequest = nullptr;
+
+		component->m_focusManager = nullptr;
+	}
+
+	void FocusManager::RequestFocus(FocusableComponent* component)
+	{
+		if (!m_focusRequest)
+			m_focusRequest = component;
+	}
+
+	void FocusManager::ApplyFocusRequest()
+	{
+		if (!m_focusRequest)
+			return;
+
+		FocusableComponent* focusRequest = m_focusRequest;
+		m_focusRequest = nullptr;
+		this->SetFocus(focusRequest);
+	}
+
+	void FocusManager::SetFocus(FocusableComponent* component)
+	{
+		// Only registered components can be focused, so that the focused component never outlives its registration
+		if (component && component->m_focusManager != this)
+			return;
+
+		if (m_focused && m_focused != component)
+			m_focused->SetFocusState(false);
+
+		m_focused = component;
+		if (component)
+			component->SetFocusState(true);
+	}
+
+	void FocusManager::FocusNext() { this->StepFocus(1); }
+
+	void FocusManager::FocusPrevious() { this->StepFocus(-1); }
+
+	FocusableComponent* FocusManager::GetFocused() const
+	{
+		// Components can unfocus themselves (e.g. when clicked outside of), in which case no component is focused
+		return m_focused && m_focused->IsFocused() ? m_focused : nullptr;
+	}
+
+	FocusManager& FocusManager::operator=(FocusManager&& temp) noexcept
+	{
+		for (FocusableComponent* component : m_focusList)
+			component->m_focusManager = nullptr;
+
+		m_focusList = std::move(temp.m_focusList);
+		m_focused = temp.m_focused;
+		m_focusRequest = temp.m_focusRequest;
+		temp.m_focusList.clear();
+		temp.m_focused = temp.m_focusRequest = nullptr;
+
+		for (FocusableComponent* component : m_focusList)
+			component->m_focusManager = this;
+
+		return *this;
+	}
+
+	void FocusManager::StepFocus(int step)
+	{
+		const size_t count = m_focusList.size();
+		if (count == 0)
+			return;
+
+		// Start from the focused component, or from just outside the tab order if no component is focused
+		const FocusableComponent* focused = this->GetFocused();
+		size_t index = focused ? focused->m_focusIndex : (step > 0 ? count - 1 : 0);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			index = (index + count + step) % count;
+			if (m_focusList[index]->IsEnabled())
+			{
+				this->SetFocus(m_focusList[index]);
+				return;
+			}
+		}
+	}
+}
\ No newline at end of file
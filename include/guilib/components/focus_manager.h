@@ -0,0 +1,99 @@
+#ifndef FOCUS_MANAGER_H
+#define FOCUS_MANAGER_H
+
+#include <utilities/libexport.h>
+#include <vector>
+
+namespace GUILib
+{
+	class FocusableComponent;
+
+	/**
+	* @brief This is a class that keeps track of the focusable components within an interface frame, and which one of them is focused.
+	* Focusable components are registered once when added to the interface frame, so changing focus only touches the previously and newly
+	* focused components rather than every component. The registration order is also the tab order used to move focus between components.
+	*/
+	class LIB_DECLSPEC FocusManager
+	{
+	public:
+		FocusManager();
+
+		/**
+		* @brief This is the class move contructor method, the registered components are moved over to the new focus manager.
+		* @param[in] temp - A temporary FocusManager object.
+		*/
+		FocusManager(FocusManager&& temp) noexcept;
+
+		FocusManager(const FocusManager&) = delete;
+
+		/**
+		* @brief Unregisters every component still registered with the focus manager.
+		*/
+		~FocusManager();
+
+		/**
+		* @brief Registers a focusable component, placing it at the end of the tab order.
+		* @param[in] component - The component to be registered.
+		*/
+		void Register(FocusableComponent* component);
+
+		/**
+		* @brief Unregisters a focusable component, the component loses focus if it was focused.
+		* @param[in] component - The component to be unregistered.
+		*/
+		void Unregister(FocusableComponent* component);
+
+		/**
+		* @brief Records a focus request from a registered component, the first request during a frame is granted by ApplyFocusRequest().
+		* @param[in] component - The component requesting focus.
+		*/
+		void RequestFocus(FocusableComponent* component);
+
+		/**
+		* @brief Grants the focus request recorded during the current frame (if there is one).
+		*/
+		void ApplyFocusRequest();
+
+		/**
+		* @brief Focuses the specified component, unfocusing the previously focused component.
+		* @param[in] component - The component to be focused, or nullptr to leave no component focused.
+		*/
+		void SetFocus(FocusableComponent* component);
+
+		/**
+		* @brief Moves focus to the next enabled component in the tab order, wrapping around after the last component.
+		*/
+		void FocusNext();
+
+		/**
+		* @brief Moves focus to the previous enabled component in the tab order, wrapping around before the first component.
+		*/
+		void FocusPrevious();
+
+		/**
+		* @brief Returns the focused component.
+		* @return The focused component, or nullptr if no component is focused.
+		*/
+		FocusableComponent* GetFocused() const;
+
+		/**
+		* @brief This is the move assignment overload method, the registered components are moved over to this focus manager.
+		* @param[in] temp - A temporary FocusManager object.
+		* @return A reference to this FocusManager object.
+		*/
+		FocusManager& operator=(FocusManager&& temp) noexcept;
+
+		FocusManager& operator=(const FocusManager&) = delete;
+	private:
+		/**
+		* @brief Moves focus through the tab order by the step given (1 for forwards, -1 for backwards), skipping disabled components.
+		*/
+		void StepFocus(int step);
+	private:
+		std::vector<FocusableComponent*> m_focusList; // The registered components, in tab order
+		FocusableComponent* m_focused;
+		FocusableComponent* m_focusRequest; // The component whose focus request is granted at the end of the frame
+	};
+}
+
+#endif
\ No newline at end of file
@@ -1,11 +1,18 @@
 #include <components/focusable_component.h>
+#include <components/focus_manager.h>
 
 namespace GUILib
 {
 	FocusableComponent::FocusableComponent() :
-		m_isFocused(false), m_requestedFocus(false), m_gainedFocus(false), m_lostFocus(false)
+		m_isFocused(false), m_requestedFocus(false), m_gainedFocus(false), m_lostFocus(false), m_focusManager(nullptr), m_focusIndex(0)
 	{}
 
+	FocusableComponent::~FocusableComponent()
+	{
+		if (m_focusManager)
+			m_focusManager->Unregister(this);
+	}
+
 	void FocusableComponent::SetFocusState(bool state)
 	{
 		if (m_requestedFocus && state)
@@ -16,9 +23,29 @@ namespace GUILib
 		else if (m_isFocused && !state)
 			m_lostFocus = true;
 
+		// The component has to be updated to respond to the change in focus
+		if (m_isFocused != state)
+			this->SetUpdateRequired(true);
+
 		m_isFocused = state;
 	}
 
+	void FocusableComponent::RequestFocus()
+	{
+		m_requestedFocus = true;
+		if (m_focusManager)
+			m_focusManager->RequestFocus(this);
+	}
+
+	void FocusableComponent::ReleaseFocus()
+	{
+		// The focus manager has to be told, so that it doesn't keep on treating the component as focused
+		if (m_focusManager && m_focusManager->GetFocused() == this)
+			m_focusManager->SetFocus(nullptr);
+		else
+			this->SetFocusState(false);
+	}
+
 	void FocusableComponent::ResetActionFocusFlags() { m_gainedFocus = m_lostFocus = false; }
 
 	bool FocusableComponent::IsFocused() const { return m_isFocused; }
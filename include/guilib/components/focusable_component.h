@@ -5,6 +5,8 @@
 
 namespace GUILib
 {
+	class FocusManager;
+
 	/**
 	* @brief This is an pure virtual class representing a base for deriving focusable UI components.
 	*/
@@ -16,10 +18,15 @@ namespace GUILib
 		*/
 		FocusableComponent();
 
-		virtual ~FocusableComponent() = default;
+		/**
+		* @brief Unregisters the component from its focus manager, so a deleted component never stays in the tab order.
+		*/
+		virtual ~FocusableComponent();
 
 		/**
 		* @brief Sets whether or not the component is focused.
+		* This only changes the component's own state, use InterfaceFrame::ForceSetCurrentFocused() to move the interface frame's focus.
+		* 
 		* @param[in] state - The new focus state of the component.
 		*/
 		void SetFocusState(bool state);
@@ -56,12 +63,29 @@ namespace GUILib
 		*/
 		virtual void InitializeComponent() override = 0;
 
+		/**
+		* @brief Requests focus, if the component belongs to an interface frame then the request is granted at the end of the frame (unless
+		* another component has already requested focus during the frame).
+		*/
+		void RequestFocus();
+
+		/**
+		* @brief Gives up focus, if the component is its interface frame's focused component then no component is left focused.
+		*/
+		void ReleaseFocus();
+
 		/**
 		* @brief Resets the gained and lost focus flags back to FALSE.
 		*/
 		void ResetActionFocusFlags();
 	protected:
 		bool m_isFocused, m_requestedFocus, m_gainedFocus, m_lostFocus;
+	private:
+		friend class FocusManager;
+
+		// The focus manager the component is registered with, along with the component's index within its tab order
+		FocusManager* m_focusManager;
+		size_t m_focusIndex;
 	};
 }
 
@@ -1,14 +1,12 @@
 #include <components/icon_button.h>
-#include <graphics/animation.h>
 #include <graphics/buffer_objects.h>
-#include <utilities/input_system.h>
 
 #include <external/glm/glm/gtc/matrix_transform.hpp>
 
 namespace GUILib
 {
 	IconButton::IconButton(const TextureBuffer2D* texture) :
-		m_iconTexture(texture), m_isButtonHeld(false)
+		m_iconTexture(texture)
 	{
 		this->InitializeComponent();
 		
@@ -19,51 +17,21 @@ namespace GUILib
 
 	void IconButton::InitializeComponent()
 	{
-		m_currentColor = m_baseColor = { 1.0f, 1.0f, 1.0f, 1.0f };
-		m_hoverColor = { 1.0f, 1.0f, 0.4f, 1.0f };
-		m_clickedColor = { 1.0f, 1.0f, 0.0f, 1.0f };
+		this->SetColor({ 1.0f, 1.0f, 1.0f, 1.0f }, ComponentEvent::NO_EVENT);
+		this->SetColor({ 1.0f, 1.0f, 0.4f, 1.0f }, ComponentEvent::HOVERED_EVENT);
+		this->SetColor({ 1.0f, 1.0f, 0.0f, 1.0f }, ComponentEvent::CLICKED_EVENT);
 	}
 
 	void IconButton::Update(float deltaTime)
 	{
-		if (this->IsCursorHovering())
-		{
-			if (InputSystem::GetInstance().WasMouseButtonPressed(MouseButtonCode::MOUSE_BUTTON_LEFT))
-			{
-				m_currentColor = m_clickedColor;
-				m_currentBorderColor = m_clickedBorderColor;
-
-				// A button click can span several frames, so prevent the click callback function from being repeatedly called
-				if (m_onClickCallbackFunc && !m_isButtonHeld)
-					m_onClickCallbackFunc();
-
-				m_isButtonHeld = true;
-			}
-			else
-			{
-				if (m_isButtonHeld)
-				{
-					m_currentColor = m_hoverColor;
-					m_currentBorderColor = m_hoverBorderColor;
-				}
-				else
-				{
-					m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_baseColor, m_hoverColor, 8.0f, deltaTime);
-					m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_baseBorderColor, m_hoverBorderColor, 8.0f, deltaTime);
-				}
-
-				m_isButtonHeld = false;
-			}
-		}
-		else
-		{
-			m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_hoverColor, m_baseColor, 8.0f, deltaTime);
-			m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_hoverBorderColor, m_baseBorderColor, 8.0f, deltaTime);
-		}
+		this->ApplyPointerGestures(m_pointerState.Update(deltaTime));
+		this->SetUpdateRequired(m_pointerState.IsUpdateRequired());
 	}
 
 	void IconButton::Render(const Viewport& viewport) const
 	{
+		const VisualStateTable& visualStates = VisualStateTable::GetInstance();
+
 		// Construct the model matrix
 		glm::mat4 modelMatrix = glm::mat4(1.0f);
 		modelMatrix = glm::translate(modelMatrix, { m_position, 0.0f });
@@ -74,7 +42,7 @@ namespace GUILib
 		m_shaders->SetUniform("textureSampler", 0);
 		m_shaders->SetUniform("useTextures", true);
 		m_shaders->SetUniform("enableColorMod", true);
-		m_shaders->SetUniformGLM("color", m_currentColor);
+		visualStates.SetColorUniforms(m_visualState, VisualStateTable::FILL_CHANNEL, *m_shaders);
 		m_shaders->SetUniformGLM("model", modelMatrix);
 		m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
 
@@ -83,5 +51,6 @@ namespace GUILib
 		m_iconTexture->Bind(0);
 
 		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+		visualStates.ResetColorUniforms(m_visualState, *m_shaders);
 	}
 }
\ No newline at end of file
@@ -40,7 +40,6 @@ namespace GUILib
 		void InitializeComponent() override;
 	private:
 		const TextureBuffer2D* m_iconTexture;
-		bool m_isButtonHeld;
 	};
 }
 
@@ -12,9 +12,17 @@ namespace GUILib
 			m_size = { (int)m_textureBuffer->GetWidth(), (int)m_textureBuffer->GetHeight() };
 	}
 
-	void Image::SetPosition(glm::ivec2 pos) { m_position = pos; }
+	void Image::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->MarkChildTransformsDirty();
+	}
 
-	void Image::SetSize(glm::ivec2 size) { m_size = size; }
+	void Image::SetSize(glm::ivec2 size)
+	{
+		m_size = size;
+		this->InvalidateLayout();
+	}
 
 	void Image::InitializeComponent()
 	{
@@ -26,7 +34,10 @@ namespace GUILib
 	{ 
 		m_textureBuffer = texture; 
 		if (texture)
+		{
 			m_size = { (int)m_textureBuffer->GetWidth(), (int)m_textureBuffer->GetHeight() };
+			this->InvalidateLayout();
+		}
 	}
 
 	void Image::Update(float deltaTime) {}
@@ -59,5 +70,14 @@ namespace GUILib
 
 	const glm::ivec2& Image::GetSize() const { return m_size; }
 
+	bool Image::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		size = m_size;
+		anchor = size / 2;
+		return true;
+	}
+
+	void Image::ArrangeLayout(glm::ivec2 size) { this->SetSize(size); }
+
 	const TextureBuffer2D* Image::GetTextureBuffer() const { return m_textureBuffer; }
 }
\ No newline at end of file
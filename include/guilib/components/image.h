@@ -28,7 +28,7 @@ namespace GUILib
 		* @brief Sets the current position of the image component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the current size of the image component.
@@ -60,13 +60,27 @@ namespace GUILib
 		* @brief Returns the current position of the image component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
 
 		/**
 		* @brief Returns the current size of the image component.
 		* @return The size of the component.
 		*/
 		const glm::ivec2& GetSize() const;
+
+		/**
+		* @brief Measures the box which the image occupies when arranged by a layout panel, which is the size of the image.
+		* @param[out] size - The size of the component's box.
+		* @param[out] anchor - The offset of the component's position from the top-left corner of its box.
+		* @return TRUE, as images always occupy a box.
+		*/
+		bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const override;
+
+		/**
+		* @brief Resizes the image to the size of the box given by the layout panel arranging it.
+		* @param[in] size - The new size of the component.
+		*/
+		void ArrangeLayout(glm::ivec2 size) override;
 		
 		/**
 		* @brief Returns the texture assigned to this image component.
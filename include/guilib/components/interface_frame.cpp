@@ -1,61 +1,159 @@
 #include <components/interface_frame.h>
 #include <components/focusable_component.h>
+#include <graphics/tween_manager.h>
 #include <utilities/resource_loader.h>
 #include <utilities/input_system.h>
 #include <external/glad/glad.h>
+#include <algorithm>
 
 namespace GUILib
 {
+	namespace
+	{
+		/**
+		* @brief Builds the key which the ordered components are sorted by, the z-order takes precedence over the sequence number.
+		*/
+		uint64_t GetOrderKey(int zOrder, uint32_t sequence)
+		{
+			// The z-order is biased so that negative z-orders are below positive z-orders when compared as unsigned integers
+			return ((uint64_t)((uint32_t)zOrder ^ 0x80000000u) << 32) | sequence;
+		}
+	}
+
 	InterfaceFrame::InterfaceFrame() :
-		m_bkgColor({ 0.0f, 0.0f, 0.0f, 1.0f }), m_isEnabled(true)
+		m_lastViewportSize(m_viewport.GetSize()), m_bkgColor({ 0.0f, 0.0f, 0.0f, 1.0f }), m_nextOrderSequence(0), m_isEnabled(true),
+		m_lastInputFrame(InputSystem::GetInstance().GetFrameIndex()), m_hoveredComponent(nullptr), m_capturedComponent(nullptr),
+		m_captureButton(MouseButtonCode::MOUSE_BUTTON_LEFT), m_cursorPosition({ 0.0f, 0.0f })
 	{}
 
 	InterfaceFrame::InterfaceFrame(Viewport viewport) :
-		m_viewport(viewport), m_bkgColor({ 0.0f, 0.0f, 0.0f, 1.0f }), m_isEnabled(true)
+		m_viewport(viewport), m_lastViewportSize(viewport.GetSize()), m_bkgColor({ 0.0f, 0.0f, 0.0f, 1.0f }), m_nextOrderSequence(0),
+		m_isEnabled(true), m_lastInputFrame(InputSystem::GetInstance().GetFrameIndex()), m_hoveredComponent(nullptr),
+		m_capturedComponent(nullptr), m_captureButton(MouseButtonCode::MOUSE_BUTTON_LEFT), m_cursorPosition({ 0.0f, 0.0f })
 	{}
 
 	InterfaceFrame::InterfaceFrame(InterfaceFrame&& temp) noexcept :
-		m_viewport(temp.m_viewport), m_bkgColor({ 0.0f, 0.0f, 0.0f, 1.0f }), m_isEnabled(true)
+		m_viewport(temp.m_viewport), m_lastViewportSize(temp.m_viewport.GetSize()), m_bkgColor({ 0.0f, 0.0f, 0.0f, 1.0f }),
+		m_nextOrderSequence(0), m_isEnabled(true), m_lastInputFrame(temp.m_lastInputFrame), m_hoveredComponent(nullptr),
+		m_capturedComponent(nullptr), m_captureButton(MouseButtonCode::MOUSE_BUTTON_LEFT), m_cursorPosition({ 0.0f, 0.0f })
 	{}
 
 	InterfaceFrame::~InterfaceFrame()
 	{ 
-		for (auto& componentPair : m_components)
-			delete componentPair.second;
+		// The focusable components unregister themselves from the focus manager as they're deleted, before the focus manager is destroyed
+		for (const OrderedComponent& ordered : m_orderedComponents)
+			delete ordered.component;
 	}
 
-	void InterfaceFrame::AddComponent(std::string_view id, Component* node)
+	ComponentHandle InterfaceFrame::AddComponent(std::string_view id, Component* node, int zOrder)
 	{
-		// Make sure a shader with the specified ID doesn't exist already
-		if (m_components.find(id.data()) != m_components.end())
+		// Make sure a UI component with the specified ID doesn't exist already
+		const uint32_t nameID = this->InternName(id);
+		if (!node || m_nameSlots[nameID] != ComponentHandle::INVALID_INDEX)
+			return {};
+
+		// Reuse a freed slot if there is one
+		uint32_t slot = (uint32_t)m_slots.size();
+		if (!m_freeSlots.empty())
+		{
+			slot = m_freeSlots.back();
+			m_freeSlots.pop_back();
+		}
+		else
+		{
+			m_slots.push_back({ nullptr, 0, 0, 0 });
+		}
+
+		m_slots[slot].component = node;
+		m_slots[slot].nameID = nameID;
+		m_nameSlots[nameID] = slot;
+
+		// Every component is updated at least once after being added, after which it can choose to only be updated while it is active
+		node->m_frame = this;
+		node->m_isInUpdateList = false;
+		node->SetUpdateRequired(true);
+		node->OnViewportResized(m_viewport);
+
+		// Focusable components are registered with the focus manager once, rather than being looked for every frame
+		if (auto* focusable = dynamic_cast<FocusableComponent*>(node))
+			m_focusManager.Register(focusable);
+
+		// Add interactive UI components to the spatial index, they keep their entry up to date as they move or resize
+		glm::vec2 min, max;
+		if (node->GetInteractionBounds(min, max))
+		{
+			node->m_spatialIndex = &m_spatialIndex;
+			node->m_spatialIndexEntry = m_spatialIndex.Insert(node, min, max);
+			m_spatialIndex.SetActive(node->m_spatialIndexEntry, node->IsEnabled());
+		}
+
+		this->InsertOrdered(slot, zOrder);
+		return { slot, m_slots[slot].generation };
+	}
+
+	void InterfaceFrame::RemoveComponent(std::string_view id) { this->RemoveComponent(this->GetHandle(id)); }
+
+	void InterfaceFrame::RemoveComponent(ComponentHandle handle)
+	{
+		if (!this->GetSlot(handle))
 			return;
 
-		// Add the UI component to the unordered map
-		m_components.insert({ id.data(), node });
+		// Reposition any queued subtrees first, as the removed component's subtree can't be repositioned by this interface frame later on
+		this->UpdateTransforms();
+
+		ComponentSlot& slot = m_slots[handle.index];
+		Component* component = slot.component;
+		if (component->m_spatialIndex == &m_spatialIndex)
+		{
+			m_spatialIndex.Remove(component->m_spatialIndexEntry);
+			component->m_spatialIndex = nullptr;
+			component->m_spatialIndexEntry = SpatialIndex::INVALID_ENTRY;
+		}
+
+		if (component->m_frame == this)
+		{
+			if (component->m_isInUpdateList)
+				m_updateList.erase(std::find(m_updateList.begin(), m_updateList.end(), component));
+
+			component->m_frame = nullptr;
+			component->m_isInUpdateList = false;
+		}
+
+		// Make sure no events are dispatched to the removed component
+		if (m_hoveredComponent == component)
+			m_hoveredComponent = nullptr;
+		if (m_capturedComponent == component)
+			m_capturedComponent = nullptr;
+
+		if (auto* focusable = dynamic_cast<FocusableComponent*>(component))
+			m_focusManager.Unregister(focusable);
+
+		// Free the slot, bumping its generation invalidates every handle to the removed component
+		this->EraseOrdered(slot.orderIndex);
+		m_nameSlots[slot.nameID] = ComponentHandle::INVALID_INDEX;
+		slot.component = nullptr;
+		slot.generation++;
+		m_freeSlots.emplace_back(handle.index);
 	}
 
-	void InterfaceFrame::RemoveComponent(std::string_view id)
+	void InterfaceFrame::SetZOrder(ComponentHandle handle, int zOrder)
 	{
-		auto iterator = m_components.find(id.data());
-		if (iterator != m_components.end())
-			m_components.erase(iterator);
+		if (!this->GetSlot(handle))
+			return;
+
+		this->EraseOrdered(m_slots[handle.index].orderIndex);
+		this->InsertOrdered(handle.index, zOrder);
 	}
 
 	void InterfaceFrame::SetEnabled(bool enabled) { m_isEnabled = enabled; }
 
 	void InterfaceFrame::SetBackgroundColor(glm::vec4 color) { m_bkgColor = color; }
 
-	void InterfaceFrame::ForceSetCurrentFocused(FocusableComponent* component)
-	{
-		component->SetFocusState(true);
+	void InterfaceFrame::ForceSetCurrentFocused(FocusableComponent* component) { m_focusManager.SetFocus(component); }
 
-		for (auto& componentPair : m_components)
-		{
-			auto* focusable = dynamic_cast<FocusableComponent*>(componentPair.second);
-			if (focusable && focusable != component)
-				focusable->SetFocusState(false);
-		}
-	}
+	void InterfaceFrame::FocusNext() { m_focusManager.FocusNext(); }
+
+	void InterfaceFrame::FocusPrevious() { m_focusManager.FocusPrevious(); }
 
 	void InterfaceFrame::Update()
 	{
@@ -63,43 +161,176 @@ namespace GUILib
 		m_deltaTimeClock.Reset();
 		m_viewport.Update();
 
+		// Every interface frame updated during a loop dispatches the same input frame, a new one is started when this interface frame has
+		// already dispatched it, when new events were received since it started (the window's events were polled again), or when this
+		// interface frame didn't dispatch the previous input frame (e.g. it has just been switched to), so no events are dispatched twice
+		InputSystem& inputSystem = InputSystem::GetInstance();
+		if (m_lastInputFrame + 1 != inputSystem.GetFrameIndex() || inputSystem.HasQueuedEvents())
+			inputSystem.NewFrame();
+
+		m_lastInputFrame = inputSystem.GetFrameIndex();
+
 		if (m_isEnabled)
 		{
-			FocusableComponent* focusChanged = nullptr; // The component which has gained focus
-			for (auto& componentPair : m_components)
+			this->CheckViewportResized();
+			this->UpdateTransforms();
+			this->DispatchInputEvents();
+
+			// Only the components which require updating are updated, components can be added to the update list during the loop (e.g. when
+			// they are woken by another component), so it is iterated by index and compacted as it goes
+			size_t keptCount = 0;
+			for (size_t i = 0; i < m_updateList.size(); i++)
 			{
-				// Update each component in the scene
-				if (componentPair.second && componentPair.second->IsEnabled())
-					componentPair.second->Update(deltaTime);
+				Component* component = m_updateList[i];
+				if (component->IsEnabled())
+					component->Update(deltaTime);
 
-				// Check if a focusable component is requesting focus (if one hasn't already)
-				if (!focusChanged)
-				{
-					if (auto* focusable = dynamic_cast<FocusableComponent*>(componentPair.second))
-					{
-						if (focusable->HasRequestedFocus())
-						{
-							// Set the focusable component's state to focused
-							focusable->SetFocusState(true);
-							focusChanged = focusable;
-						}
-					}
-				}
+				if (component->IsUpdateRequired())
+					m_updateList[keptCount++] = component;
+				else
+					component->m_isInUpdateList = false;
 			}
 
-			// If focus has been attained by a focusable component, then set all the other focusable components states to unfocused.
-			if (focusChanged)
+			m_updateList.resize(keptCount);
+
+			// Grant the first focus request made by a component during the update, which unfocuses the previously focused component
+			m_focusManager.ApplyFocusRequest();
+
+			// Advance the running animations (shared by every interface frame) in a single batch, such as the components' color transitions
+			TweenManager::GetInstance().Update();
+
+			// Reposition the subtrees of the components which moved during the update, before they're rendered
+			this->UpdateTransforms();
+		}
+	}
+
+	void InterfaceFrame::DispatchInputEvents()
+	{
+		// The components are laid out in the viewport's coordinates, so the cursor is mapped to them once here and handed down in events
+		InputSystem& inputSystem = InputSystem::GetInstance();
+		const InputSnapshot& snapshot = inputSystem.GetSnapshot();
+
+		for (const InputEvent& event : inputSystem.GetEvents())
+		{
+			switch (event.type)
+			{
+			case InputEventType::MOUSE_MOVED:
+				m_cursorPosition = snapshot.MapToViewport(event.cursorPosition, m_viewport);
+				this->SetHoveredComponent(m_spatialIndex.QueryTopmost(m_cursorPosition), m_cursorPosition);
+				this->DispatchEvent(UIEventType::POINTER_MOVE, m_capturedComponent ? m_capturedComponent : m_hoveredComponent,
+					m_cursorPosition, &event);
+				break;
+			case InputEventType::MOUSE_BUTTON_DOWN:
 			{
-				for (auto& componentPair : m_components)
+				// Pressing anywhere outside of the focused component (and its children) unfocuses it
+				const FocusableComponent* focused = m_focusManager.GetFocused();
+				Component* pressedComponent = m_hoveredComponent;
+				while (pressedComponent && pressedComponent != focused)
+					pressedComponent = pressedComponent->GetParent();
+
+				if (focused && !pressedComponent)
+					m_focusManager.SetFocus(nullptr);
+
+				// The pressed component captures the pointer, so it receives the button's release even if the cursor has left it
+				if (!m_capturedComponent)
+				{
+					m_capturedComponent = m_hoveredComponent;
+					m_captureButton = event.button;
+				}
+
+				this->DispatchEvent(UIEventType::POINTER_DOWN, m_hoveredComponent, m_cursorPosition, &event);
+				break;
+			}
+			case InputEventType::MOUSE_BUTTON_UP:
+				// Releasing any other button (pressed while the pointer was captured) leaves the capture in place
+				if (m_capturedComponent && event.button == m_captureButton)
+				{
+					Component* capturedComponent = m_capturedComponent;
+					m_capturedComponent = nullptr;
+					this->DispatchEvent(UIEventType::POINTER_UP, capturedComponent, m_cursorPosition, &event);
+				}
+				else
 				{
-					if (auto* focusable = dynamic_cast<FocusableComponent*>(componentPair.second))
-					{
-						if (focusable != focusChanged)
-							focusable->SetFocusState(false);
-					}
+					this->DispatchEvent(UIEventType::POINTER_UP, m_hoveredComponent, m_cursorPosition, &event);
 				}
+				break;
+			case InputEventType::MOUSE_SCROLLED:
+				this->DispatchEvent(UIEventType::POINTER_SCROLL, m_hoveredComponent, m_cursorPosition, &event);
+				break;
+			case InputEventType::KEY_DOWN:
+				// The tab key moves focus through the tab order, unless the focused component handles the key itself
+				if (!this->DispatchEvent(UIEventType::KEY_DOWN, m_focusManager.GetFocused(), m_cursorPosition, &event) &&
+					event.key == KeyCode::KEY_TAB)
+				{
+					if (event.modifiers & KeyModifier::SHIFT)
+						m_focusManager.FocusPrevious();
+					else
+						m_focusManager.FocusNext();
+				}
+				break;
+			case InputEventType::KEY_UP:
+				this->DispatchEvent(UIEventType::KEY_UP, m_focusManager.GetFocused(), m_cursorPosition, &event);
+				break;
+			case InputEventType::CHARACTER:
+				this->DispatchEvent(UIEventType::CHARACTER, m_focusManager.GetFocused(), m_cursorPosition, &event);
+				break;
 			}
 		}
+
+		// Components can move or be enabled/disabled under a still cursor, so the hovered component is looked up again once per frame
+		m_cursorPosition = snapshot.GetCursorPosition(&m_viewport);
+		this->SetHoveredComponent(m_spatialIndex.QueryTopmost(m_cursorPosition), m_cursorPosition);
+	}
+
+	bool InterfaceFrame::DispatchEvent(UIEventType type, Component* target, glm::vec2 cursorPosition, const InputEvent* input)
+	{
+		const UIEvent event = { type, target, cursorPosition, input };
+		for (Component* component = target; component; component = component->GetParent())
+		{
+			if (component->IsEnabled() && component->HandleEvent(event))
+				return true;
+		}
+
+		return false;
+	}
+
+	void InterfaceFrame::UpdateTransforms()
+	{
+		// Repositioning a subtree can queue other components, so the queue is iterated by index
+		for (size_t i = 0; i < m_transformUpdateList.size(); i++)
+		{
+			Component* component = m_transformUpdateList[i];
+			component->m_transformQueueFrame = nullptr;
+
+			// A component which is out of date itself is repositioned along with its children by one of its queued ancestors
+			if (!component->m_isTransformDirty)
+				component->UpdateChildTransforms();
+		}
+
+		m_transformUpdateList.clear();
+	}
+
+	void InterfaceFrame::CheckViewportResized()
+	{
+		if (m_viewport.GetSize() == m_lastViewportSize)
+			return;
+
+		// Layout panels only mark themselves as out of date here, they are laid out once during the update that follows
+		m_lastViewportSize = m_viewport.GetSize();
+		for (const OrderedComponent& ordered : m_orderedComponents)
+			ordered.component->OnViewportResized(m_viewport);
+	}
+
+	void InterfaceFrame::SetHoveredComponent(Component* hovered, glm::vec2 cursorPosition)
+	{
+		if (hovered == m_hoveredComponent)
+			return;
+
+		Component* previousHovered = m_hoveredComponent;
+		m_hoveredComponent = hovered;
+
+		this->DispatchEvent(UIEventType::POINTER_LEAVE, previousHovered, cursorPosition, nullptr);
+		this->DispatchEvent(UIEventType::POINTER_ENTER, hovered, cursorPosition, nullptr);
 	}
 
 	void InterfaceFrame::Render() const 
@@ -110,31 +341,72 @@ namespace GUILib
 			glClearColor(m_bkgColor.r, m_bkgColor.g, m_bkgColor.b, m_bkgColor.a);
 			glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
-			// Render all the UI components
-			for (const auto& componentPair : m_components)
+			// Set the time which the components' color animations are evaluated against by the geometry shader, once per frame
+			const ShaderProgram* geometryShaders = ResourceLoader::GetInstance().GetShaders("Geometry");
+			geometryShaders->Bind();
+			geometryShaders->SetUniform("time", TweenManager::GetInstance().GetTime());
+
+			// Render all the UI components, from the bottommost to the topmost, skipping those entirely outside of the viewport (along with
+			// their children)
+			const glm::vec2 viewportSize = m_viewport.GetSize();
+			for (const OrderedComponent& ordered : m_orderedComponents)
 			{
-				if (componentPair.second && componentPair.second->IsEnabled())
-					componentPair.second->Render(m_viewport);
+				if (!ordered.component->IsEnabled())
+					continue;
+
+				glm::vec2 min, max;
+				if (ordered.component->GetRenderBounds(min, max) &&
+					(max.x < 0.0f || max.y < 0.0f || min.x > viewportSize.x || min.y > viewportSize.y))
+					continue;
+
+				ordered.component->Render(m_viewport);
 			}
 		}
 	}
 
-	Component* InterfaceFrame::GetComponent(std::string_view id)
+	Component* InterfaceFrame::GetComponent(std::string_view id) { return this->GetComponent(this->GetHandle(id)); }
+
+	const Component* InterfaceFrame::GetComponent(std::string_view id) const { return this->GetComponent(this->GetHandle(id)); }
+
+	Component* InterfaceFrame::GetComponent(ComponentHandle handle)
 	{
-		auto iterator = m_components.find(id.data());
-		if (iterator != m_components.end())
-			return iterator->second;
+		const ComponentSlot* slot = this->GetSlot(handle);
+		return slot ? slot->component : nullptr;
+	}
 
-		return nullptr;
+	const Component* InterfaceFrame::GetComponent(ComponentHandle handle) const
+	{
+		const ComponentSlot* slot = this->GetSlot(handle);
+		return slot ? slot->component : nullptr;
 	}
 
-	const Component* InterfaceFrame::GetComponent(std::string_view id) const
+	ComponentHandle InterfaceFrame::GetHandle(std::string_view id) const
 	{
-		auto iterator = m_components.find(id.data());
-		if (iterator != m_components.end())
-			return iterator->second;
+		auto iterator = m_nameIDs.find(id);
+		if (iterator == m_nameIDs.end())
+			return {};
+
+		const uint32_t slot = m_nameSlots[iterator->second];
+		if (slot == ComponentHandle::INVALID_INDEX)
+			return {};
 
-		return nullptr;
+		return { slot, m_slots[slot].generation };
+	}
+
+	int InterfaceFrame::GetZOrder(ComponentHandle handle) const
+	{
+		const ComponentSlot* slot = this->GetSlot(handle);
+		if (!slot)
+			return 0;
+
+		return (int)((uint32_t)(m_orderedComponents[slot->orderIndex].orderKey >> 32) ^ 0x80000000u);
+	}
+
+	Component* InterfaceFrame::GetComponentAt(glm::vec2 point) const { return m_spatialIndex.QueryTopmost(point); }
+
+	void InterfaceFrame::GetComponentsInRegion(glm::vec2 min, glm::vec2 max, std::vector<Component*>& components) const
+	{
+		m_spatialIndex.QueryRegion(min, max, components);
 	}
 
 	const glm::vec4& InterfaceFrame::GetBackgroundColor() const { return m_bkgColor; }
@@ -146,8 +418,96 @@ namespace GUILib
 	const InterfaceFrame& InterfaceFrame::operator=(InterfaceFrame&& temp) noexcept
 	{
 		m_viewport = temp.m_viewport;
-		m_components = temp.m_components;
-		temp.m_components.clear();
+		m_lastViewportSize = temp.m_lastViewportSize;
+		m_slots = std::move(temp.m_slots);
+		m_freeSlots = std::move(temp.m_freeSlots);
+		m_orderedComponents = std::move(temp.m_orderedComponents);
+		m_nextOrderSequence = temp.m_nextOrderSequence;
+		m_names = std::move(temp.m_names);
+		m_nameIDs = std::move(temp.m_nameIDs);
+		m_nameSlots = std::move(temp.m_nameSlots);
+		m_spatialIndex = std::move(temp.m_spatialIndex);
+		temp.m_slots.clear();
+		temp.m_freeSlots.clear();
+		temp.m_orderedComponents.clear();
+		temp.m_names.clear();
+		temp.m_nameIDs.clear();
+		temp.m_nameSlots.clear();
+		temp.m_spatialIndex.Clear();
+
+		m_updateList = std::move(temp.m_updateList);
+		m_transformUpdateList = std::move(temp.m_transformUpdateList);
+		temp.m_transformUpdateList.clear();
+		for (Component* component : m_transformUpdateList)
+			component->m_transformQueueFrame = this;
+
+		m_lastInputFrame = temp.m_lastInputFrame;
+		m_hoveredComponent = temp.m_hoveredComponent;
+		m_capturedComponent = temp.m_capturedComponent;
+		m_captureButton = temp.m_captureButton;
+		m_focusManager = std::move(temp.m_focusManager);
+		m_cursorPosition = temp.m_cursorPosition;
+		temp.m_updateList.clear();
+		temp.m_hoveredComponent = temp.m_capturedComponent = nullptr;
+
+		// The moved components now belong to this interface frame and its spatial index
+		for (const OrderedComponent& ordered : m_orderedComponents)
+		{
+			ordered.component->m_frame = this;
+			if (ordered.component->m_spatialIndex)
+				ordered.component->m_spatialIndex = &m_spatialIndex;
+		}
+
 		return *this;
 	}
+
+	const InterfaceFrame::ComponentSlot* InterfaceFrame::GetSlot(ComponentHandle handle) const
+	{
+		if (handle.index >= m_slots.size())
+			return nullptr;
+
+		const ComponentSlot& slot = m_slots[handle.index];
+		return slot.component && slot.generation == handle.generation ? &slot : nullptr;
+	}
+
+	uint32_t InterfaceFrame::InternName(std::string_view name)
+	{
+		auto iterator = m_nameIDs.find(name);
+		if (iterator != m_nameIDs.end())
+			return iterator->second;
+
+		// The lookup table's key refers to the stored copy of the name, rather than the name given
+		const uint32_t nameID = (uint32_t)m_names.size();
+		m_names.emplace_back(name);
+		m_nameIDs.insert({ m_names.back(), nameID });
+		m_nameSlots.emplace_back(ComponentHandle::INVALID_INDEX);
+		return nameID;
+	}
+
+	void InterfaceFrame::InsertOrdered(uint32_t slot, int zOrder)
+	{
+		// The sequence number places the component above every component with the same z-order
+		const uint64_t orderKey = GetOrderKey(zOrder, m_nextOrderSequence++);
+		auto iterator = std::upper_bound(m_orderedComponents.begin(), m_orderedComponents.end(), orderKey,
+			[](uint64_t key, const OrderedComponent& ordered) { return key < ordered.orderKey; });
+
+		const uint32_t orderIndex = (uint32_t)(iterator - m_orderedComponents.begin());
+		Component* component = m_slots[slot].component;
+		m_orderedComponents.insert(iterator, { component, orderKey, slot });
+
+		// Only the components above the inserted one have moved within the array
+		for (size_t i = orderIndex; i < m_orderedComponents.size(); i++)
+			m_slots[m_orderedComponents[i].slot].orderIndex = (uint32_t)i;
+
+		// Hit testing follows the same order as rendering
+		if (component->m_spatialIndex == &m_spatialIndex)
+			m_spatialIndex.SetOrder(component->m_spatialIndexEntry, orderKey);
+	}
+
+	void InterfaceFrame::EraseOrdered(uint32_t orderIndex)
+	{
+		m_orderedComponents.erase(m_orderedComponents.begin() + orderIndex);
+		for (size_t i = orderIndex; i < m_orderedComponents.size(); i++)
+			m_slots[m_orderedComponents[i].slot].orderIndex = (uint32_t)i;
+	}
 }
@@ -3,14 +3,39 @@
 
 #include <graphics/viewport.h>
 #include <components/focusable_component.h>
+#include <components/focus_manager.h>
 #include <utilities/timer.h>
+#include <utilities/spatial_index.h>
+#include <cstdint>
+#include <deque>
 #include <unordered_map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 typedef void* (*GLADloadproc)(const char* name);
 
 namespace GUILib
 {
+	/**
+	* @brief A handle identifying a UI component within an interface frame.
+	* Handles stay valid while the component remains in the interface frame, once it is removed the handle no longer refers to anything, even
+	* if its storage slot is reused by a component added later.
+	*/
+	struct ComponentHandle
+	{
+		static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+		uint32_t index = INVALID_INDEX; // The storage slot of the component
+		uint32_t generation = 0; // The generation of the slot when the component was added
+
+		bool IsValid() const { return index != INVALID_INDEX; }
+
+		bool operator==(const ComponentHandle& other) const { return index == other.index && generation == other.generation; }
+
+		bool operator!=(const ComponentHandle& other) const { return !(*this == other); }
+	};
+
 	/* 
 	* @brief This is a class that represents the root of the user interface, it contains and manages all the user interface elements inside of it.
 	* Also, make sure that whenever you are using this class you are always allocating it on the heap, not the stack.
@@ -45,11 +70,15 @@ namespace GUILib
 
 		/**
 		* @brief Adds UI component to the interface frame.
+		* Components are rendered from the lowest to the highest z-order, and components with the same z-order are rendered in the order they
+		* were added. Components rendered later are above those rendered earlier, also when hit testing.
 		* 
 		* @param[in] id - The ID to be assigned to the newly added UI component.
 		* @param[in] node - The UI component to be added to the interface frame.
+		* @param[in] zOrder - The z-order of the UI component.
+		* @return The handle of the added UI component, this is invalid if the ID is already in use or the UI component is nullptr.
 		*/
-		void AddComponent(std::string_view id, Component* node);
+		ComponentHandle AddComponent(std::string_view id, Component* node, int zOrder = 0);
 
 		/**
 		* @brief Removes the specified UI component in the interface frame.
@@ -57,6 +86,21 @@ namespace GUILib
 		*/
 		void RemoveComponent(std::string_view id);
 
+		/**
+		* @brief Removes the specified UI component in the interface frame.
+		* @param[in] handle - The handle of the UI component to be removed.
+		*/
+		void RemoveComponent(ComponentHandle handle);
+
+		/**
+		* @brief Sets the z-order of the specified UI component.
+		* The component is placed above every other component with the same z-order.
+		*
+		* @param[in] handle - The handle of the UI component.
+		* @param[in] zOrder - The new z-order of the UI component.
+		*/
+		void SetZOrder(ComponentHandle handle, int zOrder);
+
 		/** 
 		* @brief Sets whether or not the interface frame is enabled.
 		* If disabled, then it will not be updated and rendered.
@@ -78,9 +122,23 @@ namespace GUILib
 		* @param[in] component - The component to be set as focused.
 		*/
 		void ForceSetCurrentFocused(FocusableComponent* component);
+
+		/**
+		* @brief Moves focus to the next enabled focusable component, in the order the focusable components were added.
+		* This is also done when the tab key is pressed, and the focused component doesn't handle it.
+		*/
+		void FocusNext();
+
+		/**
+		* @brief Moves focus to the previous enabled focusable component, in the order the focusable components were added.
+		* This is also done when the tab key is pressed while holding shift, and the focused component doesn't handle it.
+		*/
+		void FocusPrevious();
 			
 		/**
 		* @brief Updates the viewport and every enabled user interface component within the interface frame.
+		* The input events are drained once per loop automatically (see InputSystem::NewFrame()), even when several interface frames are
+		* updated each loop, so each event is dispatched once to every interface frame which is updated.
 		*/
 		void Update();
 
@@ -107,6 +165,56 @@ namespace GUILib
 		*/
 		const Component* GetComponent(std::string_view id) const;
 
+		/**
+		* @brief Returns the specified UI component.
+		*
+		* @param[in] handle - The handle of the UI component to be looked up.
+		* @return A pointer to the UI component, or nullptr if the handle is invalid or the UI component has been removed.
+		*/
+		Component* GetComponent(ComponentHandle handle);
+
+		/**
+		* @brief Returns the specified UI component.
+		*
+		* @param[in] handle - The handle of the UI component to be looked up.
+		* @return A pointer to the UI component, or nullptr if the handle is invalid or the UI component has been removed.
+		*/
+		const Component* GetComponent(ComponentHandle handle) const;
+
+		/**
+		* @brief Returns the handle of the specified UI component.
+		*
+		* @param[in] id - The ID of the UI component to be looked up.
+		* @return The handle of the UI component, or an invalid handle if the UI component specified doesn't exist.
+		*/
+		ComponentHandle GetHandle(std::string_view id) const;
+
+		/**
+		* @brief Returns the z-order of the specified UI component.
+		*
+		* @param[in] handle - The handle of the UI component.
+		* @return The z-order of the UI component, or 0 if the handle is invalid.
+		*/
+		int GetZOrder(ComponentHandle handle) const;
+
+		/**
+		* @brief Returns the topmost interactive UI component at the point given.
+		* Components added later are above those added earlier.
+		*
+		* @param[in] point - The point to be looked up.
+		* @return A pointer to the topmost enabled UI component whose bounds contain the point, or nullptr if there isn't one.
+		*/
+		Component* GetComponentAt(glm::vec2 point) const;
+
+		/**
+		* @brief Finds every interactive UI component whose bounds overlap the region given.
+		*
+		* @param[in] min - The top-left corner of the region.
+		* @param[in] max - The bottom-right corner of the region.
+		* @param[out] components - The enabled UI components found are appended onto this, from the bottommost to the topmost.
+		*/
+		void GetComponentsInRegion(glm::vec2 min, glm::vec2 max, std::vector<Component*>& components) const;
+
 		/**
 		* @brief Returns the background color of the user interface.
 		* @return The color of the UI background.
@@ -133,13 +241,120 @@ namespace GUILib
 		const InterfaceFrame& operator=(InterfaceFrame&& temp) noexcept;
 
 		const InterfaceFrame& operator=(const InterfaceFrame&) = delete;
+	private:
+		friend class Component;
+
+		/**
+		* @brief A struct describing a storage slot of the slot map which holds the UI components.
+		*/
+		struct ComponentSlot
+		{
+			Component* component; // The UI component, this is nullptr if the slot is unused
+			uint32_t generation; // Incremented whenever the slot is freed, so that handles to the removed component become stale
+			uint32_t nameID; // The interned ID of the component's name
+			uint32_t orderIndex; // The index of the component within the ordered component array
+		};
+
+		/**
+		* @brief A struct describing a UI component within the array of UI components, which is kept sorted from the bottommost to the topmost.
+		*/
+		struct OrderedComponent
+		{
+			Component* component;
+			uint64_t orderKey; // The biased z-order in the upper 32 bits, and the sequence number of when it was ordered in the lower 32 bits
+			uint32_t slot;
+		};
+
+		/**
+		* @brief Returns the slot of the component identified by the handle given, or nullptr if the handle is invalid or stale.
+		*/
+		const ComponentSlot* GetSlot(ComponentHandle handle) const;
+
+		/**
+		* @brief Returns the interned ID of the name given, interning the name if it hasn't been already.
+		*/
+		uint32_t InternName(std::string_view name);
+
+		/**
+		* @brief Inserts the component in the specified slot into the ordered component array, above every component with the same z-order.
+		*/
+		void InsertOrdered(uint32_t slot, int zOrder);
+
+		/**
+		* @brief Removes the component at the specified index from the ordered component array.
+		*/
+		void EraseOrdered(uint32_t orderIndex);
+
+		/**
+		* @brief Dispatches the current frame's input events, pointer events go to the component under the cursor (or the component which has
+		* captured the pointer) and keyboard events go to the focused component.
+		*/
+		void DispatchInputEvents();
+
+		/**
+		* @brief Dispatches an event to the target component, then bubbles it up through the target's parents until it is handled.
+		*
+		* @param[in] type - The type of the event.
+		* @param[in] target - The component the event is dispatched to, nothing happens if this is nullptr.
+		* @param[in] cursorPosition - The cursor position when the event occurred.
+		* @param[in] input - The input event which caused the event, or nullptr if there isn't one.
+		* @return TRUE if the event was handled by the target or one of its parents, FALSE otherwise.
+		*/
+		bool DispatchEvent(UIEventType type, Component* target, glm::vec2 cursorPosition, const InputEvent* input);
+
+		/**
+		* @brief Repositions the children of every component which has been queued since the last time, each out of date subtree is only
+		* repositioned once no matter how many times it moved.
+		*/
+		void UpdateTransforms();
+
+		/**
+		* @brief Notifies every UI component if the viewport has been resized since the last update, so that components which depend on the
+		* viewport's size (e.g. layout panels which fill the viewport) can adapt to it.
+		*/
+		void CheckViewportResized();
+
+		/**
+		* @brief Changes the component under the cursor, dispatching pointer leave and enter events if it has changed.
+		*
+		* @param[in] hovered - The component now under the cursor.
+		* @param[in] cursorPosition - The current cursor position.
+		*/
+		void SetHoveredComponent(Component* hovered, glm::vec2 cursorPosition);
 	private:
 		Viewport m_viewport;
+		glm::ivec2 m_lastViewportSize; // The size of the viewport when the UI components were last notified of it
 		glm::vec4 m_bkgColor;
-		std::unordered_map<std::string, Component*> m_components;
+
+		// The UI components are stored in a slot map, handles refer to a slot and the slot's generation, and freed slots are reused
+		std::vector<ComponentSlot> m_slots;
+		std::vector<uint32_t> m_freeSlots;
+		std::vector<OrderedComponent> m_orderedComponents; // Iterated when rendering, from the bottommost to the topmost
+		uint32_t m_nextOrderSequence;
+
+		// Each distinct name is stored once, the lookup table refers to the stored names (whose addresses never change within the deque) so
+		// that looking up a name doesn't allocate a string
+		std::deque<std::string> m_names;
+		std::unordered_map<std::string_view, uint32_t> m_nameIDs;
+		std::vector<uint32_t> m_nameSlots; // The slot of the component with each name, or ComponentHandle::INVALID_INDEX
+
+		SpatialIndex m_spatialIndex; // Indexes the bounds of the interactive UI components, for hit testing
+		std::vector<Component*> m_updateList; // The UI components which require updating, refer to Component::SetUpdateRequired()
+		std::vector<Component*> m_transformUpdateList; // The components whose children are queued to be repositioned
 		Timer m_deltaTimeClock;
 
 		bool m_isEnabled;
+
+		uint64_t m_lastInputFrame; // The input frame which this interface frame last dispatched the events of
+
+		// The component under the cursor, and the component which has captured the pointer (from a mouse button press until the same
+		// button's release) along with the button which captured it
+		Component* m_hoveredComponent;
+		Component* m_capturedComponent;
+		MouseButtonCode m_captureButton;
+		glm::vec2 m_cursorPosition;
+
+		FocusManager m_focusManager; // Tracks the focused component, which receives the keyboard events
 	};
 }
 
@@ -1,78 +1,229 @@
 #include <components/label.h>
+#include <graphics/text_layout_cache.h>
+#include <utilities/utf8.h>
 #include <external/glm/glm/gtc/matrix_transform.hpp>
+#include <iterator>
+#include <algorithm>
+#include <cmath>
 
 namespace GUILib
 {
 	Label::Label(std::string_view text, glm::vec4 color, const Font* font, float fontSize) :
-		m_font(font), m_text(text), m_position({ 0, 0 }), m_textColor(color), m_fontSize(fontSize), m_shouldUpdate(UpdateFlags::NONE),
-		m_textLengthChanged(true)
+		m_position({ 0, 0 }), m_textColor(color), m_text(text), m_codepoints(DecodeUTF8(text)), m_font(font), m_fontSize(fontSize),
+		m_maxWidth(0), m_textAlignment(TextAlignment::LEFT), m_lineSpacing(1.0f), m_lineBreakFont(nullptr), m_lineBreakFontSize(0.0f),
+		m_sdfShaders(nullptr), m_atlasGeneration(0), m_pixelSize(0), m_glyphCapacity(0), m_firstChangedGlyph(std::u32string::npos),
+		m_shouldUpdate(UpdateFlags::NONE), m_isEdited(false), m_editLayoutValid(false)
 	{
 		this->InitializeComponent();
 		this->GenerateTextGeometry();
 		m_size = this->CalculateTextSize();
 	}
 
-	void Label::InitializeComponent() { m_shaders = ResourceLoader::GetInstance().GetShaders("Text"); }
+	void Label::InitializeComponent() 
+	{ 
+		m_shaders = ResourceLoader::GetInstance().GetShaders("Text");
+		m_sdfShaders = ResourceLoader::GetInstance().GetShaders("TextSDF");
+	}
 
 	void Label::GenerateTextGeometry()
 	{
-		if (m_font && m_fontSize > 0 && !m_text.empty())
+		m_drawRuns.clear();
+		m_editLayoutValid = false;
+
+		if (m_font && m_fontSize > 0)
 		{
-			// If the text length remains the same, we can just reuse the allocated vertex buffer
-			// However, if the length of the text has changed, then we have to delete and reallocate a new vertex buffer
-			if (m_textLengthChanged)
+			m_pixelSize = m_font->GetNearestPixelSize(m_fontSize);
+
+			// Single-line text of edited labels is laid out by the label itself (rather than shared through the layout cache), so that
+			// further edits only have to lay out the glyphs after the edit
+			if (m_isEdited && m_maxWidth <= 0 && m_text.find('\n') == std::string::npos)
 			{
-				if (m_geometry.vbo) // Delete the vertex buffer (if existing)
-					delete m_geometry.vbo;
+				TextLayoutCache::LayoutText(*m_font, m_fontSize, m_codepoints, m_editLayout);
+				m_editLayoutValid = true;
+			}
+
+			// Wrap the text into lines, then measure it so that the lines can be aligned within the label's width
+			m_size = m_editLayoutValid ? m_editLayout.size : this->CalculateTextSize();
 
-				// Allocate new vertex buffer
-				m_geometry.vbo = new VertexBuffer(nullptr, m_text.size() * sizeof(float) * 24, GL_DYNAMIC_DRAW);
+			if (!m_codepoints.empty())
+			{
+				this->ReserveGlyphCapacity(m_codepoints.size());
+				this->GenerateGlyphGeometry();
+			}
+		}
 
-				// Create new vertex array (if not existing already), then setup vertex attributes and attach vertex buffer 
-				if (!m_geometry.vao)
-					m_geometry.vao = new VertexArray();
+		m_atlasGeneration = m_font ? m_font->GetAtlasGeneration() : 0;
+	}
 
-				m_geometry.vao->PushLayout(0, 2, 4 * sizeof(float));
-				m_geometry.vao->PushLayout(1, 2, 4 * sizeof(float), 2 * sizeof(float));
-				m_geometry.vao->AttachBuffers(*m_geometry.vbo);
+	void Label::GenerateGlyphGeometry() const
+	{
+		const float lineAdvance = m_font->GetLineHeight(m_pixelSize) * (m_fontSize / (float)m_pixelSize) * m_lineSpacing;
 
-				m_textLengthChanged = false;
-			}
+		std::vector<float> vertexData;
+		vertexData.reserve(m_codepoints.size() * 24);
 
-			glm::vec2 cursorPos = glm::vec2(0.0f);
-			for (size_t i = 0; i < m_text.size(); i++)
+		// Rasterizing a glyph may evict glyphs looked up earlier, in which case the geometry is generated again (once)
+		for (int attempt = 0; attempt < 2; attempt++)
+		{
+			const uint32_t atlasGeneration = m_font->GetAtlasGeneration();
+			vertexData.clear();
+			m_drawRuns.clear();
+
+			if (m_editLayoutValid)
+			{
+				this->GenerateLineGeometry(m_editLayout, 0, { 0.0f, 0.0f }, (float)m_size.x, 0, vertexData);
+			}
+			else
 			{
-				const Font::GlyphMetrics& glyph = m_font->GetGlyph(m_text[i]); // Get the glyph metrics for the character
-				const glm::vec2 atlasSize = { (float)m_font->GetTextureAtlas()->GetWidth(), (float)m_font->GetTextureAtlas()->GetHeight() };
+				float lineOffset = 0.0f;
+				for (const Paragraph& paragraph : m_paragraphs)
+				{
+					for (const std::string& line : paragraph.lines)
+					{
+						// Get the layout of the line, which is shared with any other text using the same font, font size and string
+						if (!line.empty())
+						{
+							const TextLayout& layout = TextLayoutCache::GetInstance().GetLayout(*m_font, m_fontSize, line);
+							this->GenerateLineGeometry(layout, 0, { 0.0f, lineOffset }, (float)m_size.x, 0, vertexData);
+						}
+
+						lineOffset += lineAdvance;
+					}
+				}
+			}
 
-				// Calculate the position and size of the glyph
-				int bearingX = i > 0 ? glyph.bearing.x : 0; // Don't add horizontal bearing on first glyph position
+			if (m_font->GetAtlasGeneration() == atlasGeneration)
+				break;
+		}
 
-				const float scale = m_fontSize / 64.0f;
-				const glm::vec2 glyphPos = { cursorPos.x + bearingX * scale, cursorPos.y + (glyph.size.y - glyph.bearing.y) * scale };
-				const glm::vec2 glyphSize = { glyph.size.x * scale, glyph.size.y * scale };
+		// Insert the generated vertex data into the buffer
+		if (!vertexData.empty())
+			m_geometry.vbo->Update(vertexData.data(), vertexData.size() * sizeof(float), 0);
 
-				// Generate the vertex data
-				float glyphVertexData[24] =
-				{
-					glyphPos.x, glyphPos.y, glyph.atlasOffsetX / atlasSize.x, glyph.size.y / atlasSize.y,
-					glyphPos.x + glyphSize.x, glyphPos.y, (glyph.atlasOffsetX + glyph.size.x) / atlasSize.x, glyph.size.y / atlasSize.y,
-					glyphPos.x + glyphSize.x, glyphPos.y - glyphSize.y, (glyph.atlasOffsetX + glyph.size.x) / atlasSize.x, 0.0f,
-
-					glyphPos.x, glyphPos.y, glyph.atlasOffsetX / atlasSize.x, glyph.size.y / atlasSize.y,
-					glyphPos.x, glyphPos.y - glyphSize.y, glyph.atlasOffsetX / atlasSize.x, 0.0f,
-					glyphPos.x + glyphSize.x, glyphPos.y - glyphSize.y, (glyph.atlasOffsetX + glyph.size.x) / atlasSize.x, 0.0f
-				};
-
-				// Apply glyph advance amount onto the cursor's x position
-				if (i > 0)
-					cursorPos.x += glyph.advance.x * scale;
+		m_atlasGeneration = m_font->GetAtlasGeneration();
+	}
+
+	void Label::UpdateTextGeometry()
+	{
+		const size_t glyphCount = m_editLayout.glyphs.size();
+		const uint32_t atlasGeneration = m_font->GetAtlasGeneration();
+
+		// The geometry of the glyphs before the edit is kept, unless it's lost by reallocating the vertex buffer or the atlas has changed since
+		if (this->ReserveGlyphCapacity(glyphCount) || atlasGeneration != m_atlasGeneration)
+		{
+			this->GenerateTextGeometry();
+			return;
+		}
+
+		const uint32_t firstGlyph = (uint32_t)std::min(m_firstChangedGlyph, glyphCount);
+		const uint32_t firstVertex = firstGlyph * 6;
+
+		// Remove the glyphs from the edit onwards from the draw runs
+		while (!m_drawRuns.empty() && m_drawRuns.back().firstVertex >= firstVertex)
+			m_drawRuns.pop_back();
+
+		if (!m_drawRuns.empty())
+			m_drawRuns.back().vertexCount = std::min(m_drawRuns.back().vertexCount, firstVertex - m_drawRuns.back().firstVertex);
+
+		// Generate the vertex data of the glyphs from the edit onwards
+		std::vector<float> vertexData;
+		vertexData.reserve((glyphCount - firstGlyph) * 24);
+		this->GenerateLineGeometry(m_editLayout, firstGlyph, { 0.0f, 0.0f }, (float)m_size.x, firstGlyph, vertexData);
+
+		// Rasterizing a glyph may evict the glyphs before the edit, in which case the whole geometry has to be generated again
+		if (m_font->GetAtlasGeneration() != atlasGeneration)
+		{
+			this->GenerateTextGeometry();
+			return;
+		}
+
+		// Only upload the generated range of the vertex data into the buffer
+		if (!vertexData.empty())
+			m_geometry.vbo->Update(vertexData.data(), vertexData.size() * sizeof(float), firstVertex * 4 * sizeof(float));
+	}
+
+	bool Label::ReserveGlyphCapacity(size_t glyphCount)
+	{
+		if (glyphCount <= m_glyphCapacity)
+			return false;
+
+		// Delete the vertex buffer (if existing), then allocate a new vertex buffer which is at least twice as large
+		if (m_geometry.vbo)
+			delete m_geometry.vbo;
+
+		m_glyphCapacity = std::max(glyphCount, m_glyphCapacity * 2);
+		m_geometry.vbo = new VertexBuffer(nullptr, m_glyphCapacity * sizeof(float) * 24, GL_DYNAMIC_DRAW);
+
+		// Create new vertex array (if not existing already), then setup vertex attributes and attach vertex buffer 
+		if (!m_geometry.vao)
+			m_geometry.vao = new VertexArray();
+
+		m_geometry.vao->PushLayout(0, 2, 4 * sizeof(float));
+		m_geometry.vao->PushLayout(1, 2, 4 * sizeof(float), 2 * sizeof(float));
+		m_geometry.vao->AttachBuffers(*m_geometry.vbo);
+
+		return true;
+	}
+
+	void Label::GenerateLineGeometry(const TextLayout& layout, size_t firstGlyph, glm::vec2 offset, float alignmentWidth, uint32_t bufferGlyphOffset,
+		std::vector<float>& vertexData) const
+	{
+		if (m_textAlignment == TextAlignment::CENTER)
+			offset.x += std::floor((alignmentWidth - layout.size.x) / 2.0f);
+		else if (m_textAlignment == TextAlignment::RIGHT)
+			offset.x += alignmentWidth - layout.size.x;
+
+		glm::vec2 atlasPageSize = glm::vec2(0.0f);
+		uint32_t atlasPage = 0;
+
+		for (size_t i = firstGlyph; i < layout.glyphs.size(); i++)
+		{
+			const TextLayout::GlyphQuad& quad = layout.glyphs[i];
+			const Font::GlyphMetrics& glyph = m_font->GetGlyph(quad.codepoint, m_pixelSize);
+			const uint32_t glyphIndex = bufferGlyphOffset + (uint32_t)(vertexData.size() / 24);
+
+			// Glyphs are drawn in runs of consecutive glyphs sharing the same atlas page, glyphs without a bitmap can join any run
+			const bool hasBitmap = glyph.size.x > 0 && glyph.size.y > 0;
+			if (m_drawRuns.empty() || (hasBitmap && m_drawRuns.back().atlasPage != glyph.atlasPage))
+			{
+				if (!m_drawRuns.empty() && m_drawRuns.back().vertexCount == 0) // Reuse the run if it doesn't contain any glyphs yet
+					m_drawRuns.back().atlasPage = glyph.atlasPage;
 				else
-					cursorPos.x += (glyph.advance.x - glyph.bearing.x) * scale;
+					m_drawRuns.push_back({ glyph.atlasPage, glyphIndex * 6, 0 });
+			}
+
+			if (hasBitmap && (atlasPageSize.x <= 0.0f || atlasPage != glyph.atlasPage))
+			{
+				atlasPage = glyph.atlasPage;
+				atlasPageSize = glm::vec2(m_font->GetAtlasPageSize(atlasPage, m_pixelSize));
+			}
 
-				// Insert the generated vertex data into the buffer
-				m_geometry.vbo->Update(glyphVertexData, sizeof(glyphVertexData), sizeof(float) * 24 * i);
+			m_drawRuns.back().vertexCount += 6;
+
+			const glm::vec2 glyphPos = quad.position + offset;
+			const glm::vec2& glyphSize = quad.size;
+
+			// Calculate the texture coordinates of the glyph from its position in the atlas page
+			glm::vec2 uvMin = glm::vec2(0.0f), uvMax = glm::vec2(0.0f);
+			if (hasBitmap && atlasPageSize.x > 0.0f && atlasPageSize.y > 0.0f)
+			{
+				uvMin = glm::vec2(glyph.atlasOffset) / atlasPageSize;
+				uvMax = (glm::vec2(glyph.atlasOffset) + glm::vec2(glyph.size)) / atlasPageSize;
 			}
+
+			// Generate the vertex data
+			const float glyphVertexData[24] =
+			{
+				glyphPos.x, glyphPos.y, uvMin.x, uvMax.y,
+				glyphPos.x + glyphSize.x, glyphPos.y, uvMax.x, uvMax.y,
+				glyphPos.x + glyphSize.x, glyphPos.y - glyphSize.y, uvMax.x, uvMin.y,
+
+				glyphPos.x, glyphPos.y, uvMin.x, uvMax.y,
+				glyphPos.x, glyphPos.y - glyphSize.y, uvMin.x, uvMin.y,
+				glyphPos.x + glyphSize.x, glyphPos.y - glyphSize.y, uvMax.x, uvMin.y
+			};
+
+			vertexData.insert(vertexData.end(), std::begin(glyphVertexData), std::end(glyphVertexData));
 		}
 	}
 
@@ -80,45 +231,191 @@ namespace GUILib
 	{
 		glm::ivec2 textSize = { 0, 0 };
 
-		if (m_font && m_fontSize > 0 && !m_text.empty())
+		if (m_font && m_fontSize > 0 && !m_codepoints.empty())
 		{
-			int highestGlyphEdge = 0, lowestGlyphEdge = 0;
+			this->UpdateLineBreaks();
 
-			for (size_t i = 0; i < m_text.size(); i++)
+			// The width of the text is the width of the widest line, the height spans from the top of the first line to the last baseline
+			size_t lineCount = 0;
+			for (const Paragraph& paragraph : m_paragraphs)
 			{
-				const Font::GlyphMetrics& glyph = m_font->GetGlyph(m_text[i]); // Get the glyph metrics for the character
-				const float scale = m_fontSize / 64.0f;
+				for (const std::string& line : paragraph.lines)
+				{
+					if (!line.empty())
+					{
+						const glm::ivec2& lineSize = TextLayoutCache::GetInstance().GetLayout(*m_font, m_fontSize, line).size;
+						textSize.x = std::max(textSize.x, lineSize.x);
 
-				// Accumulate the glyph's horizontal metrics onto the horizontal text size counter
-				if (i != m_text.size() - 1)
-					textSize.x += glyph.advance.x * scale;
-				else
-					textSize.x += (glyph.bearing.x * scale) + (glyph.size.x * scale);
+						if (lineCount == 0)
+							textSize.y = lineSize.y;
+					}
 
-				// Check if the glyph is positioned higher or lower than the rest
-				const int glyphBottom = (glyph.size.y - glyph.bearing.y) * scale,
-					glyphTop = glyph.bearing.y * scale;
+					lineCount++;
+				}
+			}
 
-				if (glyphTop > highestGlyphEdge)
-					highestGlyphEdge = glyphTop;
-				if (glyphBottom < lowestGlyphEdge)
-					lowestGlyphEdge = glyphBottom;
+			if (lineCount > 1)
+			{
+				const uint32_t pixelSize = m_font->GetNearestPixelSize(m_fontSize);
+				const float lineAdvance = m_font->GetLineHeight(pixelSize) * (m_fontSize / (float)pixelSize) * m_lineSpacing;
+				textSize.y += (int)((lineCount - 1) * lineAdvance);
 			}
 
-			textSize.y = highestGlyphEdge + lowestGlyphEdge; // Calculate the text string height from retrieved highest and lowest glyph edges
+			// Wrapped text spans the whole maximum width, so that the lines can be aligned within it
+			if (m_maxWidth > 0)
+				textSize.x = std::max(textSize.x, m_maxWidth);
 		}
 
 		return textSize;
 	}
 
-	void Label::SetPosition(glm::ivec2 pos) { m_position = pos; }
+	void Label::UpdateLineBreaks() const
+	{
+		// The line breaks of every paragraph depend on the font and font size
+		if (m_lineBreakFont != m_font || m_lineBreakFontSize != m_fontSize)
+		{
+			m_paragraphs.clear();
+			m_lineBreakFont = m_font;
+			m_lineBreakFontSize = m_fontSize;
+		}
+
+		// Split the text into paragraphs at every newline character
+		std::vector<std::string_view> paragraphTexts;
+		const std::string_view text = m_text;
+		for (size_t start = 0;;)
+		{
+			const size_t end = text.find('\n', start);
+			paragraphTexts.emplace_back(text.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start));
+			if (end == std::string_view::npos)
+				break;
+
+			start = end + 1;
+		}
+
+		// Keep the paragraphs at the start and end of the text which haven't changed, only the paragraphs in between are created again
+		const size_t commonCount = std::min(m_paragraphs.size(), paragraphTexts.size());
+		size_t prefixCount = 0, suffixCount = 0;
+		while (prefixCount < commonCount && m_paragraphs[prefixCount].text == paragraphTexts[prefixCount])
+			prefixCount++;
+		while (suffixCount < commonCount - prefixCount &&
+			m_paragraphs[m_paragraphs.size() - 1 - suffixCount].text == paragraphTexts[paragraphTexts.size() - 1 - suffixCount])
+			suffixCount++;
+
+		if (prefixCount != m_paragraphs.size() || m_paragraphs.size() != paragraphTexts.size())
+		{
+			std::vector<Paragraph> paragraphs(paragraphTexts.size());
+			for (size_t i = 0; i < prefixCount; i++)
+				paragraphs[i] = std::move(m_paragraphs[i]);
+			for (size_t i = 0; i < suffixCount; i++)
+				paragraphs[paragraphs.size() - 1 - i] = std::move(m_paragraphs[m_paragraphs.size() - 1 - i]);
+			for (size_t i = prefixCount; i < paragraphs.size() - suffixCount; i++)
+				paragraphs[i].text = paragraphTexts[i];
+
+			m_paragraphs = std::move(paragraphs);
+		}
+
+		// Wrap the paragraphs which are new or were wrapped to a different width
+		for (Paragraph& paragraph : m_paragraphs)
+		{
+			if (paragraph.maxWidth == m_maxWidth)
+				continue;
+
+			// A paragraph which fits on a single line at both widths doesn't need wrapping again
+			const bool fitsOnOneLine = m_maxWidth <= 0 || (paragraph.naturalWidth >= 0.0f && paragraph.naturalWidth <= m_maxWidth);
+			if (paragraph.maxWidth >= 0 && paragraph.lines.size() == 1 && fitsOnOneLine)
+				paragraph.maxWidth = m_maxWidth;
+			else
+				this->WrapParagraph(paragraph);
+		}
+	}
+
+	void Label::WrapParagraph(Paragraph& paragraph) const
+	{
+		paragraph.lines.clear();
+		paragraph.maxWidth = m_maxWidth;
+
+		// Without a maximum width the paragraph is a single line, so it doesn't have to be measured
+		if (m_maxWidth <= 0)
+		{
+			paragraph.lines.emplace_back(paragraph.text);
+			paragraph.naturalWidth = -1.0f;
+			return;
+		}
+
+		const std::u32string codepoints = DecodeUTF8(paragraph.text);
+		const uint32_t pixelSize = m_font->GetNearestPixelSize(m_fontSize);
+		const float scale = m_fontSize / (float)pixelSize;
+
+		// Measure the horizontal advance of every glyph, including the kerning with the previous glyph
+		std::vector<float> advances(codepoints.size());
+		paragraph.naturalWidth = 0.0f;
+
+		for (size_t i = 0; i < codepoints.size(); i++)
+		{
+			advances[i] = m_font->GetGlyph(codepoints[i], pixelSize).advance * scale;
+			if (i > 0)
+				advances[i] += m_font->GetKerning(codepoints[i - 1], codepoints[i], pixelSize) * scale;
+
+			paragraph.naturalWidth += advances[i];
+		}
+
+		if (paragraph.naturalWidth <= m_maxWidth)
+		{
+			paragraph.lines.emplace_back(paragraph.text);
+			return;
+		}
+
+		auto appendLine = [&](size_t begin, size_t end)
+		{
+			std::string& line = paragraph.lines.emplace_back();
+			for (size_t i = begin; i < end; i++)
+				AppendUTF8(line, codepoints[i]);
+		};
+
+		// Greedily fill each line, breaking at the last space which fits or mid-word if a single word doesn't fit on a line
+		size_t lineStart = 0, breakIndex = std::u32string::npos;
+		float lineWidth = 0.0f;
+
+		for (size_t i = 0; i < codepoints.size(); i++)
+		{
+			if (codepoints[i] == U' ')
+			{
+				if (i > lineStart)
+					breakIndex = i;
+			}
+			else if (i > lineStart && lineWidth + advances[i] > m_maxWidth)
+			{
+				// Spaces at the line break are dropped
+				const bool breakAtSpace = breakIndex != std::u32string::npos;
+				appendLine(lineStart, breakAtSpace ? breakIndex : i);
+				lineStart = breakAtSpace ? breakIndex + 1 : i;
+				breakIndex = std::u32string::npos;
+
+				lineWidth = 0.0f;
+				for (size_t j = lineStart; j < i; j++)
+					lineWidth += advances[j];
+			}
+
+			lineWidth += advances[i];
+		}
+
+		appendLine(lineStart, codepoints.size());
+	}
+
+	void Label::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->MarkChildTransformsDirty();
+	}
 
 	void Label::SetFont(const Font* font)
 	{
 		if (m_font != font)
 		{
 			m_font = font;
+			m_editLayoutValid = false;
 			m_shouldUpdate = UpdateFlags::UPDATE_ALL;
+			this->InvalidateLayout();
 		}
 	}
 
@@ -127,7 +424,9 @@ namespace GUILib
 		if (m_fontSize != size)
 		{
 			m_fontSize = size;
+			m_editLayoutValid = false;
 			m_shouldUpdate = UpdateFlags::UPDATE_ALL;
+			this->InvalidateLayout();
 		}
 	}
 
@@ -135,51 +434,178 @@ namespace GUILib
 	{
 		if (m_text != text)
 		{
-			if (m_text.size() != text.size())
-				m_textLengthChanged = true;
-
 			m_text = text;
+			m_codepoints = DecodeUTF8(text);
+			m_editLayoutValid = false;
+			m_shouldUpdate = UpdateFlags::UPDATE_ALL;
+			this->InvalidateLayout();
+		}
+	}
+
+	void Label::InsertText(size_t offset, std::string_view text)
+	{
+		if (text.empty())
+			return;
+
+		offset = std::min(offset, m_text.size());
+		const size_t glyphIndex = this->GetGlyphIndex(offset);
+
+		m_text.insert(offset, text);
+		m_codepoints.insert(glyphIndex, DecodeUTF8(text));
+		this->UpdateEditedLayout(glyphIndex, text.find('\n') == std::string_view::npos);
+	}
+
+	void Label::EraseText(size_t offset, size_t length)
+	{
+		offset = std::min(offset, m_text.size());
+		length = std::min(length, m_text.size() - offset);
+		if (length == 0)
+			return;
+
+		const size_t glyphIndex = this->GetGlyphIndex(offset);
+		const size_t glyphCount = GetUTF8Length(std::string_view(m_text).substr(offset, length));
+
+		m_text.erase(offset, length);
+		m_codepoints.erase(glyphIndex, glyphCount);
+		this->UpdateEditedLayout(glyphIndex, true);
+	}
+
+	void Label::UpdateEditedLayout(size_t firstChangedGlyph, bool isSingleLine)
+	{
+		m_isEdited = true;
+
+		// Lay out the glyphs from the edit onwards straight away, so that the label's size is up to date, only their geometry is deferred
+		if (m_editLayoutValid && isSingleLine)
+		{
+			TextLayoutCache::LayoutText(*m_font, m_fontSize, m_codepoints, m_editLayout, firstChangedGlyph);
+			m_size = m_editLayout.size;
+			m_firstChangedGlyph = std::min(m_firstChangedGlyph, firstChangedGlyph);
+
+			if (m_shouldUpdate == UpdateFlags::NONE)
+				m_shouldUpdate = UpdateFlags::UPDATE_GEOMETRY_DATA;
+		}
+		else
+		{
+			m_editLayoutValid = false;
 			m_shouldUpdate = UpdateFlags::UPDATE_ALL;
 		}
+
+		this->InvalidateLayout();
+	}
+
+	size_t Label::GetGlyphIndex(size_t offset) const
+	{
+		// Count the codepoints on whichever side of the offset is shorter, edits are usually made near the end of the text
+		if (offset >= m_text.size() / 2)
+			return m_codepoints.size() - GetUTF8Length(std::string_view(m_text).substr(offset));
+
+		return GetUTF8Length(std::string_view(m_text).substr(0, offset));
 	}
 
 	void Label::SetTextColor(glm::vec4 color) { m_textColor = color; }
 
+	void Label::SetMaxWidth(int maxWidth)
+	{
+		maxWidth = std::max(maxWidth, 0);
+		if (m_maxWidth != maxWidth)
+		{
+			m_maxWidth = maxWidth;
+			m_editLayoutValid = false;
+			m_shouldUpdate = UpdateFlags::UPDATE_ALL;
+			this->InvalidateLayout();
+		}
+	}
+
+	void Label::SetTextAlignment(TextAlignment alignment)
+	{
+		if (m_textAlignment != alignment)
+		{
+			m_textAlignment = alignment;
+			m_shouldUpdate = UpdateFlags::UPDATE_GEOMETRY_DATA;
+		}
+	}
+
+	void Label::SetLineSpacing(float spacing)
+	{
+		if (m_lineSpacing != spacing)
+		{
+			m_lineSpacing = spacing;
+			m_shouldUpdate = UpdateFlags::UPDATE_ALL;
+			this->InvalidateLayout();
+		}
+	}
+
 	void Label::Update(float deltaTime)
 	{
+		// Glyphs used by the label may have been evicted from the font's texture atlas, in which case the geometry has to be regenerated
+		if (m_font && m_font->GetAtlasGeneration() != m_atlasGeneration && m_shouldUpdate == UpdateFlags::NONE)
+			m_shouldUpdate = UpdateFlags::UPDATE_GEOMETRY_DATA;
+
 		if (m_shouldUpdate == UpdateFlags::UPDATE_ALL || m_shouldUpdate == UpdateFlags::UPDATE_GEOMETRY_DATA)
-			this->GenerateTextGeometry();
+		{
+			// Only the geometry of the glyphs after the first edit has to be generated if the text has just been edited in place
+			if (m_editLayoutValid && m_firstChangedGlyph != std::u32string::npos)
+				this->UpdateTextGeometry();
+			else
+				this->GenerateTextGeometry();
+		}
 		else if (m_shouldUpdate == UpdateFlags::UPDATE_ALL || m_shouldUpdate == UpdateFlags::UPDATE_TEXT_SIZE_DATA)
 			m_size = this->CalculateTextSize();
 		
 		m_shouldUpdate = UpdateFlags::NONE;
+		m_firstChangedGlyph = std::u32string::npos;
 	}
 
 	void Label::Render(const Viewport& viewport) const
 	{
-		if (m_font && !m_text.empty())
+		// Labels within idle components aren't updated, so glyphs evicted from (or moved within) the font's texture atlas since the geometry
+		// was generated are looked up again here, unless the geometry is already due to be generated again by the next update
+		const bool isGeometryPending = m_shouldUpdate == UpdateFlags::UPDATE_ALL || m_shouldUpdate == UpdateFlags::UPDATE_GEOMETRY_DATA;
+		if (m_font && !m_drawRuns.empty() && m_font->GetAtlasGeneration() != m_atlasGeneration && !isGeometryPending)
+			this->GenerateGlyphGeometry();
+
+		if (m_font && !m_drawRuns.empty())
 		{
+			// Upload any glyphs which have been rasterized since the previous frame
+			m_font->FlushAtlasUpdates();
+
 			// Construct the model matrix
 			glm::mat4 modelMatrix = glm::mat4(1.0f);
 			modelMatrix = glm::translate(modelMatrix, { m_position, 0.0f });
 			
-			// Bind the shader and setup the shader uniforms
-			m_shaders->Bind();
-			m_shaders->SetUniform("fontAtlasSampler", 0);
-			m_shaders->SetUniformGLM("model", modelMatrix);
-			m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
-			m_shaders->SetUniformGLM("textColor", m_textColor);
-
-			// Render the image component
+			// Bind the shader matching the font's render mode and setup the shader uniforms
+			ShaderProgram* shaders = m_font->GetRenderMode() == FontRenderMode::SIGNED_DISTANCE_FIELD ? m_sdfShaders : m_shaders;
+			shaders->Bind();
+			shaders->SetUniform("fontAtlasSampler", 0);
+			shaders->SetUniformGLM("model", modelMatrix);
+			shaders->SetUniformGLM("viewport", viewport.GetMatrix());
+			shaders->SetUniformGLM("textColor", m_textColor);
+
+			// Render the text, binding the atlas page used by each run of glyphs
 			m_geometry.vao->Bind();
-			m_font->GetTextureAtlas()->Bind(0);
 
-			glDrawArrays(GL_TRIANGLES, 0, m_text.size() * 6);
+			for (const DrawRun& run : m_drawRuns)
+			{
+				const TextureBuffer2D* atlasPage = m_font->GetTextureAtlas(run.atlasPage, m_pixelSize);
+				if (!atlasPage)
+					continue;
+
+				atlasPage->Bind(GL_TEXTURE0);
+				glDrawArrays(GL_TRIANGLES, run.firstVertex, run.vertexCount);
+			}
 		}
 	}
 
 	const glm::ivec2& Label::GetPosition() const { return m_position; }
 
+	bool Label::GetRenderBounds(glm::vec2& min, glm::vec2& max) const
+	{
+		const glm::vec2 size = this->GetSize();
+		min = glm::vec2(m_position) - glm::vec2(0.0f, size.y);
+		max = glm::vec2(m_position) + size;
+		return true;
+	}
+
 	const Font* Label::GetFont() const { return m_font; }
 
 	const float Label::GetFontSize() const { return m_fontSize; }
@@ -188,6 +614,12 @@ namespace GUILib
 
 	const glm::vec4& Label::GetTextColor() const { return m_textColor; }
 
+	int Label::GetMaxWidth() const { return m_maxWidth; }
+
+	TextAlignment Label::GetTextAlignment() const { return m_textAlignment; }
+
+	float Label::GetLineSpacing() const { return m_lineSpacing; }
+
 	const glm::ivec2& Label::GetSize() const 
 	{ 
 		// Update the text size data before returning if requested
@@ -199,4 +631,26 @@ namespace GUILib
 
 		return m_size; 
 	}
+
+	bool Label::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		// The label's position is on the baseline at the left of its text, so the box extends up from the position
+		size = this->GetSize();
+		anchor = { 0, size.y };
+		return true;
+	}
+
+	float Label::GetCharacterOffset(size_t offset) const
+	{
+		if (!m_font || m_fontSize <= 0 || m_codepoints.empty())
+			return 0.0f;
+
+		// The character starts where the pen was left by the glyph before it
+		const size_t glyphIndex = this->GetGlyphIndex(std::min(offset, m_text.size()));
+		if (glyphIndex == 0)
+			return 0.0f;
+
+		const TextLayout& layout = m_editLayoutValid ? m_editLayout : TextLayoutCache::GetInstance().GetLayout(*m_font, m_fontSize, m_text);
+		return layout.glyphs[std::min(glyphIndex, layout.glyphs.size()) - 1].penX;
+	}
 }
\ No newline at end of file
@@ -3,11 +3,21 @@
 
 #include <components/component.h>
 #include <graphics/font.h>
+#include <graphics/text_layout_cache.h>
 
 namespace GUILib
 {
+	/**
+	* @brief An enumeration specifying how the lines of a multi-line label are aligned horizontally.
+	*/
+	enum class TextAlignment { LEFT, CENTER, RIGHT };
+
 	/**
 	* @brief This is a component class for displaying text labels.
+	* Text is split into lines at every newline character, and if a maximum width is set, lines which are too wide are wrapped at word
+	* boundaries. The label's position is the bottom-left of the first line, any further lines are placed below it.
+	* The line breaks of each paragraph are cached, so that changing the text or the maximum width only reflows the paragraphs affected.
+	* Single-line text which is edited in place (using InsertText() and EraseText()) only lays out and uploads the glyphs after the edit.
 	* Also, make sure that whenever you are using this class you are always allocating it on the heap, not the stack.
 	*/
 	class LIB_DECLSPEC Label : public Component
@@ -29,7 +39,7 @@ namespace GUILib
 		* @brief Sets the current position of the label component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the font of the label component.
@@ -45,16 +55,53 @@ namespace GUILib
 
 		/**
 		* @brief Sets the text which the label component will display.
-		* @param[in] text - The text to be assigned to the label.
+		* @param[in] text - The UTF-8 encoded text to be assigned to the label.
 		*/
 		void SetText(std::string_view text);
 
+		/**
+		* @brief Inserts text into the text which the label component displays.
+		* Unlike SetText(), only the glyphs from the insertion point onwards have their geometry generated again (as long as the label's text
+		* is a single unwrapped line), so the cost is proportional to the text after the insertion point rather than the whole text.
+		*
+		* @param[in] offset - The byte offset where the text is inserted, this must be at the start of an encoded codepoint.
+		* @param[in] text - The UTF-8 encoded text to be inserted.
+		*/
+		void InsertText(size_t offset, std::string_view text);
+
+		/**
+		* @brief Erases a range of the text which the label component displays.
+		* Like InsertText(), only the glyphs from the start of the range onwards have their geometry generated again.
+		*
+		* @param[in] offset - The byte offset of the start of the range, this must be at the start of an encoded codepoint.
+		* @param[in] length - The length (in bytes) of the range, this must end at the start of an encoded codepoint (or the end of the text).
+		*/
+		void EraseText(size_t offset, size_t length);
+
 		/**
 		* @brief Sets the current text color of the label component.
 		* @param[in] color - The new color of the text.
 		*/
 		void SetTextColor(glm::vec4 color);
 
+		/**
+		* @brief Sets the maximum width of the label component's lines, lines which are wider are wrapped at word boundaries.
+		* @param[in] maxWidth - The maximum line width (in pixels), 0 disables wrapping.
+		*/
+		void SetMaxWidth(int maxWidth);
+
+		/**
+		* @brief Sets how the label component's lines are aligned within the label.
+		* @param[in] alignment - The horizontal text alignment.
+		*/
+		void SetTextAlignment(TextAlignment alignment);
+
+		/**
+		* @brief Sets the spacing between the label component's lines, relative to the font's line height.
+		* @param[in] spacing - The line spacing multiplier (e.g. 1.5 for one and a half line spacing).
+		*/
+		void SetLineSpacing(float spacing);
+
 		/**
 		* @brief Updates the logic of the label component.
 		* @param[in] deltaTime - The elapsed time between the previous and current frame.
@@ -71,7 +118,7 @@ namespace GUILib
 		* @brief Returns the current position of the label component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
 
 		/**
 		* @brief Returns the font assigned to the label component.
@@ -97,17 +144,82 @@ namespace GUILib
 		*/
 		const glm::vec4& GetTextColor() const;
 
+		/**
+		* @brief Returns the maximum width of the label component's lines.
+		* @return The maximum line width (in pixels), 0 if wrapping is disabled.
+		*/
+		int GetMaxWidth() const;
+
+		/**
+		* @brief Returns how the label component's lines are aligned within the label.
+		* @return The horizontal text alignment.
+		*/
+		TextAlignment GetTextAlignment() const;
+
+		/**
+		* @brief Returns the spacing between the label component's lines, relative to the font's line height.
+		* @return The line spacing multiplier.
+		*/
+		float GetLineSpacing() const;
+
 		/**
 		* @brief Returns the size of this label component.
 		* @return The size of this component.
 		*/
 		const glm::ivec2& GetSize() const;
+
+		/**
+		* @brief Measures the box which the label occupies when arranged by a layout panel, which is the size of its text.
+		* @param[out] size - The size of the component's box.
+		* @param[out] anchor - The offset of the component's position from the top-left corner of its box.
+		* @return TRUE, as labels always occupy a box.
+		*/
+		bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const override;
+
+		/**
+		* @brief Retrieves the bounds which the label is rendered within, these are padded by the label's height as the position is at the
+		* baseline of the first line.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, the bounds of a label are always known.
+		*/
+		bool GetRenderBounds(glm::vec2& min, glm::vec2& max) const override;
+
+		/**
+		* @brief Returns the horizontal position of the character at the byte offset given, relative to the label's position.
+		* This is only meaningful for labels displaying a single line of text (e.g. for placing a caret).
+		*
+		* @param[in] offset - The byte offset of the character within the text, the end of the text gives the position after the last glyph.
+		* @return The horizontal offset (in pixels) of the character.
+		*/
+		float GetCharacterOffset(size_t offset) const;
 	private:
 		/**
 		* @brief An enumeration specifying the data which should be updated.
 		*/
 		enum class UpdateFlags { NONE, UPDATE_GEOMETRY_DATA, UPDATE_TEXT_SIZE_DATA, UPDATE_ALL };
 
+		/**
+		* @brief A struct describing a range of consecutive glyph vertices which are drawn using the same font atlas page.
+		*/
+		struct DrawRun
+		{
+			uint32_t atlasPage;
+			uint32_t firstVertex, vertexCount;
+		};
+
+		/**
+		* @brief A struct containing a paragraph of text (text between newline characters), along with its cached line breaks.
+		*/
+		struct Paragraph
+		{
+			std::string text;
+			std::vector<std::string> lines;
+			int maxWidth = -1; // The maximum width which the lines were wrapped to, -1 if the paragraph hasn't been wrapped yet
+			float naturalWidth = -1.0f; // The width of the paragraph if it were laid out as a single line, -1 if it hasn't been measured
+		};
+
 		/**
 		* @brief Initialises the label component.
 		*/
@@ -118,22 +230,101 @@ namespace GUILib
 		*/
 		void GenerateTextGeometry();
 
+		/**
+		* @brief Generates the vertex data of every glyph from the current layout of the text, and uploads it into the vertex buffer.
+		* This only looks up the glyphs again (e.g. after the font's texture atlas has changed), the text has to be laid out already.
+		*/
+		void GenerateGlyphGeometry() const;
+
+		/**
+		* @brief Generates the geometry data of the glyphs from the first glyph changed by an edit onwards, only the generated range is uploaded.
+		* The whole geometry is generated instead if the vertex buffer has to be enlarged or the font's texture atlas changes.
+		*/
+		void UpdateTextGeometry();
+
+		/**
+		* @brief Makes sure that the vertex buffer can hold the number of glyphs given, the vertex buffer's capacity is at least doubled
+		* whenever it has to be reallocated, so that text which keeps growing (e.g. while typing) rarely needs a new vertex buffer.
+		*
+		* @param[in] glyphCount - The number of glyphs that the vertex buffer has to hold.
+		* @return TRUE if the vertex buffer was reallocated (discarding its contents), FALSE otherwise.
+		*/
+		bool ReserveGlyphCapacity(size_t glyphCount);
+
+		/**
+		* @brief Lays out the text again after an edit, only laying out the glyphs from the edit onwards if possible.
+		*
+		* @param[in] firstChangedGlyph - The index of the first glyph affected by the edit.
+		* @param[in] isSingleLine - Specifies whether the text is still a single line after the edit.
+		*/
+		void UpdateEditedLayout(size_t firstChangedGlyph, bool isSingleLine);
+
+		/**
+		* @brief Returns the index of the glyph (codepoint) starting at the byte offset given within the text.
+		*/
+		size_t GetGlyphIndex(size_t offset) const;
+
 		/**
 		* @brief Calculates the size (in pixels) of the text string when displayed.
 		* @return A two-dimensional vector representing the size of the text.
 		*/
 		glm::ivec2 CalculateTextSize() const;
+
+		/**
+		* @brief Splits the text into paragraphs and wraps them, only the paragraphs whose text or maximum width have changed since the
+		* previous call are wrapped again.
+		*/
+		void UpdateLineBreaks() const;
+
+		/**
+		* @brief Breaks the paragraph given into lines no wider than the maximum width, breaking at spaces where possible.
+		* @param[in] paragraph - The paragraph to be wrapped.
+		*/
+		void WrapParagraph(Paragraph& paragraph) const;
+
+		/**
+		* @brief Generates the vertex data for the glyphs of a line of text, appending it to the vertex data given.
+		*
+		* @param[in] layout - The layout of the line.
+		* @param[in] firstGlyph - The index of the line's first glyph to generate the vertex data of.
+		* @param[in] offset - The position of the line relative to the label's position.
+		* @param[in] alignmentWidth - The width which the line is aligned within.
+		* @param[in] bufferGlyphOffset - The index of the glyph in the vertex buffer which the start of the vertex data given is uploaded to.
+		* @param[out] vertexData - The vertex data which the line's vertex data is appended to.
+		*/
+		void GenerateLineGeometry(const TextLayout& layout, size_t firstGlyph, glm::vec2 offset, float alignmentWidth, uint32_t bufferGlyphOffset,
+			std::vector<float>& vertexData) const;
 	private:
 		// Private component attributes
 		mutable glm::ivec2 m_position, m_size;
 		glm::vec4 m_textColor;
 		std::string m_text;
+		std::u32string m_codepoints;
 		const Font* m_font;
 		float m_fontSize;
 
+		// Text wrapping attributes
+		int m_maxWidth;
+		TextAlignment m_textAlignment;
+		float m_lineSpacing;
+		mutable std::vector<Paragraph> m_paragraphs;
+		mutable const Font* m_lineBreakFont;
+		mutable float m_lineBreakFontSize;
+
+		// Text geometry data
+		ShaderProgram* m_sdfShaders;
+		mutable std::vector<DrawRun> m_drawRuns;
+		mutable uint32_t m_atlasGeneration;
+		uint32_t m_pixelSize;
+		size_t m_glyphCapacity; // The number of glyphs which the vertex buffer can hold
+
+		// Labels whose text is edited in place keep their own layout of their (single-line) text, so that it can be laid out incrementally
+		TextLayout m_editLayout;
+		size_t m_firstChangedGlyph; // The first glyph which has been edited since the geometry was generated
+
 		// Flags
 		mutable UpdateFlags m_shouldUpdate;
-		bool m_textLengthChanged;
+		bool m_isEdited, m_editLayoutValid;
 	};
 }
 
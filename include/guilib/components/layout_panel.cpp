@@ -0,0 +1,434 @@
+#include <components/layout_panel.h>
+#include <algorithm>
+
+namespace GUILib
+{
+	namespace
+	{
+		/**
+		* @brief Returns the offset of an item within the space given along one axis, for the alignment given.
+		*/
+		int GetAlignedOffset(LayoutAlignment alignment, int space, int itemSize)
+		{
+			switch (alignment)
+			{
+			case LayoutAlignment::CENTER:
+				return (space - itemSize) / 2;
+			case LayoutAlignment::END:
+				return space - itemSize;
+			default:
+				return 0;
+			}
+		}
+	}
+
+	LayoutPanel::LayoutPanel(LayoutDirection direction) :
+		m_direction(direction), m_justification(LayoutJustification::START), m_alignment(LayoutAlignment::START), m_gridColumns(1),
+		m_padding(0), m_spacing(0), m_fillViewport(false), m_position({ 0, 0 }), m_size({ 0, 0 }), m_fixedSize({ 0, 0 }),
+		m_contentSize({ 0, 0 }), m_isMeasureValid(false), m_isLayoutDirty(true), m_isArranging(false)
+	{
+		this->InitializeComponent();
+	}
+
+	void LayoutPanel::InitializeComponent() {}
+
+	void LayoutPanel::AddChild(Component* child, float grow)
+	{
+		if (!child || child == this)
+			return;
+
+		// The panel is notified of its new child through OnChildLayoutInvalidated(), which adds the child to the end of the panel
+		child->SetParent(this);
+
+		LayoutItem& item = m_items[m_itemIndices.at(child)];
+		grow = std::max(grow, 0.0f);
+		if (item.grow != grow)
+		{
+			item.grow = grow;
+			this->InvalidateArrangement();
+		}
+	}
+
+	void LayoutPanel::RemoveChild(Component* child)
+	{
+		if (child && child->GetParent() == this)
+			child->SetParent(nullptr);
+	}
+
+	void LayoutPanel::SetDirection(LayoutDirection direction)
+	{
+		if (m_direction != direction)
+		{
+			m_direction = direction;
+			this->InvalidateMeasure();
+		}
+	}
+
+	void LayoutPanel::SetGridColumns(int columns)
+	{
+		columns = std::max(columns, 1);
+		if (m_gridColumns != columns)
+		{
+			m_gridColumns = columns;
+			this->InvalidateMeasure();
+		}
+	}
+
+	void LayoutPanel::SetPadding(int padding)
+	{
+		if (m_padding != padding)
+		{
+			m_padding = padding;
+			this->InvalidateMeasure();
+		}
+	}
+
+	void LayoutPanel::SetSpacing(int spacing)
+	{
+		if (m_spacing != spacing)
+		{
+			m_spacing = spacing;
+			this->InvalidateMeasure();
+		}
+	}
+
+	void LayoutPanel::SetJustification(LayoutJustification justification)
+	{
+		if (m_justification != justification)
+		{
+			m_justification = justification;
+			this->InvalidateArrangement();
+		}
+	}
+
+	void LayoutPanel::SetAlignment(LayoutAlignment alignment)
+	{
+		if (m_alignment != alignment)
+		{
+			m_alignment = alignment;
+			this->InvalidateArrangement();
+		}
+	}
+
+	void LayoutPanel::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->MarkChildTransformsDirty();
+	}
+
+	void LayoutPanel::SetSize(glm::ivec2 size)
+	{
+		size = glm::max(size, glm::ivec2(0));
+		if (m_fixedSize != size)
+		{
+			m_fixedSize = size;
+			this->InvalidateMeasure();
+		}
+	}
+
+	void LayoutPanel::SetFillViewport(bool fill) { m_fillViewport = fill; }
+
+	void LayoutPanel::UpdateLayout()
+	{
+		if (!m_isLayoutDirty)
+			return;
+
+		// A panel within another panel is sized by its parent, so if the parent is out of date as well then it is laid out instead, which
+		// lays out this panel along with it
+		if (LayoutPanel* parent = dynamic_cast<LayoutPanel*>(this->GetParent()))
+		{
+			if (parent->IsLayoutDirty())
+				parent->UpdateLayout();
+			else
+				this->Arrange(m_size);
+		}
+		else
+		{
+			this->Arrange(this->GetDesiredSize());
+		}
+	}
+
+	void LayoutPanel::Update(float /*deltaTime*/)
+	{
+		// The panel only has to be updated again once its layout is out of date
+		this->UpdateLayout();
+		this->SetUpdateRequired(false);
+	}
+
+	void LayoutPanel::Render(const Viewport& /*viewport*/) const {}
+
+	bool LayoutPanel::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		size = this->GetDesiredSize();
+		anchor = m_size / 2;
+		return true;
+	}
+
+	void LayoutPanel::ArrangeLayout(glm::ivec2 size)
+	{
+		if (size != m_size || m_isLayoutDirty)
+			this->Arrange(size);
+	}
+
+	void LayoutPanel::OnViewportResized(const Viewport& viewport)
+	{
+		if (m_fillViewport)
+		{
+			const glm::ivec2& size = viewport.GetSize();
+			this->SetSize(size);
+			this->SetPosition(size / 2);
+		}
+	}
+
+	bool LayoutPanel::IsLayoutDirty() const { return m_isLayoutDirty; }
+
+	const glm::ivec2& LayoutPanel::GetPosition() const { return m_position; }
+
+	const glm::ivec2& LayoutPanel::GetSize() const { return m_size; }
+
+	void LayoutPanel::OnChildLayoutInvalidated(Component* child)
+	{
+		auto iterator = m_itemIndices.find(child);
+		if (child->GetParent() != this)
+		{
+			// The child has been removed from the panel (which is also the case when it's being deleted)
+			if (iterator == m_itemIndices.end())
+				return;
+
+			const size_t index = iterator->second;
+			m_itemIndices.erase(iterator);
+			m_items.erase(m_items.begin() + index);
+			for (size_t i = index; i < m_items.size(); i++)
+				m_itemIndices[m_items[i].component] = i;
+		}
+		else if (iterator == m_itemIndices.end())
+		{
+			m_itemIndices.insert({ child, m_items.size() });
+			m_items.push_back({ child, dynamic_cast<LayoutPanel*>(child), 0.0f, { 0, 0 }, { 0, 0 }, { 0, 0 }, false, false });
+		}
+		else
+		{
+			// Children resized by the panel itself don't have to be measured again
+			if (m_isArranging)
+				return;
+
+			m_items[iterator->second].isMeasured = false;
+		}
+
+		this->InvalidateMeasure();
+	}
+
+	void LayoutPanel::InvalidateMeasure()
+	{
+		// The parent only has to be notified once, until it measures the panel again
+		const bool wasMeasureValid = m_isMeasureValid;
+		m_isMeasureValid = false;
+		this->InvalidateArrangement();
+
+		if (wasMeasureValid)
+			this->InvalidateLayout();
+	}
+
+	void LayoutPanel::InvalidateArrangement()
+	{
+		if (!m_isLayoutDirty)
+		{
+			m_isLayoutDirty = true;
+			this->SetUpdateRequired(true);
+		}
+	}
+
+	void LayoutPanel::Measure() const
+	{
+		if (m_isMeasureValid)
+			return;
+
+		const bool isGrid = m_direction == LayoutDirection::GRID;
+		const int mainAxis = m_direction == LayoutDirection::COLUMN ? 1 : 0, crossAxis = 1 - mainAxis;
+
+		m_columnWidths.clear();
+		m_rowHeights.clear();
+
+		glm::ivec2 content(0);
+		int count = 0;
+		for (LayoutItem& item : m_items)
+		{
+			// Only the children which have changed since they were last measured are measured again
+			if (!item.isMeasured)
+			{
+				item.hasSize = item.component->MeasureLayout(item.size, item.anchor);
+				item.arrangedSize = item.size;
+				item.isMeasured = true;
+			}
+
+			if (!item.hasSize)
+				continue;
+
+			if (isGrid)
+			{
+				const size_t column = (size_t)(count % m_gridColumns), row = (size_t)(count / m_gridColumns);
+				if (column == m_columnWidths.size())
+					m_columnWidths.emplace_back(0);
+				if (row == m_rowHeights.size())
+					m_rowHeights.emplace_back(0);
+
+				m_columnWidths[column] = std::max(m_columnWidths[column], item.size.x);
+				m_rowHeights[row] = std::max(m_rowHeights[row], item.size.y);
+			}
+			else
+			{
+				content[mainAxis] += item.size[mainAxis];
+				content[crossAxis] = std::max(content[crossAxis], item.size[crossAxis]);
+			}
+
+			count++;
+		}
+
+		if (isGrid)
+		{
+			for (int width : m_columnWidths)
+				content.x += width;
+			for (int height : m_rowHeights)
+				content.y += height;
+
+			content += m_spacing * glm::max(glm::ivec2((int)m_columnWidths.size(), (int)m_rowHeights.size()) - 1, glm::ivec2(0));
+		}
+		else if (count > 1)
+		{
+			content[mainAxis] += m_spacing * (count - 1);
+		}
+
+		m_contentSize = content + (2 * m_padding);
+		m_isMeasureValid = true;
+	}
+
+	glm::ivec2 LayoutPanel::GetDesiredSize() const
+	{
+		this->Measure();
+		return { m_fixedSize.x > 0 ? m_fixedSize.x : m_contentSize.x, m_fixedSize.y > 0 ? m_fixedSize.y : m_contentSize.y };
+	}
+
+	void LayoutPanel::Arrange(glm::ivec2 size)
+	{
+		this->Measure();
+
+		m_size = size;
+		m_isLayoutDirty = false;
+		m_isArranging = true;
+
+		// The children are positioned relative to the panel's position, which is its center
+		const glm::ivec2 inner = glm::max(size - (2 * m_padding), glm::ivec2(0));
+		const glm::ivec2 origin = -(size / 2) + m_padding;
+
+		if (m_direction == LayoutDirection::GRID)
+		{
+			// Each cell is as large as the largest child in its column and row, the children are aligned within their cell
+			glm::ivec2 cellPosition(0);
+			int count = 0;
+			for (LayoutItem& item : m_items)
+			{
+				if (!item.hasSize)
+					continue;
+
+				const size_t column = (size_t)(count % m_gridColumns), row = (size_t)(count / m_gridColumns);
+				if (column == 0 && row > 0)
+					cellPosition = { 0, cellPosition.y + m_rowHeights[row - 1] + m_spacing };
+
+				const glm::ivec2 cellSize(m_columnWidths[column], m_rowHeights[row]);
+				if (m_alignment == LayoutAlignment::STRETCH)
+				{
+					this->PlaceItem(item, origin + cellPosition, cellSize);
+				}
+				else
+				{
+					const glm::ivec2 offset(GetAlignedOffset(m_alignment, cellSize.x, item.size.x),
+						GetAlignedOffset(m_alignment, cellSize.y, item.size.y));
+					this->PlaceItem(item, origin + cellPosition + offset, item.size);
+				}
+
+				cellPosition.x += cellSize.x + m_spacing;
+				count++;
+			}
+		}
+		else
+		{
+			const int mainAxis = m_direction == LayoutDirection::COLUMN ? 1 : 0, crossAxis = 1 - mainAxis;
+			const int freeSpace = std::max(size[mainAxis] - m_contentSize[mainAxis], 0);
+
+			float totalGrow = 0.0f;
+			int count = 0;
+			for (const LayoutItem& item : m_items)
+			{
+				if (item.hasSize)
+				{
+					totalGrow += item.grow;
+					count++;
+				}
+			}
+
+			// The space left over is either shared between the children which grow, or distributed according to the justification
+			int offset = 0, spacing = m_spacing;
+			if (totalGrow <= 0.0f)
+			{
+				switch (m_justification)
+				{
+				case LayoutJustification::CENTER:
+					offset = freeSpace / 2;
+					break;
+				case LayoutJustification::END:
+					offset = freeSpace;
+					break;
+				case LayoutJustification::SPACE_BETWEEN:
+					if (count > 1)
+						spacing += freeSpace / (count - 1);
+					break;
+				default:
+					break;
+				}
+			}
+
+			for (LayoutItem& item : m_items)
+			{
+				if (!item.hasSize)
+					continue;
+
+				glm::ivec2 itemSize = item.size, position;
+				if (item.grow > 0.0f)
+					itemSize[mainAxis] += (int)((float)freeSpace * item.grow / totalGrow);
+
+				position[mainAxis] = offset;
+				if (m_alignment == LayoutAlignment::STRETCH)
+				{
+					itemSize[crossAxis] = inner[crossAxis];
+					position[crossAxis] = 0;
+				}
+				else
+				{
+					position[crossAxis] = GetAlignedOffset(m_alignment, inner[crossAxis], itemSize[crossAxis]);
+				}
+
+				this->PlaceItem(item, origin + position, itemSize);
+				offset += itemSize[mainAxis] + spacing;
+			}
+		}
+
+		m_isArranging = false;
+	}
+
+	void LayoutPanel::PlaceItem(LayoutItem& item, glm::ivec2 topLeft, glm::ivec2 size)
+	{
+		// Children are only resized when their size changes, or in the case of panels when their own layout is out of date
+		if (size != item.arrangedSize || (item.panel && item.panel->IsLayoutDirty()))
+		{
+			item.component->ArrangeLayout(size);
+			item.arrangedSize = size;
+
+			// Resizing the child can move its position within its box
+			glm::ivec2 measuredSize;
+			item.component->MeasureLayout(measuredSize, item.anchor);
+		}
+
+		// Children whose local position hasn't changed aren't repositioned
+		item.component->SetLocalPosition(topLeft + item.anchor);
+	}
+}
\ No newline at end of file
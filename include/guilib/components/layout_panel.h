@@ -0,0 +1,246 @@
+#ifndef LAYOUT_PANEL_H
+#define LAYOUT_PANEL_H
+
+#include <components/component.h>
+#include <unordered_map>
+#include <vector>
+
+namespace GUILib
+{
+	/**
+	* @brief An enumeration representing how a layout panel arranges its children.
+	* ROW places the children from left to right, COLUMN places them from top to bottom, and GRID places them from left to right in rows of
+	* a set number of columns.
+	*/
+	enum class LayoutDirection { ROW, COLUMN, GRID };
+
+	/**
+	* @brief An enumeration representing how the children of a row or column are distributed along it, when there is space left over and
+	* none of the children grow to fill it.
+	*/
+	enum class LayoutJustification { START, CENTER, END, SPACE_BETWEEN };
+
+	/**
+	* @brief An enumeration representing how the children are aligned across a row or column, or within their grid cell.
+	* Stretched children are resized to fill the space, refer to @ref GUILib::Component::ArrangeLayout().
+	*/
+	enum class LayoutAlignment { START, CENTER, END, STRETCH };
+
+	/**
+	* @brief This is a component class which positions its children in a row, column or grid, with padding around them and spacing between
+	* them. The panel doesn't take ownership of its children, so they still have to be added to the interface frame (after the panel).
+	*
+	* Measuring and arranging the children is cached, only the children which change size (or are added/removed) are measured again and the
+	* panel is only arranged again when its content or size changes. When the panel belongs to an interface frame, it is laid out during the
+	* interface frame's update, otherwise UpdateLayout() has to be called.
+	*
+	* Also, make sure that whenever you are using this class you are always allocating it on the heap, not the stack.
+	*/
+	class LIB_DECLSPEC LayoutPanel : public Component
+	{
+	public:
+		/**
+		* @brief This is the default class constructor.
+		* @param[in] direction - The direction in which the children are arranged.
+		*/
+		LayoutPanel(LayoutDirection direction = LayoutDirection::COLUMN);
+
+		/**
+		* @brief Adds a child to the end of the panel, the child is positioned relative to the panel from then on.
+		* @param[in] child - The component to be added.
+		* @param[in] grow - The share of the space left over along a row or column which the child grows to fill, 0 means it keeps its size.
+		*/
+		void AddChild(Component* child, float grow = 0.0f);
+
+		/**
+		* @brief Removes a child from the panel, the child isn't deleted.
+		* @param[in] child - The component to be removed.
+		*/
+		void RemoveChild(Component* child);
+
+		/**
+		* @brief Sets the direction in which the children are arranged.
+		* @param[in] direction - The new direction.
+		*/
+		void SetDirection(LayoutDirection direction);
+
+		/**
+		* @brief Sets the number of columns the children are arranged in, when the direction is GRID.
+		* @param[in] columns - The new number of columns, at least 1.
+		*/
+		void SetGridColumns(int columns);
+
+		/**
+		* @brief Sets the space between the edges of the panel and its children.
+		* @param[in] padding - The new padding.
+		*/
+		void SetPadding(int padding);
+
+		/**
+		* @brief Sets the space between neighbouring children.
+		* @param[in] spacing - The new spacing.
+		*/
+		void SetSpacing(int spacing);
+
+		/**
+		* @brief Sets how the children of a row or column are distributed along it.
+		* @param[in] justification - The new justification.
+		*/
+		void SetJustification(LayoutJustification justification);
+
+		/**
+		* @brief Sets how the children are aligned across a row or column, or within their grid cell.
+		* @param[in] alignment - The new alignment.
+		*/
+		void SetAlignment(LayoutAlignment alignment);
+
+		/**
+		* @brief Sets the position of the panel, which is the center of the panel.
+		* @param[in] pos - The new position of the panel.
+		*/
+		void SetPosition(glm::ivec2 pos) override;
+
+		/**
+		* @brief Sets the size of the panel, along each axis where the size given is 0 the panel fits its content instead.
+		* A panel within another panel can still be resized by its parent, if it is stretched or grows.
+		*
+		* @param[in] size - The new size of the panel.
+		*/
+		void SetSize(glm::ivec2 size);
+
+		/**
+		* @brief Sets whether or not the panel covers the whole viewport of the interface frame it belongs to, following the viewport as it
+		* is resized. This should be set before the panel is added to the interface frame.
+		*
+		* @param[in] fill - Specifies whether or not the panel fills the viewport.
+		*/
+		void SetFillViewport(bool fill);
+
+		/**
+		* @brief Lays out the children of the panel straight away, if the layout is out of date.
+		* This is done by the interface frame's update, so it only has to be called for panels which don't belong to an interface frame.
+		*/
+		void UpdateLayout();
+
+		/**
+		* @brief Lays out the children of the panel if the layout is out of date.
+		*/
+		void Update(float deltaTime) override;
+
+		/**
+		* @brief The panel itself isn't visible, so nothing is rendered.
+		*/
+		void Render(const Viewport& viewport) const override;
+
+		/**
+		* @brief Measures the panel, which is the size it fits its content with (along the axes where a size hasn't been set).
+		* @param[out] size - The size of the panel's box.
+		* @param[out] anchor - The offset of the panel's position from the top-left corner of its box.
+		* @return TRUE, as panels always have a size.
+		*/
+		bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const override;
+
+		/**
+		* @brief Resizes the panel to the size given by the panel arranging it, arranging its children again if the size has changed.
+		* @param[in] size - The new size of the panel.
+		*/
+		void ArrangeLayout(glm::ivec2 size) override;
+
+		/**
+		* @brief Resizes the panel to cover the viewport, if the panel fills the viewport.
+		* @param[in] viewport - The viewport of the interface frame the panel belongs to.
+		*/
+		void OnViewportResized(const Viewport& viewport) override;
+
+		/**
+		* @brief Returns whether or not the layout of the panel is out of date.
+		* @return TRUE if the children have to be arranged again, FALSE otherwise.
+		*/
+		bool IsLayoutDirty() const;
+
+		/**
+		* @brief Returns the position of the panel, which is the center of the panel.
+		* @return The position of the panel.
+		*/
+		const glm::ivec2& GetPosition() const override;
+
+		/**
+		* @brief Returns the size of the panel, as it was last laid out.
+		* @return The size of the panel.
+		*/
+		const glm::ivec2& GetSize() const;
+	protected:
+		void InitializeComponent() override;
+
+		/**
+		* @brief Measures the child again the next time the panel is laid out, the child is added to or removed from the panel if its parent
+		* has changed.
+		* @param[in] child - The child whose layout has changed.
+		*/
+		void OnChildLayoutInvalidated(Component* child) override;
+	private:
+		/**
+		* @brief A struct describing a child of the panel, along with the cached measurement of the child.
+		*/
+		struct LayoutItem
+		{
+			Component* component;
+			LayoutPanel* panel; // The child as a layout panel, or nullptr if it isn't one
+			float grow;
+			glm::ivec2 size, anchor; // The measured size of the child, and the offset of its position from its top-left corner
+			glm::ivec2 arrangedSize; // The size the child was last arranged with
+			bool hasSize, isMeasured;
+		};
+
+		/**
+		* @brief Marks the content of the panel as needing to be measured again, which the panel's parent is notified about.
+		*/
+		void InvalidateMeasure();
+
+		/**
+		* @brief Marks the children of the panel as needing to be arranged again.
+		*/
+		void InvalidateArrangement();
+
+		/**
+		* @brief Measures the children which aren't measured already, along with the size of the content (if it isn't already known).
+		*/
+		void Measure() const;
+
+		/**
+		* @brief Returns the size of the panel when it fits its content, along the axes where a size hasn't been set.
+		*/
+		glm::ivec2 GetDesiredSize() const;
+
+		/**
+		* @brief Arranges the children within the size given.
+		*/
+		void Arrange(glm::ivec2 size);
+
+		/**
+		* @brief Positions a child at the top-left corner given (relative to the panel's position), resizing it if the size given is
+		* different to the size it was last arranged with.
+		*/
+		void PlaceItem(LayoutItem& item, glm::ivec2 topLeft, glm::ivec2 size);
+	private:
+		LayoutDirection m_direction;
+		LayoutJustification m_justification;
+		LayoutAlignment m_alignment;
+		int m_gridColumns, m_padding, m_spacing;
+		bool m_fillViewport;
+
+		glm::ivec2 m_position, m_size, m_fixedSize;
+
+		// The children and their cached measurements, the measurements are updated lazily so that they can be measured by const methods
+		mutable std::vector<LayoutItem> m_items;
+		std::unordered_map<const Component*, size_t> m_itemIndices;
+		mutable std::vector<int> m_columnWidths, m_rowHeights; // The size of each grid column and row, when arranged as a grid
+		mutable glm::ivec2 m_contentSize; // The size of the children along with the padding and spacing
+		mutable bool m_isMeasureValid;
+
+		bool m_isLayoutDirty; // Whether or not the children have to be arranged again
+		bool m_isArranging; // Set while arranging the children, so that resizing them doesn't invalidate the layout again
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include <components/pointer_state_machine.h>
+#include <utilities/resource_loader.h>
+#include <utilities/input_system.h>
+#include <cfloat>
+
+namespace GUILib
+{
+	namespace
+	{
+		/**
+		* @brief Checks whether or not a pointer event was caused by the left mouse button, which is the button the state machine tracks.
+		* The input events carry the numbered mouse button codes, the left mouse button is the first one.
+		*/
+		bool IsLeftButtonEvent(const UIEvent& event)
+		{
+			return event.input && event.input->button == MouseButtonCode::MOUSE_BUTTON_1;
+		}
+	}
+
+	PointerStateMachine::PointerStateMachine() :
+		m_state(PointerState::IDLE), m_isHovered(false), m_isLongPressPending(false), m_pressPosition({ 0.0f, 0.0f }),
+		m_cursorPosition({ 0.0f, 0.0f }), m_pressTime(0.0), m_pressDuration(0.0f), m_lastClickPosition({ 0.0f, 0.0f }),
+		m_lastClickTime(-DBL_MAX)
+	{}
+
+	bool PointerStateMachine::HandleEvent(const UIEvent& event, PointerGesture& gestures)
+	{
+		gestures = PointerGesture::NONE;
+		switch (event.type)
+		{
+		case UIEventType::POINTER_ENTER:
+			m_isHovered = true;
+			if (m_state == PointerState::IDLE)
+				m_state = PointerState::HOVER;
+			else if (m_state == PointerState::CAPTURED)
+				m_state = PointerState::PRESSED;
+			return true;
+		case UIEventType::POINTER_LEAVE:
+			// The pointer stays captured by the component until it is released, even though it is no longer over the component
+			m_isHovered = false;
+			if (m_state == PointerState::HOVER)
+				m_state = PointerState::IDLE;
+			else if (m_state == PointerState::PRESSED)
+				m_state = PointerState::CAPTURED;
+			return true;
+		case UIEventType::POINTER_MOVE:
+			m_cursorPosition = event.cursorPosition;
+			if ((m_state == PointerState::PRESSED || m_state == PointerState::CAPTURED) &&
+				glm::length(m_cursorPosition - m_pressPosition) > ResourceConstants::pointerDragThreshold)
+			{
+				m_state = PointerState::DRAGGING;
+				m_isLongPressPending = false;
+				gestures = PointerGesture::DRAG_START;
+			}
+			return true;
+		case UIEventType::POINTER_DOWN:
+			if (!IsLeftButtonEvent(event))
+				return true;
+
+			// Pointer down events are dispatched to the component under the cursor, so the pointer is over the component
+			m_isHovered = true;
+			m_state = PointerState::PRESSED;
+			m_pressPosition = m_cursorPosition = event.cursorPosition;
+			m_pressTime = event.input->timestamp;
+			m_pressDuration = 0.0f;
+			m_isLongPressPending = true;
+			gestures = PointerGesture::PRESS;
+			return true;
+		case UIEventType::POINTER_UP:
+			if (!IsLeftButtonEvent(event) || !this->IsPressed())
+				return true;
+
+			gestures = PointerGesture::RELEASE;
+			if (m_state == PointerState::DRAGGING)
+			{
+				gestures = gestures | PointerGesture::DRAG_END;
+			}
+			else if (m_state == PointerState::PRESSED && m_isLongPressPending) // Long presses and presses released elsewhere aren't clicks
+			{
+				gestures = gestures | PointerGesture::CLICK;
+				if (m_pressTime - m_lastClickTime <= ResourceConstants::pointerDoubleClickInterval &&
+					glm::length(m_pressPosition - m_lastClickPosition) <= ResourceConstants::pointerDragThreshold)
+				{
+					// The click after a double-click starts a new double-click, rather than being one too
+					gestures = gestures | PointerGesture::DOUBLE_CLICK;
+					m_lastClickTime = -DBL_MAX;
+				}
+				else
+				{
+					m_lastClickTime = m_pressTime;
+					m_lastClickPosition = m_pressPosition;
+				}
+			}
+
+			m_state = m_isHovered ? PointerState::HOVER : PointerState::IDLE;
+			m_isLongPressPending = false;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	PointerGesture PointerStateMachine::Update(float deltaTime)
+	{
+		// The press is only timed while the pointer is over the component, a long press can't happen after it left the component
+		if (!m_isLongPressPending || m_state != PointerState::PRESSED)
+			return PointerGesture::NONE;
+
+		m_pressDuration += deltaTime;
+		if (m_pressDuration < ResourceConstants::pointerLongPressDuration)
+			return PointerGesture::NONE;
+
+		m_isLongPressPending = false;
+		return PointerGesture::LONG_PRESS;
+	}
+
+	void PointerStateMachine::Reset()
+	{
+		m_state = PointerState::IDLE;
+		m_isHovered = m_isLongPressPending = false;
+		m_lastClickTime = -DBL_MAX;
+	}
+
+	PointerState PointerStateMachine::GetState() const { return m_state; }
+
+	VisualState PointerStateMachine::GetVisualState() const
+	{
+		if (m_state == PointerState::PRESSED || (m_state == PointerState::DRAGGING && m_isHovered))
+			return VisualState::CLICKED;
+
+		return m_isHovered ? VisualState::HOVERED : VisualState::BASE;
+	}
+
+	void PointerStateMachine::ApplyVisualState(VisualStateTable::Handle visualState, PointerGesture gestures) const
+	{
+		VisualStateTable::GetInstance().SetState(visualState, this->GetVisualState(), gestures & PointerGesture::RELEASE);
+	}
+
+	bool PointerStateMachine::IsHovered() const { return m_isHovered; }
+
+	bool PointerStateMachine::IsPressed() const
+	{
+		return m_state == PointerState::PRESSED || m_state == PointerState::CAPTURED || m_state == PointerState::DRAGGING;
+	}
+
+	bool PointerStateMachine::IsUpdateRequired() const { return m_isLongPressPending && m_state == PointerState::PRESSED; }
+
+	glm::vec2 PointerStateMachine::GetDragOffset() const { return this->IsPressed() ? m_cursorPosition - m_pressPosition : glm::vec2(0.0f); }
+
+	PointerEventRouter::PointerEventRouter() :
+		m_hoveredChild(nullptr), m_capturedChild(nullptr), m_cursorPosition({ 0.0f, 0.0f })
+	{}
+
+	bool PointerEventRouter::Route(const UIEvent& event, Component* childUnderCursor)
+	{
+		m_cursorPosition = event.cursorPosition;
+
+		// Send the leave and enter events first, the hovered child changes whenever the cursor moves onto another child (or off the host)
+		Component* hoveredChild = event.type == UIEventType::POINTER_LEAVE ? nullptr : childUnderCursor;
+		if (hoveredChild != m_hoveredChild)
+		{
+			if (m_hoveredChild)
+				m_hoveredChild->HandleEvent({ UIEventType::POINTER_LEAVE, m_hoveredChild, m_cursorPosition, nullptr });
+
+			m_hoveredChild = hoveredChild;
+			if (m_hoveredChild)
+				m_hoveredChild->HandleEvent({ UIEventType::POINTER_ENTER, m_hoveredChild, m_cursorPosition, nullptr });
+		}
+
+		Component* target = nullptr;
+		switch (event.type)
+		{
+		case UIEventType::POINTER_MOVE:
+			target = m_capturedChild ? m_capturedChild : m_hoveredChild;
+			break;
+		case UIEventType::POINTER_DOWN:
+			// The pressed child captures the pointer, so it receives the release even if the cursor has left it
+			if (!m_capturedChild)
+				m_capturedChild = m_hoveredChild;
+
+			target = m_hoveredChild;
+			break;
+		case UIEventType::POINTER_UP:
+			target = m_capturedChild ? m_capturedChild : m_hoveredChild;
+			m_capturedChild = nullptr;
+			break;
+		case UIEventType::POINTER_SCROLL:
+			target = m_hoveredChild;
+			break;
+		default:
+			return false;
+		}
+
+		return target && target->HandleEvent({ event.type, target, event.cursorPosition, event.input });
+	}
+
+	void PointerEventRouter::Reset()
+	{
+		if (m_hoveredChild)
+			m_hoveredChild->HandleEvent({ UIEventType::POINTER_LEAVE, m_hoveredChild, m_cursorPosition, nullptr });
+
+		m_hoveredChild = m_capturedChild = nullptr;
+	}
+
+	Component* PointerEventRouter::GetHoveredChild() const { return m_hoveredChild; }
+
+	Component* PointerEventRouter::GetCapturedChild() const { return m_capturedChild; }
+
+	bool PointerEventRouter::HitTest(const Component* child, glm::vec2 point)
+	{
+		glm::vec2 min, max;
+		return child->IsEnabled() && child->GetInteractionBounds(min, max) && point.x >= min.x && point.x <= max.x && point.y >= min.y &&
+			point.y <= max.y;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,190 @@
+#ifndef POINTER_STATE_MACHINE_H
+#define POINTER_STATE_MACHINE_H
+
+#include <components/component.h>
+#include <components/visual_state_table.h>
+
+namespace GUILib
+{
+	/**
+	* @brief An enumeration representing the states of the pointer (the mouse cursor and its left button) relative to a UI component.
+	* A captured pointer was pressed on the component and has since left it, while a dragging pointer has moved far enough since it was
+	* pressed for the press not to count as a click.
+	*/
+	enum class PointerState : uint8_t { IDLE, HOVER, PRESSED, CAPTURED, DRAGGING };
+
+	/**
+	* @brief An enumeration representing the gestures detected by a pointer state machine, several of them can be detected by the same event.
+	*/
+	enum class PointerGesture : uint8_t
+	{
+		NONE = 0,
+		PRESS = 1,
+		RELEASE = 2,
+		CLICK = 4,
+		DOUBLE_CLICK = 8,
+		LONG_PRESS = 16,
+		DRAG_START = 32,
+		DRAG_END = 64
+	};
+
+	static inline PointerGesture operator|(PointerGesture left, PointerGesture right)
+	{
+		return (PointerGesture)((int)left | (int)right);
+	}
+
+	static inline bool operator&(PointerGesture left, PointerGesture right)
+	{
+		return ((int)left & (int)right) == (int)right;
+	}
+
+	/**
+	* @brief This is a class which tracks the pointer's interaction with a single UI component, each interactive component owns one.
+	*
+	* The state machine is only driven by the pointer events dispatched to its component (so by the edges of the input, rather than by polling
+	* the mouse button each frame) and turns them into gestures: clicks (a press and release without dragging), double-clicks and long
+	* presses. Only a pending long press has to be timed, so components only need updating while IsUpdateRequired() is TRUE.
+	*/
+	class LIB_DECLSPEC PointerStateMachine
+	{
+	public:
+		PointerStateMachine();
+
+		~PointerStateMachine() = default;
+
+		/**
+		* @brief Advances the state machine by a pointer event dispatched to its component.
+		*
+		* @param[in] event - The dispatched event.
+		* @param[out] gestures - The gestures detected by the event.
+		* @return TRUE if the event is a pointer event which the state machine consumes (scroll events aren't), FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event, PointerGesture& gestures);
+
+		/**
+		* @brief Times the pending long press, if the pointer is pressed on the component.
+		* @param[in] deltaTime - The elapsed time between the previous and current frame.
+		* @return The gestures detected, which is either LONG_PRESS or NONE.
+		*/
+		PointerGesture Update(float deltaTime);
+
+		/**
+		* @brief Resets the state machine to the idle state, forgetting the press and the previous click.
+		*/
+		void Reset();
+
+		/**
+		* @brief Returns the current state of the pointer relative to the component.
+		* @return The pointer state.
+		*/
+		PointerState GetState() const;
+
+		/**
+		* @brief Returns the visual state which the component displays in the current pointer state, the component is displayed as clicked
+		* while the pointer is pressed on it.
+		* @return The visual state.
+		*/
+		VisualState GetVisualState() const;
+
+		/**
+		* @brief Displays the visual state of the current pointer state (see GetVisualState()) in the visual state table.
+		* The visual state table fades between the colors, except when the pointer is released, which displays the hovered colors straight away.
+		*
+		* @param[in] visualState - The component's entry in the visual state table.
+		* @param[in] gestures - The gestures detected by the latest event or update of the state machine.
+		*/
+		void ApplyVisualState(VisualStateTable::Handle visualState, PointerGesture gestures) const;
+
+		/**
+		* @brief Returns whether or not the pointer is over the component.
+		* @return TRUE if the pointer is over the component, FALSE otherwise.
+		*/
+		bool IsHovered() const;
+
+		/**
+		* @brief Returns whether or not the pointer was pressed on the component and hasn't been released yet.
+		* @return TRUE if the pointer is pressed, captured or dragging, FALSE otherwise.
+		*/
+		bool IsPressed() const;
+
+		/**
+		* @brief Returns whether or not the component has to be updated, which is only while a long press is pending.
+		* @return TRUE if Update() has to be called each frame, FALSE otherwise.
+		*/
+		bool IsUpdateRequired() const;
+
+		/**
+		* @brief Returns the offset of the pointer from the position where it was pressed.
+		* @return The offset of the pointer, which is zero when it isn't pressed.
+		*/
+		glm::vec2 GetDragOffset() const;
+	private:
+		PointerState m_state;
+		bool m_isHovered, m_isLongPressPending;
+
+		glm::vec2 m_pressPosition, m_cursorPosition;
+		double m_pressTime;
+		float m_pressDuration;
+
+		// The press of the previous click, a click pressed soon enough after it (and close enough to it) is a double-click
+		glm::vec2 m_lastClickPosition;
+		double m_lastClickTime;
+	};
+
+	/**
+	* @brief This is a class which routes the pointer events received by a component to the child components that it hosts itself (such as
+	* the options of a radio group or a drop-down), as the interface frame only dispatches events to the components added to it.
+	*
+	* The child under the cursor is given enter and leave events as the cursor moves between the children, and the child which the pointer
+	* was pressed on captures the pointer until it is released, the same way as the interface frame does.
+	*/
+	class LIB_DECLSPEC PointerEventRouter
+	{
+	public:
+		PointerEventRouter();
+
+		~PointerEventRouter() = default;
+
+		/**
+		* @brief Routes a pointer event received by the hosting component to its children.
+		*
+		* @param[in] event - The event received by the hosting component.
+		* @param[in] childUnderCursor - The child under the cursor (see HitTest()), or nullptr if there isn't one.
+		* @return TRUE if the child which the event was routed to handled it, FALSE otherwise.
+		*/
+		bool Route(const UIEvent& event, Component* childUnderCursor);
+
+		/**
+		* @brief Sends a leave event to the hovered child, then forgets the hovered and captured children. This must be called when the
+		* children stop receiving events, such as when they are hidden or removed.
+		*/
+		void Reset();
+
+		/**
+		* @brief Returns the child under the cursor, which was last sent an enter event.
+		* @return The hovered child, or nullptr if the cursor isn't over any child.
+		*/
+		Component* GetHoveredChild() const;
+
+		/**
+		* @brief Returns the child which has captured the pointer.
+		* @return The child which the pointer was pressed on, or nullptr if the pointer isn't pressed on any child.
+		*/
+		Component* GetCapturedChild() const;
+
+		/**
+		* @brief Checks whether or not a point is within the interaction bounds of an enabled child.
+		*
+		* @param[in] child - The child to be tested.
+		* @param[in] point - The point to be tested, relative to the window.
+		* @return TRUE if the child is enabled and contains the point, FALSE otherwise.
+		*/
+		static bool HitTest(const Component* child, glm::vec2 point);
+	private:
+		Component* m_hoveredChild;
+		Component* m_capturedChild;
+		glm::vec2 m_cursorPosition;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -28,7 +28,7 @@ namespace GUILib
 		* @brief Sets the current position of the push button component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the current size of the push button component.
@@ -75,14 +75,18 @@ namespace GUILib
 		* 
 		* @return The push button text color attached to the specified event.
 		*/
-		const glm::vec4& GetTextColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetTextColor(ComponentEvent eventEnum) const;
 	protected:
 		/**
 		* @brief Initialises the push button component.
 		*/
 		virtual void InitializeComponent() override;
 	private:
-		glm::vec4 m_baseTextColor, m_hoverTextColor, m_clickedTextColor, m_currentTextColor;
+		/**
+		* @brief Updates the text's position relative to the button, so that the text is centered within the button.
+		*/
+		void UpdateTextPosition();
+	private:
 		Label* m_text;
 	};
 }
@@ -1,16 +1,16 @@
 #include <components/radio_button.h>
-#include <graphics/animation.h>
-#include <utilities/input_system.h>
 #include <external/glm/glm/gtc/matrix_transform.hpp>
 
 namespace GUILib
 {
 	RadioButton::RadioButton() :
-		m_isSelected(false), m_clicked(false)
+		m_visualState(VisualStateTable::GetInstance().Create(2)), m_isSelected(false), m_clicked(false), m_isClickPending(false)
 	{
 		this->InitializeComponent();
 	}
 
+	RadioButton::~RadioButton() { VisualStateTable::GetInstance().Destroy(m_visualState); }
+
 	void RadioButton::InitializeComponent()
 	{
 		m_shaders = ResourceLoader::GetInstance().GetShaders("Geometry");
@@ -19,11 +19,11 @@ namespace GUILib
 		m_position = { 0, 0 };
 		m_diameter = 30;
 
-		m_currentColor = m_baseColor = { 0.6f, 0.6, 0.6f, 1.0f };
-		m_hoverColor = { 0.8f, 0.8f, 0.8f, 1.0f };
-		m_clickedColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+		this->SetColor({ 0.6f, 0.6, 0.6f, 1.0f }, ComponentEvent::NO_EVENT);
+		this->SetColor({ 0.8f, 0.8f, 0.8f, 1.0f }, ComponentEvent::HOVERED_EVENT);
+		this->SetColor({ 1.0f, 1.0f, 1.0f, 1.0f }, ComponentEvent::CLICKED_EVENT);
 
-		m_currentBorderColor = m_baseBorderColor = m_hoverBorderColor = m_clickedBorderColor = { 0.0f, 0.0f, 0.0f, 1.0f };
+		this->SetBorderColor({ 0.0f, 0.0f, 0.0f, 1.0f }, ComponentEvent::NO_EVENT | ComponentEvent::HOVERED_EVENT | ComponentEvent::CLICKED_EVENT);
 		m_borderThickness = 4;
 
 		m_dotMarkColor = { 1.0f, 0.0f, 0.0f, 1.0f };
@@ -31,85 +31,76 @@ namespace GUILib
 
 	void RadioButton::SetSelected(bool selected) { m_isSelected = selected; }
 
-	void RadioButton::SetPosition(glm::ivec2 pos) { m_position = pos; }
+	void RadioButton::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->UpdateSpatialIndexEntry();
+		this->MarkChildTransformsDirty();
+	}
 
-	void RadioButton::SetDiameter(int diameter) { m_diameter = diameter; }
+	void RadioButton::SetDiameter(int diameter)
+	{
+		m_diameter = diameter;
+		this->UpdateSpatialIndexEntry();
+		this->InvalidateLayout();
+	}
 
 	void RadioButton::SetColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentColor = m_baseColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::FILL_CHANNEL, color, eventEnum);
 	}
 
 	void RadioButton::SetBorderColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentBorderColor = m_baseBorderColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverBorderColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedBorderColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, color, eventEnum);
+	}
+
+	void RadioButton::SetColorAnimation(const ColorAnimation& animation)
+	{
+		VisualStateTable::GetInstance().SetAnimation(m_visualState, VisualStateTable::FILL_CHANNEL, animation);
 	}
 
+	void RadioButton::StopColorAnimation() { VisualStateTable::GetInstance().StopAnimation(m_visualState, VisualStateTable::FILL_CHANNEL); }
+
 	void RadioButton::SetBorderThickness(int thickness) { m_borderThickness = thickness; }
 
 	void RadioButton::SetDotMarkColor(glm::vec4 color) { m_dotMarkColor = color; }
 
-	bool RadioButton::IsCursorHovering() const
+	bool RadioButton::GetInteractionBounds(glm::vec2& min, glm::vec2& max) const
 	{
-		const glm::ivec2& cursorPosition = InputSystem::GetInstance().GetCursorPosition();
-		const glm::vec2 difference = m_position - cursorPosition;
-		
-		return glm::length(difference) <= (m_diameter / 2.0f);
+		min = glm::vec2(m_position) - (m_diameter / 2.0f);
+		max = glm::vec2(m_position) + (m_diameter / 2.0f);
+		return true;
 	}
 
 	void RadioButton::Update(float deltaTime)
 	{
-		static bool isButtonHeld = false;
-		m_clicked = false;
+		// A click handled since the previous update is reported by WasClicked() until the next update, the rest of the pointer interaction
+		// is driven by the events handled
+		m_clicked = m_isClickPending;
+		m_isClickPending = false;
 
-		if (this->IsCursorHovering())
-		{
-			if (InputSystem::GetInstance().WasMouseButtonPressed(MouseButtonCode::MOUSE_BUTTON_LEFT))
-			{
-				m_currentColor = m_clickedColor;
-				m_currentBorderColor = m_clickedBorderColor;
-
-				// A button click can span several frames, so prevent the repeatedly checked switches
-				if (!isButtonHeld)
-					m_clicked = true;
-
-				isButtonHeld = true;
-			}
-			else
-			{
-				if (isButtonHeld)
-				{
-					m_currentColor = m_hoverColor;
-					m_currentBorderColor = m_hoverBorderColor;
-				}
-				else
-				{
-					m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_baseColor, m_hoverColor, 8.0f, deltaTime);
-					m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_baseBorderColor, m_hoverBorderColor, 8.0f, deltaTime);
-				}
-
-				isButtonHeld = false;
-			}
-		}
-		else
-		{
-			m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_hoverColor, m_baseColor, 8.0f, deltaTime);
-			m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_hoverBorderColor, m_baseBorderColor, 8.0f, deltaTime);
-		}
+		this->ApplyPointerGestures(m_pointerState.Update(deltaTime));
+		this->SetUpdateRequired(m_clicked || m_pointerState.IsUpdateRequired());
+	}
+
+	bool RadioButton::HandleEvent(const UIEvent& event)
+	{
+		PointerGesture gestures;
+		const bool isHandled = m_pointerState.HandleEvent(event, gestures);
+		this->ApplyPointerGestures(gestures);
+
+		// A click is reported by the next update, which also times a pending long press
+		if (m_isClickPending || m_pointerState.IsUpdateRequired())
+			this->SetUpdateRequired(true);
+
+		return isHandled;
 	}
 
 	void RadioButton::Render(const Viewport& viewport) const
 	{
+		const VisualStateTable& visualStates = VisualStateTable::GetInstance();
+
 		/// Render the border first ///
 		// Construct the model matrix
 		glm::mat4 modelMatrix = glm::mat4(1.0f);
@@ -121,7 +112,7 @@ namespace GUILib
 		m_shaders->SetUniform("useTextures", false);
 		m_shaders->SetUniformGLM("model", modelMatrix);
 		m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
-		m_shaders->SetUniformGLM("color", m_currentBorderColor);
+		visualStates.SetColorUniforms(m_visualState, VisualStateTable::BORDER_CHANNEL, *m_shaders);
 
 		m_geometry.vao->Bind();
 		glDrawArrays(GL_TRIANGLE_FAN, 0, (int)(360.0f / ResourceConstants::circleGeoemtryAngleStep) + 2);
@@ -134,11 +125,12 @@ namespace GUILib
 
 		// Setup the required shader uniforms
 		m_shaders->SetUniformGLM("model", modelMatrix);
-		m_shaders->SetUniformGLM("color", m_currentColor);
+		visualStates.SetColorUniforms(m_visualState, VisualStateTable::FILL_CHANNEL, *m_shaders);
 
 		// Render the checkbox
 		m_geometry.vao->Bind();
 		glDrawArrays(GL_TRIANGLE_FAN, 0, (int)(360.0f / ResourceConstants::circleGeoemtryAngleStep) + 2);
+		visualStates.ResetColorUniforms(m_visualState, *m_shaders);
 
 		if (m_isSelected) // Render the dot mark if the radio button is selected
 		{
@@ -164,31 +156,25 @@ namespace GUILib
 
 	const int& RadioButton::GetDiameter() const { return m_diameter; }
 
-	const glm::vec4& RadioButton::GetColor(ComponentEvent eventEnum) const
+	glm::vec4 RadioButton::GetColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedColor;
-		}
-
-		return m_baseColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::FILL_CHANNEL, eventEnum);
 	}
 
-	const glm::vec4& RadioButton::GetBorderColor(ComponentEvent eventEnum) const
+	glm::vec4 RadioButton::GetBorderColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseBorderColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverBorderColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedBorderColor;
-		}
-
-		return m_baseBorderColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, eventEnum);
 	}
 
 	const int& RadioButton::GetBorderThickness() const { return m_borderThickness; }
 
 	const glm::vec4& RadioButton::GetDotMarkColor() const { return m_dotMarkColor; }
+
+	void RadioButton::ApplyPointerGestures(PointerGesture gestures)
+	{
+		m_pointerState.ApplyVisualState(m_visualState, gestures);
+
+		if (gestures & PointerGesture::CLICK)
+			m_isClickPending = true;
+	}
 }
@@ -2,6 +2,8 @@
 #define RADIO_BUTTON_H
 
 #include <components/component.h>
+#include <components/visual_state_table.h>
+#include <components/pointer_state_machine.h>
 
 namespace GUILib
 {
@@ -17,7 +19,10 @@ namespace GUILib
 		*/
 		RadioButton();
 
-		~RadioButton() = default;
+		/**
+		* @brief Destroys the radio button's entry in the visual state table.
+		*/
+		~RadioButton();
 
 		/**
 		* @brief Sets whether the radio button is selected or not.
@@ -29,7 +34,7 @@ namespace GUILib
 		* @brief Sets the current position of the radio button component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the current diameter of the radio button component.
@@ -54,6 +59,19 @@ namespace GUILib
 		*/
 		void SetBorderColor(glm::vec4 color, ComponentEvent eventEnum);
 
+		/**
+		* @brief Animates the radio button color with a color animation, which is displayed in place of the colors of the component events
+		* until it is stopped. The animation is evaluated on the GPU, so continuous effects (such as pulsing) don't require the component
+		* to be updated.
+		* @param[in] animation - The animation descriptor, its start time is on the tween manager's clock.
+		*/
+		void SetColorAnimation(const ColorAnimation& animation);
+
+		/**
+		* @brief Stops the radio button color animation, the colors of the component events are displayed again.
+		*/
+		void StopColorAnimation();
+
 		/**
 		* @brief Sets the border thickness of this radio button component.
 		* @param[in] thickness - The new border thickness of the component.
@@ -71,6 +89,13 @@ namespace GUILib
 		*/
 		void Update(float deltaTime) override;
 
+		/**
+		* @brief Handles the pointer events dispatched to the radio button component, which drive its pointer state machine.
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the event is a pointer event (other than scrolling), FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event) override;
+
 		/**
 		* @brief Renders the radio button component.
 		* @param[in] viewport - The viewport where the component is being rendered to.
@@ -85,6 +110,7 @@ namespace GUILib
 
 		/**
 		* @brief Returns whether or not the radio button was clicked.
+		* A click is reported from the update following the click until the next update.
 		* @return TRUE if clicked, FALSE otherwise.
 		*/
 		bool WasClicked() const;
@@ -93,7 +119,16 @@ namespace GUILib
 		* @brief Returns the current position of the radio button component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
+
+		/**
+		* @brief Retrieves the bounds of the radio button component (the square enclosing the button), these are used for hit testing.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, as radio buttons always respond to the cursor.
+		*/
+		bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const override;
 
 		/**
 		* @brief Returns the diameter of the radio button component.
@@ -108,7 +143,7 @@ namespace GUILib
 		*
 		* @return The radio button color attached to the specified event.
 		*/
-		const glm::vec4& GetColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the radio button border color which is displayed when the specified component event occurs.
@@ -117,7 +152,7 @@ namespace GUILib
 		*
 		* @return The radio button border color attached to the specified event.
 		*/
-		const glm::vec4& GetBorderColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetBorderColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the thickness of the radio button component's border.
@@ -137,18 +172,18 @@ namespace GUILib
 		void InitializeComponent() override;
 
 		/**
-		* @brief Checks if the cursor is hovering on the radio button.
-		* @return TRUE if cursor is hovering on radio button, FALSE otherwise.
+		* @brief Displays the visual state of the radio button's pointer state, and applies the gestures given.
+		* @param[in] gestures - The gestures detected by the radio button's pointer state machine.
 		*/
-		bool IsCursorHovering() const;
+		void ApplyPointerGestures(PointerGesture gestures);
 	protected:
 		glm::ivec2 m_position;
-		glm::vec4 m_baseColor, m_hoverColor, m_clickedColor, m_currentColor;
-		glm::vec4 m_baseBorderColor, m_hoverBorderColor, m_clickedBorderColor, m_currentBorderColor;
+		VisualStateTable::Handle m_visualState; // The radio button's colors, stored in the visual state table's FILL and BORDER channels
 		glm::vec4 m_dotMarkColor;
 		int m_diameter, m_borderThickness;
 
-		bool m_isSelected, m_clicked;
+		PointerStateMachine m_pointerState;
+		bool m_isSelected, m_clicked, m_isClickPending; // A click is pending from when it is handled until the next update
 	};
 }
 
@@ -21,19 +21,19 @@ namespace GUILib
 
 	void RadioGroup::CalculatePosition(RadioButtonOption& option, int index)
 	{
+		// The options are positioned relative to the group, so they only have to be recalculated when the options themselves change
 		if (index > 0)
 		{
 			const RadioButtonOption& lastOption = m_options[(size_t)index - 1];
 
-			option.button->SetPosition({
-				lastOption.text->GetPosition().x + lastOption.text->GetSize().x + (option.button->GetDiameter() / 2) + m_spacing,
-				m_position.y });
+			option.button->SetLocalPosition({
+				lastOption.text->GetLocalPosition().x + lastOption.text->GetSize().x + (option.button->GetDiameter() / 2) + m_spacing, 0 });
 		}
 		else
-			option.button->SetPosition({ m_position.x + (option.button->GetDiameter() / 2), m_position.y });
+			option.button->SetLocalPosition({ option.button->GetDiameter() / 2, 0 });
 
-		option.text->SetPosition({ option.button->GetPosition().x + (option.button->GetDiameter() / 2) + 10,
-				m_position.y + (option.text->GetSize().y / 2) });
+		option.text->SetLocalPosition({ option.button->GetLocalPosition().x + (option.button->GetDiameter() / 2) + 10,
+			option.text->GetSize().y / 2 });
 	}
 
 	void RadioGroup::AddOption(RadioButtonOption option)
@@ -49,9 +49,14 @@ namespace GUILib
 		if (option.valueID < 0)
 			return;
 
-		// Add the new option to the group
+		// Add the new option to the group, the option follows the group around and events which the option's button doesn't handle bubble
+		// up to the group
+		option.button->SetParent(this);
+		option.text->SetParent(this);
 		this->CalculatePosition(option, m_options.size());
 		m_options.emplace_back(option);
+		this->UpdateSpatialIndexEntry();
+		this->InvalidateLayout();
 	}
 
 	void RadioGroup::RemoveOption(int valueID)
@@ -60,7 +65,14 @@ namespace GUILib
 		{
 			if (it->valueID == valueID)
 			{
+				// The removed option's radio button mustn't be routed any more events
+				m_pointerRouter.Reset();
+
+				it->button->SetParent(nullptr);
+				it->text->SetParent(nullptr);
 				m_options.erase(it);
+				this->UpdateSpatialIndexEntry();
+				this->InvalidateLayout();
 				break;
 			}
 		}
@@ -96,28 +108,29 @@ namespace GUILib
 	void RadioGroup::SetPosition(glm::ivec2 pos) 
 	{ 
 		m_position = pos; 
-
-		// Update the positions of all radio button options in the group
-		for (int i = 0; i < m_options.size(); i++)
-			this->CalculatePosition(m_options[i], i);
+		this->UpdateSpatialIndexEntry();
+		this->MarkChildTransformsDirty();
 	}
 
 	void RadioGroup::Update(float deltaTime)
 	{
-		// Check if any radio buttons were selected
-		bool optionSelected = false;
+		// Check if any radio buttons were selected, the group only has to be updated while any of its radio buttons do
+		bool optionSelected = false, isUpdateRequired = false;
 		for (auto& option : m_options)
 		{
 			option.button->Update(deltaTime);
-			if (option.button->WasClicked())
+			isUpdateRequired |= option.button->IsUpdateRequired();
+
+			if (option.button->WasClicked() && !optionSelected)
 			{
 				option.button->SetSelected(true);
 				m_currentSelected = option.valueID;
 				optionSelected = true;
-				break;
 			}
 		}
 
+		this->SetUpdateRequired(isUpdateRequired);
+
 		// If a radio button was selected, unselect any other which was previously selected
 		if (optionSelected)
 		{
@@ -129,6 +142,33 @@ namespace GUILib
 		}
 	}
 
+	bool RadioGroup::HandleEvent(const UIEvent& event)
+	{
+		RadioButton* hoveredButton = nullptr;
+		for (const auto& option : m_options)
+		{
+			if (PointerEventRouter::HitTest(option.button, event.cursorPosition))
+			{
+				hoveredButton = option.button;
+				break;
+			}
+		}
+
+		const bool isHandled = m_pointerRouter.Route(event, hoveredButton);
+
+		// The radio buttons aren't added to the interface frame, so the group is woken to update them when any of them has to be updated
+		for (const auto& option : m_options)
+		{
+			if (option.button->IsUpdateRequired())
+			{
+				this->SetUpdateRequired(true);
+				break;
+			}
+		}
+
+		return isHandled;
+	}
+
 	void RadioGroup::Render(const Viewport& viewport) const
 	{
 		for (const auto& option : m_options)
@@ -141,4 +181,20 @@ namespace GUILib
 	const int& RadioGroup::GetSelectedOption() const { return m_currentSelected; }
 
 	const glm::ivec2& RadioGroup::GetPosition() const { return m_position; }
+
+	bool RadioGroup::GetInteractionBounds(glm::vec2& min, glm::vec2& max) const
+	{
+		// The bounds are measured from the local positions of the radio buttons, as they may not have been repositioned yet
+		min = max = glm::vec2(m_position);
+		for (const auto& option : m_options)
+		{
+			const glm::vec2 buttonPosition = glm::vec2(m_position + option.button->GetLocalPosition());
+			const float radius = option.button->GetDiameter() / 2.0f;
+
+			min = glm::min(min, buttonPosition - radius);
+			max = glm::max(max, buttonPosition + radius);
+		}
+
+		return true;
+	}
 }
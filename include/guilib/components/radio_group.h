@@ -51,13 +51,21 @@ namespace GUILib
 		* @brief Sets the current position of the radio group component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Updates the logic of the radio group component.
 		*/
 		void Update(float deltaTime) override;
 
+		/**
+		* @brief Routes the pointer events dispatched to the radio group to the radio button under the cursor, as the options' radio buttons
+		* aren't added to the interface frame themselves.
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the radio button which the event was routed to handled it, FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event) override;
+
 		/**
 		* @brief Renders the radio group component.
 		* @param[in] viewport - The viewport where the component is being rendered to.
@@ -74,7 +82,16 @@ namespace GUILib
 		* @brief Returns the current position of the radio group component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
+
+		/**
+		* @brief Retrieves the bounds enclosing the options' radio buttons, these are used for hit testing.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, as radio groups always respond to the cursor (the bounds are empty if the group has no options).
+		*/
+		bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const override;
 	private:
 		/**
 		* @brief Initialises the radio group component.
@@ -91,6 +108,8 @@ namespace GUILib
 		glm::ivec2 m_position;
 		std::vector<RadioButtonOption> m_options;
 		int m_spacing, m_currentSelected;
+
+		PointerEventRouter m_pointerRouter;
 	};
 }
 
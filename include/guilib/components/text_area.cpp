@@ -0,0 +1,583 @@
+#include <components/text_area.h>
+#include <utilities/input_system.h>
+#include <utilities/utf8.h>
+#include <external/glm/glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace GUILib
+{
+	namespace
+	{
+		/**
+		* @brief Returns the byte offset of the codepoint before the offset given within the UTF-8 encoded text given.
+		*/
+		size_t GetPreviousCodepoint(std::string_view text, size_t offset)
+		{
+			if (offset == 0)
+				return 0;
+
+			do
+			{
+				offset--;
+			} while (offset > 0 && ((uint8_t)text[offset] & 0xC0) == 0x80);
+
+			return offset;
+		}
+
+		/**
+		* @brief Returns the byte offset of the codepoint after the offset given within the UTF-8 encoded text given.
+		*/
+		size_t GetNextCodepoint(std::string_view text, size_t offset)
+		{
+			if (offset >= text.size())
+				return text.size();
+
+			do
+			{
+				offset++;
+			} while (offset < text.size() && ((uint8_t)text[offset] & 0xC0) == 0x80);
+
+			return offset;
+		}
+	}
+
+	TextArea::TextArea(const Font* font, float fontSize) :
+		m_font(font), m_fontSize(fontSize), m_scrollOffset(0.0f), m_caretLine(0), m_caretColumn(0), m_caretPosition({ 0.0f, 0.0f }),
+		m_repeatKey(KeyCode::KEY_LAST), m_cursorPosition({ 0.0f, 0.0f }), m_inputEnabled(true), m_documentChanged(true),
+		m_isCursorHovering(false), m_isPressed(false)
+	{
+		this->InitializeComponent();
+	}
+
+	TextArea::~TextArea()
+	{
+		for (Label* label : m_lineLabels)
+			delete label;
+	}
+
+	void TextArea::InitializeComponent()
+	{
+		m_shaders = ResourceLoader::GetInstance().GetShaders("Geometry");
+		m_geometry = *ResourceLoader::GetInstance().GetGeometry("Square");
+
+		m_position = { 0, 0 };
+		m_size = { 400, 300 };
+
+		m_color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		m_textColor = { 0.0f, 0.0f, 0.0f, 1.0f };
+		m_borderColor = { 0.2f, 0.2f, 0.2f, 1.0f };
+		m_borderThickness = 4;
+		m_padding = 8;
+	}
+
+	void TextArea::SetInputState(bool enabled) { m_inputEnabled = enabled; }
+
+	void TextArea::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->UpdateSpatialIndexEntry();
+		this->MarkChildTransformsDirty();
+		this->SetUpdateRequired(true); // The line labels are repositioned by the update
+	}
+
+	void TextArea::SetSize(glm::ivec2 size)
+	{
+		m_size = size;
+		this->UpdateSpatialIndexEntry();
+		this->InvalidateLayout();
+		this->SetUpdateRequired(true);
+	}
+
+	void TextArea::SetText(std::string_view text)
+	{
+		m_document.SetText(text);
+		m_documentChanged = true;
+
+		m_scrollOffset = 0.0f;
+		this->MoveCaret(0, 0);
+		this->SetUpdateRequired(true);
+	}
+
+	void TextArea::SetColor(glm::vec4 color) { m_color = color; }
+
+	void TextArea::SetTextColor(glm::vec4 color)
+	{
+		m_textColor = color;
+		this->SetUpdateRequired(true); // The line labels are assigned the text color by the update
+	}
+
+	void TextArea::SetBorderColor(glm::vec4 color) { m_borderColor = color; }
+
+	void TextArea::SetBorderThickness(int thickness) { m_borderThickness = thickness; }
+
+	void TextArea::ScrollToLine(size_t line)
+	{
+		m_scrollOffset = line * this->GetLineHeight();
+		this->ClampScrollOffset();
+		this->SetUpdateRequired(true);
+	}
+
+	bool TextArea::HandleEvent(const UIEvent& event)
+	{
+		// Events bubbling up from child components carry no pointer state of the text area's own
+		if (event.target != this || !m_font || m_fontSize <= 0.0f)
+			return false;
+
+		m_cursorPosition = event.cursorPosition;
+
+		switch (event.type)
+		{
+		case UIEventType::POINTER_ENTER:
+			m_isCursorHovering = true;
+			return false;
+		case UIEventType::POINTER_LEAVE:
+			m_isCursorHovering = false;
+			return false;
+		case UIEventType::POINTER_MOVE:
+			if (!m_isPressed)
+				return false;
+
+			this->MoveCaretToCursor(m_cursorPosition);
+			break;
+		case UIEventType::POINTER_DOWN:
+			// The interface frame unfocuses the text area whenever the pointer is pressed outside of it
+			if (event.input->button != MouseButtonCode::MOUSE_BUTTON_LEFT)
+				return false;
+
+			m_isPressed = true;
+			this->MoveCaretToCursor(m_cursorPosition);
+
+			if (!m_isFocused)
+				this->RequestFocus();
+
+			break;
+		case UIEventType::POINTER_UP:
+			if (event.input->button != MouseButtonCode::MOUSE_BUTTON_LEFT)
+				return false;
+
+			m_isPressed = false;
+			return true;
+		case UIEventType::POINTER_SCROLL:
+			// Scroll by three lines per step of the mouse wheel
+			m_scrollOffset -= event.input->scrollOffset.y * this->GetLineHeight() * 3.0f;
+			this->ClampScrollOffset();
+			break;
+		case UIEventType::KEY_DOWN:
+			if (!m_isFocused || !m_inputEnabled || !this->HandleKeyInput(event.input->key))
+				return false;
+
+			// The key acts as soon as it goes down, then the update repeats it at a fixed rate while it is held down
+			m_repeatKey = event.input->key;
+			m_keyRepeatTimer.Reset();
+			break;
+		case UIEventType::CHARACTER:
+		{
+			if (!m_isFocused || !m_inputEnabled)
+				return false;
+
+			// Insert the inputted text character at the caret
+			std::string inputtedText;
+			AppendUTF8(inputtedText, event.input->codepoint);
+
+			m_document.Insert(m_document.GetLineStart(m_caretLine) + m_caretColumn, inputtedText);
+			m_documentChanged = true;
+
+			this->MoveCaret(m_caretLine, m_caretColumn + inputtedText.size());
+			m_caretBlinkTimer.Reset();
+			break;
+		}
+		default:
+			return false;
+		}
+
+		// The line labels and the caret are updated to the change
+		this->SetUpdateRequired(true);
+		return true;
+	}
+
+	bool TextArea::GetInteractionBounds(glm::vec2& min, glm::vec2& max) const
+	{
+		min = glm::vec2(m_position) - (glm::vec2(m_size) / 2.0f);
+		max = glm::vec2(m_position) + (glm::vec2(m_size) / 2.0f);
+		return true;
+	}
+
+	bool TextArea::IsCursorHovering() const { return m_isCursorHovering; }
+
+	void TextArea::Update(float deltaTime)
+	{
+		if (!m_font || m_fontSize <= 0.0f)
+		{
+			this->SetUpdateRequired(false);
+			return;
+		}
+
+		// Repeat the key pressed at a fixed rate while it is held down (and the text area is still focused)
+		if (m_repeatKey != KeyCode::KEY_LAST)
+		{
+			if (!m_isFocused || !m_inputEnabled || !InputSystem::GetInstance().GetSnapshot().IsKeyDown(m_repeatKey))
+			{
+				m_repeatKey = KeyCode::KEY_LAST;
+			}
+			else if (m_keyRepeatTimer.GetElapsedTime() >= 0.15f)
+			{
+				this->HandleKeyInput(m_repeatKey);
+				m_keyRepeatTimer.Reset();
+			}
+		}
+
+		this->UpdateLineLabels(deltaTime);
+
+		// Update the position of the caret, relative to the top of the text area's document
+		const std::string caretLineText = m_document.GetLine(m_caretLine);
+		m_caretPosition = { this->MeasureText(std::string_view(caretLineText).substr(0, m_caretColumn)), m_caretLine * this->GetLineHeight() };
+
+		this->ResetActionFocusFlags(); // Reset the gained and lost focus flags to false
+
+		// The text area only has to be updated again to repeat a held down key, the caret blinks by itself when rendered
+		this->SetUpdateRequired(m_repeatKey != KeyCode::KEY_LAST);
+	}
+
+	bool TextArea::HandleKeyInput(KeyCode key)
+	{
+		const size_t caretOffset = m_document.GetLineStart(m_caretLine) + m_caretColumn;
+		const std::string lineText = m_document.GetLine(m_caretLine);
+		const size_t visibleLineCount = (size_t)std::max((m_size.y - (m_padding * 2)) / this->GetLineHeight(), 1.0f);
+
+		if (key == KeyCode::KEY_BACKSPACE)
+		{
+			// Erase the codepoint before the caret, or join the line onto the previous line
+			if (m_caretColumn > 0)
+			{
+				const size_t previousColumn = GetPreviousCodepoint(lineText, m_caretColumn);
+				m_document.Erase(caretOffset - (m_caretColumn - previousColumn), m_caretColumn - previousColumn);
+				this->MoveCaret(m_caretLine, previousColumn);
+			}
+			else if (m_caretLine > 0)
+			{
+				const size_t previousLineLength = m_document.GetLineLength(m_caretLine - 1);
+				m_document.Erase(caretOffset - 1, 1);
+				this->MoveCaret(m_caretLine - 1, previousLineLength);
+			}
+
+			m_documentChanged = true;
+		}
+		else if (key == KeyCode::KEY_DELETE)
+		{
+			// Erase the codepoint after the caret, or join the next line onto this line
+			if (m_caretColumn < lineText.size())
+				m_document.Erase(caretOffset, GetNextCodepoint(lineText, m_caretColumn) - m_caretColumn);
+			else if (m_caretLine + 1 < m_document.GetLineCount())
+				m_document.Erase(caretOffset, 1);
+
+			m_documentChanged = true;
+		}
+		else if (key == KeyCode::KEY_ENTER || key == KeyCode::KEY_KP_ENTER)
+		{
+			m_document.Insert(caretOffset, "\n");
+			m_documentChanged = true;
+			this->MoveCaret(m_caretLine + 1, 0);
+		}
+		else if (key == KeyCode::KEY_LEFT)
+		{
+			if (m_caretColumn > 0)
+				this->MoveCaret(m_caretLine, GetPreviousCodepoint(lineText, m_caretColumn));
+			else if (m_caretLine > 0)
+				this->MoveCaret(m_caretLine - 1, m_document.GetLineLength(m_caretLine - 1));
+		}
+		else if (key == KeyCode::KEY_RIGHT)
+		{
+			if (m_caretColumn < lineText.size())
+				this->MoveCaret(m_caretLine, GetNextCodepoint(lineText, m_caretColumn));
+			else if (m_caretLine + 1 < m_document.GetLineCount())
+				this->MoveCaret(m_caretLine + 1, 0);
+		}
+		else if (key == KeyCode::KEY_UP && m_caretLine > 0)
+		{
+			this->MoveCaret(m_caretLine - 1, m_caretColumn);
+		}
+		else if (key == KeyCode::KEY_DOWN)
+		{
+			this->MoveCaret(m_caretLine + 1, m_caretColumn);
+		}
+		else if (key == KeyCode::KEY_PAGE_UP)
+		{
+			this->MoveCaret(m_caretLine - std::min(m_caretLine, visibleLineCount), m_caretColumn);
+		}
+		else if (key == KeyCode::KEY_PAGE_DOWN)
+		{
+			this->MoveCaret(m_caretLine + visibleLineCount, m_caretColumn);
+		}
+		else if (key == KeyCode::KEY_HOME)
+		{
+			this->MoveCaret(m_caretLine, 0);
+		}
+		else if (key == KeyCode::KEY_END)
+		{
+			this->MoveCaret(m_caretLine, lineText.size());
+		}
+		else
+		{
+			return false;
+		}
+
+		m_caretBlinkTimer.Reset();
+		return true;
+	}
+
+	void TextArea::UpdateLineLabels(float deltaTime)
+	{
+		const float lineHeight = this->GetLineHeight();
+		const glm::vec2 textOrigin = this->GetTextOrigin();
+		const uint32_t pixelSize = m_font->GetNearestPixelSize(m_fontSize);
+		const float ascender = m_font->GetAscender(pixelSize) * (m_fontSize / (float)pixelSize);
+
+		// Make sure there's a label for every line which can be visible at once (including a partially visible line at each edge)
+		const size_t labelCount = (size_t)std::ceil(std::max(m_size.y - (m_padding * 2), 0) / lineHeight) + 1;
+		if (m_lineLabels.size() != labelCount)
+		{
+			for (size_t i = labelCount; i < m_lineLabels.size(); i++)
+				delete m_lineLabels[i];
+
+			const size_t oldLabelCount = m_lineLabels.size();
+			m_lineLabels.resize(labelCount);
+			for (size_t i = oldLabelCount; i < labelCount; i++)
+				m_lineLabels[i] = new Label("", m_textColor, m_font, m_fontSize);
+
+			// Every label is mapped to a different line now, so they all have to be reassigned
+			m_labelLines.assign(labelCount, std::string::npos);
+		}
+
+		// Each line is always displayed by the same label (the line index modulo the label count), so that scrolling by a line only
+		// changes the text of the single label which scrolled out of view
+		const size_t firstVisibleLine = (size_t)(m_scrollOffset / lineHeight);
+		for (size_t line = firstVisibleLine; line < firstVisibleLine + labelCount; line++)
+		{
+			const size_t labelIndex = line % labelCount;
+			Label* label = m_lineLabels[labelIndex];
+
+			if (line >= m_document.GetLineCount())
+			{
+				label->SetEnabled(false);
+				continue;
+			}
+
+			// If the label's line has been edited the label will only regenerate its geometry if the line's text actually changed
+			if (m_labelLines[labelIndex] != line || m_documentChanged)
+			{
+				label->SetText(m_document.GetLine(line));
+				m_labelLines[labelIndex] = line;
+			}
+
+			label->SetEnabled(true);
+			label->SetTextColor(m_textColor);
+			label->SetPosition({ textOrigin.x, textOrigin.y + (line * lineHeight) + ascender - m_scrollOffset });
+			label->Update(deltaTime);
+		}
+
+		m_documentChanged = false;
+	}
+
+	void TextArea::MoveCaret(size_t line, size_t column)
+	{
+		m_caretLine = std::min(line, m_document.GetLineCount() - 1);
+
+		// Make sure the caret doesn't end up in the middle of an encoded codepoint
+		const std::string lineText = m_document.GetLine(m_caretLine);
+		m_caretColumn = std::min(column, lineText.size());
+		while (m_caretColumn > 0 && m_caretColumn < lineText.size() && ((uint8_t)lineText[m_caretColumn] & 0xC0) == 0x80)
+			m_caretColumn--;
+
+		// Scroll the caret's line into view
+		const float lineHeight = this->GetLineHeight();
+		const float caretTop = m_caretLine * lineHeight;
+		const float visibleHeight = (float)(m_size.y - (m_padding * 2));
+
+		if (caretTop < m_scrollOffset)
+			m_scrollOffset = caretTop;
+		else if (caretTop + lineHeight > m_scrollOffset + visibleHeight)
+			m_scrollOffset = caretTop + lineHeight - visibleHeight;
+
+		this->ClampScrollOffset();
+	}
+
+	void TextArea::MoveCaretToCursor(glm::vec2 cursorPosition)
+	{
+		cursorPosition -= this->GetTextOrigin();
+		const size_t line = (size_t)std::max((cursorPosition.y + m_scrollOffset) / this->GetLineHeight(), 0.0f);
+		const std::string lineText = m_document.GetLine(std::min(line, m_document.GetLineCount() - 1));
+
+		this->MoveCaret(line, this->GetColumnFromPosition(lineText, cursorPosition.x));
+		m_caretBlinkTimer.Reset();
+	}
+
+	void TextArea::ClampScrollOffset()
+	{
+		const float documentHeight = m_document.GetLineCount() * this->GetLineHeight();
+		const float visibleHeight = (float)(m_size.y - (m_padding * 2));
+		m_scrollOffset = std::clamp(m_scrollOffset, 0.0f, std::max(documentHeight - visibleHeight, 0.0f));
+	}
+
+	float TextArea::MeasureText(std::string_view text) const
+	{
+		if (!m_font || text.empty())
+			return 0.0f;
+
+		const std::u32string codepoints = DecodeUTF8(text);
+		const uint32_t pixelSize = m_font->GetNearestPixelSize(m_fontSize);
+		const float scale = m_fontSize / (float)pixelSize;
+
+		float width = 0.0f;
+		for (size_t i = 0; i < codepoints.size(); i++)
+		{
+			width += m_font->GetGlyph(codepoints[i], pixelSize).advance * scale;
+			if (i > 0)
+				width += m_font->GetKerning(codepoints[i - 1], codepoints[i], pixelSize) * scale;
+		}
+
+		return width;
+	}
+
+	size_t TextArea::GetColumnFromPosition(std::string_view line, float x) const
+	{
+		const uint32_t pixelSize = m_font->GetNearestPixelSize(m_fontSize);
+		const float scale = m_fontSize / (float)pixelSize;
+
+		// Walk along the line until the position is closer to the next codepoint boundary than the current one
+		float width = 0.0f;
+		uint32_t previousCodepoint = 0;
+
+		for (size_t column = 0; column < line.size();)
+		{
+			const size_t nextColumn = GetNextCodepoint(line, column);
+			const uint32_t codepoint = DecodeUTF8(line.substr(column, nextColumn - column))[0];
+
+			float advance = m_font->GetGlyph(codepoint, pixelSize).advance * scale;
+			if (column > 0)
+				advance += m_font->GetKerning(previousCodepoint, codepoint, pixelSize) * scale;
+
+			if (x < width + (advance / 2.0f))
+				return column;
+
+			width += advance;
+			previousCodepoint = codepoint;
+			column = nextColumn;
+		}
+
+		return line.size();
+	}
+
+	float TextArea::GetLineHeight() const
+	{
+		const uint32_t pixelSize = m_font->GetNearestPixelSize(m_fontSize);
+		return std::max(m_font->GetLineHeight(pixelSize) * (m_fontSize / (float)pixelSize), 1.0f);
+	}
+
+	glm::vec2 TextArea::GetTextOrigin() const
+	{
+		return glm::vec2(m_position - (m_size / 2) + m_padding);
+	}
+
+	void TextArea::Render(const Viewport& viewport) const
+	{
+		/// Render the border first ///
+		// Construct the model matrix
+		glm::mat4 modelMatrix = glm::mat4(1.0f);
+		modelMatrix = glm::translate(modelMatrix, { m_position, 0.0f });
+		modelMatrix = glm::scale(modelMatrix, { m_size + m_borderThickness, 0.0f });
+
+		// Bind the shader and setup the shader uniforms
+		m_shaders->Bind();
+		m_shaders->SetUniform("textureSampler", 0);
+		m_shaders->SetUniform("useTextures", false);
+		m_shaders->SetUniformGLM("model", modelMatrix);
+		m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
+		m_shaders->SetUniformGLM("color", m_borderColor);
+
+		// Render the border
+		m_geometry.vao->Bind();
+		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+
+		/// Render the text field ///
+		// Construct the model matrix
+		modelMatrix = glm::mat4(1.0f);
+		modelMatrix = glm::translate(modelMatrix, { m_position, 0.0f });
+		modelMatrix = glm::scale(modelMatrix, { m_size, 0.0f });
+
+		// Setup the shader uniforms
+		m_shaders->SetUniformGLM("model", modelMatrix);
+		m_shaders->SetUniformGLM("color", m_color);
+
+		// Render the text field
+		glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+		glStencilFunc(GL_ALWAYS, 1, 0xFF);
+		glStencilMask(0xFF);
+
+		m_geometry.vao->Bind();
+		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+
+		/// Render the visible lines of text in the field ///
+		glStencilFunc(GL_EQUAL, 1, 0xFF);
+		glStencilMask(0x00);
+
+		for (const Label* label : m_lineLabels)
+		{
+			if (label->IsEnabled())
+				label->Render(viewport);
+		}
+
+		/// Render the caret, blinking every half a second ///
+		if (m_isFocused && m_inputEnabled && std::fmod(m_caretBlinkTimer.GetElapsedTime(), 1.0f) < 0.5f)
+		{
+			const float lineHeight = this->GetLineHeight();
+			const glm::vec2 caretPosition = this->GetTextOrigin() + m_caretPosition - glm::vec2(0.0f, m_scrollOffset);
+
+			modelMatrix = glm::mat4(1.0f);
+			modelMatrix = glm::translate(modelMatrix, { caretPosition.x + 1.0f, caretPosition.y + (lineHeight / 2.0f), 0.0f });
+			modelMatrix = glm::scale(modelMatrix, { 2.0f, lineHeight, 0.0f });
+
+			m_shaders->Bind();
+			m_shaders->SetUniformGLM("model", modelMatrix);
+			m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
+			m_shaders->SetUniformGLM("color", m_textColor);
+
+			m_geometry.vao->Bind();
+			glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+		}
+
+		glStencilFunc(GL_ALWAYS, 1, 0xFF);
+	}
+
+	const glm::ivec2& TextArea::GetPosition() const { return m_position; }
+
+	const glm::ivec2& TextArea::GetSize() const { return m_size; }
+
+	bool TextArea::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		size = m_size;
+		anchor = size / 2;
+		return true;
+	}
+
+	void TextArea::ArrangeLayout(glm::ivec2 size) { this->SetSize(size); }
+
+	std::string TextArea::GetText() const { return m_document.GetText(); }
+
+	std::string TextArea::GetLine(size_t line) const { return m_document.GetLine(line); }
+
+	size_t TextArea::GetLineCount() const { return m_document.GetLineCount(); }
+
+	size_t TextArea::GetCaretLine() const { return m_caretLine; }
+
+	size_t TextArea::GetCaretColumn() const { return m_caretColumn; }
+
+	const glm::vec4& TextArea::GetColor() const { return m_color; }
+
+	const glm::vec4& TextArea::GetTextColor() const { return m_textColor; }
+
+	const glm::vec4& TextArea::GetBorderColor() const { return m_borderColor; }
+
+	const int& TextArea::GetBorderThickness() const { return m_borderThickness; }
+}
\ No newline at end of file
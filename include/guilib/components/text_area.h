@@ -0,0 +1,294 @@
+#ifndef TEXT_AREA_H
+#define TEXT_AREA_H
+
+#include <components/focusable_component.h>
+#include <components/label.h>
+#include <graphics/font.h>
+#include <utilities/piece_table.h>
+#include <utilities/timer.h>
+
+namespace GUILib
+{
+	/**
+	* @brief This is a component class for viewing and editing multi-line text documents.
+	* The document is stored in a piece table, and only the lines visible within the text area are turned into text geometry. The visible
+	* lines are displayed by a small pool of labels which are recycled as the text area is scrolled, so a label's text is only changed when
+	* the line it displays scrolls into view. Scrolling otherwise only moves the labels.
+	*
+	* Also, make sure that whenever you are using this class you are always allocating it on the heap, not the stack.
+	*/
+	class LIB_DECLSPEC TextArea : public FocusableComponent
+	{
+	public:
+		/**
+		* @brief The class constructor, sets up the text area component.
+		*
+		* @param[in] font - The font of the text displayed.
+		* @param[in] fontSize - The font size of the text displayed.
+		*/
+		TextArea(const Font* font, float fontSize);
+
+		~TextArea();
+
+		/**
+		* @brief Sets whether or not user input is enabled for this text area component.
+		* If disabled, then the text area will not listen for any keyboard input, hence becoming read-only.
+		*
+		* @param[in] enabled - Specifies whether or not input is enabled.
+		*/
+		void SetInputState(bool enabled);
+
+		/**
+		* @brief Sets the current position of the text area component.
+		* @param[in] pos - The new position of the component.
+		*/
+		void SetPosition(glm::ivec2 pos) override;
+
+		/**
+		* @brief Sets the current size of the text area component.
+		* @param[in] size - The new size of the component.
+		*/
+		void SetSize(glm::ivec2 size);
+
+		/**
+		* @brief Replaces the text of the text area component's document, the caret and scroll position are moved back to the start.
+		* @param[in] text - The UTF-8 encoded text to be assigned to the text area.
+		*/
+		void SetText(std::string_view text);
+
+		/**
+		* @brief Sets the text area field color.
+		* @param[in] color - The new color to be assigned.
+		*/
+		void SetColor(glm::vec4 color);
+
+		/**
+		* @brief Sets the color of the text in the text area component.
+		* @param[in] color - The new text color to be assigned.
+		*/
+		void SetTextColor(glm::vec4 color);
+
+		/**
+		* @brief Sets the text area border color.
+		* @param[in] color - The new border color to be assigned.
+		*/
+		void SetBorderColor(glm::vec4 color);
+
+		/**
+		* @brief Sets the border thickness of this text area component.
+		* @param[in] thickness - The new border thickness of the component.
+		*/
+		void SetBorderThickness(int thickness);
+
+		/**
+		* @brief Scrolls the text area component so that the specified line is at the top of the text area.
+		* @param[in] line - The index of the line.
+		*/
+		void ScrollToLine(size_t line);
+
+		/**
+		* @brief Updates the logic of the text area component.
+		* @param[in] deltaTime - The elapsed time between the previous and current frame.
+		*/
+		void Update(float deltaTime) override;
+
+		/**
+		* @brief Handles the events dispatched to the text area component, pressing (and dragging) moves the caret to the cursor and focuses
+		* the text area, scrolling scrolls through the document, and the focused text area is edited by the key and character events.
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the event is handled by the text area, FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event) override;
+
+		/**
+		* @brief Renders the text area component.
+		* @param[in] viewport - The viewport where the component is being rendered to.
+		*/
+		void Render(const Viewport& viewport) const override;
+
+		/**
+		* @brief Returns the current position of the text area component.
+		* @return The position of the component.
+		*/
+		const glm::ivec2& GetPosition() const override;
+
+		/**
+		* @brief Returns the size of this text area component.
+		* @return The size of this component.
+		*/
+		const glm::ivec2& GetSize() const;
+
+		/**
+		* @brief Measures the box which the text area occupies when arranged by a layout panel, which is the size of the text area.
+		* @param[out] size - The size of the component's box.
+		* @param[out] anchor - The offset of the component's position from the top-left corner of its box.
+		* @return TRUE, as text areas always occupy a box.
+		*/
+		bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const override;
+
+		/**
+		* @brief Resizes the text area to the size of the box given by the layout panel arranging it.
+		* @param[in] size - The new size of the component.
+		*/
+		void ArrangeLayout(glm::ivec2 size) override;
+
+		/**
+		* @brief Retrieves the bounds of the text area component, these are used for hit testing.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, as text areas always respond to the cursor.
+		*/
+		bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const override;
+
+		/**
+		* @brief Returns the whole text of the text area component's document.
+		* @return The text contained in the text area.
+		*/
+		std::string GetText() const;
+
+		/**
+		* @brief Returns the text of the specified line of the text area component's document.
+		* @param[in] line - The index of the line.
+		* @return The line's text, excluding the line break.
+		*/
+		std::string GetLine(size_t line) const;
+
+		/**
+		* @brief Returns the number of lines in the text area component's document.
+		* @return The line count.
+		*/
+		size_t GetLineCount() const;
+
+		/**
+		* @brief Returns the line which the caret is on.
+		* @return The index of the caret's line.
+		*/
+		size_t GetCaretLine() const;
+
+		/**
+		* @brief Returns the position of the caret within its line.
+		* @return The byte offset of the caret within its line.
+		*/
+		size_t GetCaretColumn() const;
+
+		/**
+		* @brief Returns the text area field color.
+		* @return The field color of the text area.
+		*/
+		const glm::vec4& GetColor() const;
+
+		/**
+		* @brief Returns the color of the text in the text area component.
+		* @return The text color of the text area.
+		*/
+		const glm::vec4& GetTextColor() const;
+
+		/**
+		* @brief Returns the text area border color.
+		* @return The border color of the text area.
+		*/
+		const glm::vec4& GetBorderColor() const;
+
+		/**
+		* @brief Returns the thickness of the text area component's border.
+		* @return The border thickness of the text area.
+		*/
+		const int& GetBorderThickness() const;
+	protected:
+		/**
+		* @brief Initialises the text area component.
+		*/
+		void InitializeComponent() override;
+
+		/**
+		* @brief Checks if the cursor is hovering on the text area.
+		* The interface frame resolves the topmost component under the cursor, so this is tracked from the pointer enter and leave events.
+		* @return TRUE if cursor is hovering on text area, FALSE otherwise.
+		*/
+		bool IsCursorHovering() const;
+	private:
+		/**
+		* @brief Edits the document or moves the caret in response to the key pressed (or repeated) given.
+		* @param[in] key - The key pressed.
+		* @return TRUE if the key is handled by the text area, FALSE otherwise.
+		*/
+		bool HandleKeyInput(KeyCode key);
+
+		/**
+		* @brief Assigns the visible lines to the line labels, only the labels whose line has changed get their text updated.
+		* @param[in] deltaTime - The elapsed time between the previous and current frame.
+		*/
+		void UpdateLineLabels(float deltaTime);
+
+		/**
+		* @brief Moves the caret to the line and column given, then scrolls the text area so that the caret is visible.
+		*
+		* @param[in] line - The index of the line, this is clamped to the last line.
+		* @param[in] column - The byte offset within the line, this is clamped to the end of the line.
+		*/
+		void MoveCaret(size_t line, size_t column);
+
+		/**
+		* @brief Moves the caret to the position within the document which is closest to the cursor position given.
+		* @param[in] cursorPosition - The cursor position, mapped to the interface frame's viewport.
+		*/
+		void MoveCaretToCursor(glm::vec2 cursorPosition);
+
+		/**
+		* @brief Clamps the scroll offset so that the text area doesn't scroll beyond the end of the document.
+		*/
+		void ClampScrollOffset();
+
+		/**
+		* @brief Returns the width of the text given when laid out on a single line, including the advance of the last glyph.
+		* @param[in] text - The UTF-8 encoded text.
+		* @return The width (in pixels) of the text.
+		*/
+		float MeasureText(std::string_view text) const;
+
+		/**
+		* @brief Returns the position within the line given which is closest to the horizontal position given.
+		*
+		* @param[in] line - The UTF-8 encoded text of the line.
+		* @param[in] x - The horizontal position relative to the start of the line.
+		* @return The byte offset within the line.
+		*/
+		size_t GetColumnFromPosition(std::string_view line, float x) const;
+
+		/**
+		* @brief Returns the distance between the baselines of two consecutive lines.
+		*/
+		float GetLineHeight() const;
+
+		/**
+		* @brief Returns the position of the top-left corner of the text within the text area.
+		*/
+		glm::vec2 GetTextOrigin() const;
+	private:
+		glm::ivec2 m_position, m_size;
+		glm::vec4 m_color, m_textColor, m_borderColor;
+		int m_borderThickness, m_padding;
+
+		const Font* m_font;
+		float m_fontSize;
+
+		// The document, along with the labels displaying the visible lines and the line each label displays
+		PieceTable m_document;
+		std::vector<Label*> m_lineLabels;
+		std::vector<size_t> m_labelLines;
+
+		float m_scrollOffset;
+		size_t m_caretLine, m_caretColumn;
+		glm::vec2 m_caretPosition;
+		Timer m_keyRepeatTimer, m_caretBlinkTimer;
+		KeyCode m_repeatKey; // The key repeated by the update while it is held down, KEY_LAST if no key is repeated
+
+		// The cursor position mapped to the interface frame's viewport, as of the last pointer event dispatched to the text area
+		glm::vec2 m_cursorPosition;
+
+		bool m_inputEnabled, m_documentChanged, m_isCursorHovering, m_isPressed; // The caret follows the cursor while the text area is pressed
+	};
+}
+
+#endif
\ No newline at end of file
@@ -1,12 +1,18 @@
 #include <components/textbox.h>
-#include <graphics/animation.h>
 #include <utilities/input_system.h>
+#include <utilities/utf8.h>
 #include <external/glm/glm/gtc/matrix_transform.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace GUILib
 {
 	TextBox::TextBox(const Font* font, float fontSize, std::string_view hintText, bool textCentered) :
-		m_inputEnabled(true), m_isInputVisible(true), m_textCentered(textCentered)
+		m_visualState(VisualStateTable::GetInstance().Create(VisualStateTable::MAX_CHANNELS)), m_repeatKey(KeyCode::KEY_LAST),
+		m_repeatModifiers(KeyModifier::NONE), m_caretOffset(0), m_caretIndex(0), m_caretPosition({ 0.0f, 0.0f }),
+		m_cursorPosition({ 0.0f, 0.0f }), m_inputEnabled(true), m_isInputVisible(true), m_textCentered(textCentered),
+		m_isCursorHovering(false)
 	{
 		this->InitializeComponent();
 
@@ -21,6 +27,8 @@ namespace GUILib
 	{
 		delete m_hintText;
 		delete m_inputText;
+
+		VisualStateTable::GetInstance().Destroy(m_visualState);
 	}
 
 	void TextBox::SetInputState(bool enabled) { m_inputEnabled = enabled; }
@@ -32,158 +40,184 @@ namespace GUILib
 
 		m_position = m_size = { 0, 0 };
 
-		m_currentColor = m_baseColor = { 0.6f, 0.6, 0.6f, 1.0f };
-		m_hoverColor = { 0.8f, 0.8f, 0.8f, 1.0f };
-		m_clickedColor = { 1.0f, 1.0f, 1.0f, 1.0f };
+		const ComponentEvent allEvents = ComponentEvent::NO_EVENT | ComponentEvent::HOVERED_EVENT | ComponentEvent::CLICKED_EVENT;
+		this->SetColor({ 0.6f, 0.6, 0.6f, 1.0f }, ComponentEvent::NO_EVENT);
+		this->SetColor({ 0.8f, 0.8f, 0.8f, 1.0f }, ComponentEvent::HOVERED_EVENT);
+		this->SetColor({ 1.0f, 1.0f, 1.0f, 1.0f }, ComponentEvent::CLICKED_EVENT);
 
-		m_currentHintTextColor = m_baseHintTextColor = m_hoverHintTextColor = { 0.4f, 0.4f, 0.4f, 1.0f };
-		m_currentInputTextColor = m_baseInputTextColor = m_hoverInputTextColor = m_clickedInputTextColor = { 0.0f, 0.0f, 0.0f, 1.0f };
-		m_currentBorderColor = m_baseBorderColor = m_hoverBorderColor = m_clickedBorderColor = { 0.2f, 0.2f, 0.2f, 1.0f };
+		this->SetHintTextColor({ 0.4f, 0.4f, 0.4f, 1.0f }, allEvents);
+		this->SetInputTextColor({ 0.0f, 0.0f, 0.0f, 1.0f }, allEvents);
+		this->SetBorderColor({ 0.2f, 0.2f, 0.2f, 1.0f }, allEvents);
 		m_borderThickness = 4;
 	}
 
-	void TextBox::SetInputVisibility(bool visible) { m_isInputVisible = visible; }
+	void TextBox::SetInputVisibility(bool visible) 
+	{
+		if (m_isInputVisible != visible)
+		{
+			m_isInputVisible = visible;
 
-	void TextBox::SetPosition(glm::ivec2 pos) { m_position = pos; }
+			const std::string& inputText = m_inputBuffer.GetText();
+			m_inputText->SetText(m_isInputVisible ? inputText : std::string(GetUTF8Length(inputText), '#'));
+			this->SetUpdateRequired(true);
+		}
+	}
 
-	void TextBox::SetSize(glm::ivec2 size) { m_size = size; }
+	void TextBox::SetPosition(glm::ivec2 pos)
+	{
+		m_position = pos;
+		this->UpdateSpatialIndexEntry();
+		this->MarkChildTransformsDirty();
+		this->SetUpdateRequired(true); // The text is repositioned by the update
+	}
 
-	void TextBox::SetHintText(std::string_view text) { m_hintText->SetText(text); }
+	void TextBox::SetSize(glm::ivec2 size)
+	{
+		m_size = size;
+		this->UpdateSpatialIndexEntry();
+		this->InvalidateLayout();
+		this->SetUpdateRequired(true);
+	}
+
+	void TextBox::SetHintText(std::string_view text)
+	{
+		m_hintText->SetText(text);
+		this->SetUpdateRequired(true);
+	}
 
 	void TextBox::SetInputText(std::string_view text) 
-	{ 
-		if (m_isInputVisible)
-			m_inputText->SetText(text);
-		else
-		{
-			m_obscuredInputText = text;
-			m_inputText->SetText(std::string(text.size(), '#'));
-		}
+	{
+		m_inputBuffer.SetText(text);
+		m_caretOffset = text.size();
+		m_caretIndex = GetUTF8Length(text);
+
+		m_inputText->SetText(m_isInputVisible ? text : std::string(m_caretIndex, '#'));
+		this->SetUpdateRequired(true);
 	}
 
 	void TextBox::SetColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentColor = m_baseColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::FILL_CHANNEL, color, eventEnum);
 	}
 
 	void TextBox::SetHintTextColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentHintTextColor = m_baseHintTextColor = color;
+		// The hint text doesn't have a clicked color, it keeps its hovered color while the textbox is clicked
 		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverHintTextColor = color;
+			eventEnum = eventEnum | ComponentEvent::CLICKED_EVENT;
+		else if (eventEnum & ComponentEvent::CLICKED_EVENT)
+			eventEnum = (ComponentEvent)((int)eventEnum & ~(int)ComponentEvent::CLICKED_EVENT);
+
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::HINT_TEXT_CHANNEL, color, eventEnum);
 	}
 
 	void TextBox::SetInputTextColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentInputTextColor = m_baseInputTextColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverInputTextColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedInputTextColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::TEXT_CHANNEL, color, eventEnum);
 	}
 
 	void TextBox::SetBorderColor(glm::vec4 color, ComponentEvent eventEnum)
 	{
-		if (eventEnum & ComponentEvent::NO_EVENT)
-			m_currentBorderColor = m_baseBorderColor = color;
-		if (eventEnum & ComponentEvent::HOVERED_EVENT)
-			m_hoverBorderColor = color;
-		if (eventEnum & ComponentEvent::CLICKED_EVENT)
-			m_clickedBorderColor = color;
+		VisualStateTable::GetInstance().SetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, color, eventEnum);
 	}
 
 	void TextBox::SetBorderThickness(int thickness) { m_borderThickness = thickness; }
 	
-	bool TextBox::IsCursorHovering() const
+	bool TextBox::HandleEvent(const UIEvent& event)
 	{
-		const glm::vec2 cursorPosition = InputSystem::GetInstance().GetCursorPosition();
+		// Events bubbling up from child components carry no pointer state of the textbox's own
+		if (event.target != this)
+			return false;
 
-		return
-			cursorPosition.x >= m_position.x - (m_size.x / 2.0f) && cursorPosition.x <= m_position.x + (m_size.x / 2.0f) &&
-			cursorPosition.y >= m_position.y - (m_size.y / 2.0f) && cursorPosition.y <= m_position.y + (m_size.y / 2.0f);
-	}
+		m_cursorPosition = event.cursorPosition;
 
-	void TextBox::Update(float deltaTime)
-	{
-		// Update the text field color and focus state
-		if (this->IsCursorHovering())
+		// The visual state table transitions the colors, the focused textbox keeps its clicked colors until it loses focus
+		VisualStateTable& visualStates = VisualStateTable::GetInstance();
+		switch (event.type)
 		{
-			if (InputSystem::GetInstance().WasMouseButtonPressed(MouseButtonCode::MOUSE_BUTTON_LEFT) && !m_isFocused)
-			{
-				m_currentColor = m_clickedColor;
-				m_currentInputTextColor = m_clickedInputTextColor;
-				m_currentBorderColor = m_clickedBorderColor;
+		case UIEventType::POINTER_ENTER:
+			m_isCursorHovering = true;
+			if (!m_isFocused)
+				visualStates.SetState(m_visualState, VisualState::HOVERED);
 
-				m_requestedFocus = true;
-			}
-			else
-			{
-				if (!m_isFocused)
-				{
-					if (m_lostFocus)
-					{
-						m_currentColor = m_hoverColor;
-						m_currentHintTextColor = m_hoverHintTextColor;
-						m_currentInputTextColor = m_hoverInputTextColor;
-						m_currentBorderColor = m_hoverBorderColor;
-					}
-					else
-					{
-						m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_baseColor, m_hoverColor, 8.0f, deltaTime);
-						m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_baseBorderColor, m_hoverBorderColor, 8.0f, deltaTime);
-
-						m_currentHintTextColor = FadeTo<glm::vec4>(m_currentHintTextColor, m_baseHintTextColor, m_hoverHintTextColor, 8.0f, 
-							deltaTime);
-
-						m_currentInputTextColor = FadeTo<glm::vec4>(m_currentInputTextColor, m_baseInputTextColor, m_hoverInputTextColor, 8.0f, 
-							deltaTime);
-					}
-				}
-			}
-		}
-		else
-		{
-			if (InputSystem::GetInstance().WasMouseButtonPressed(MouseButtonCode::MOUSE_BUTTON_LEFT))
-				m_isFocused = false;
+			return false;
+		case UIEventType::POINTER_LEAVE:
+			m_isCursorHovering = false;
+			if (!m_isFocused)
+				visualStates.SetState(m_visualState, VisualState::BASE);
+
+			return false;
+		case UIEventType::POINTER_DOWN:
+			// The interface frame unfocuses the textbox whenever the pointer is pressed outside of it
+			if (event.input->button != MouseButtonCode::MOUSE_BUTTON_LEFT)
+				return false;
 
 			if (!m_isFocused)
 			{
-				m_currentColor = FadeTo<glm::vec4>(m_currentColor, m_hoverColor, m_baseColor, 8.0f, deltaTime);
-				m_currentBorderColor = FadeTo<glm::vec4>(m_currentBorderColor, m_hoverBorderColor, m_baseBorderColor, 8.0f, deltaTime);
-				m_currentHintTextColor = FadeTo<glm::vec4>(m_currentHintTextColor, m_hoverHintTextColor, m_baseHintTextColor, 8.0f, deltaTime);
-				m_currentInputTextColor = FadeTo<glm::vec4>(m_currentInputTextColor, m_hoverInputTextColor, m_baseInputTextColor, 8.0f, 
-					deltaTime);
+				visualStates.SetState(m_visualState, VisualState::CLICKED);
+				this->RequestFocus();
 			}
+
+			return true;
+		case UIEventType::KEY_DOWN:
+			if (!m_isFocused || !m_inputEnabled || !this->HandleKeyInput(event.input->key, event.input->modifiers))
+				return false;
+
+			// The key acts as soon as it goes down, then the update repeats it at a fixed rate while it is held down
+			m_repeatKey = event.input->key;
+			m_repeatModifiers = event.input->modifiers;
+			m_keyRepeatTimer.Reset();
+
+			this->SetUpdateRequired(true);
+			return true;
+		case UIEventType::CHARACTER:
+		{
+			if (!m_isFocused || !m_inputEnabled)
+				return false;
+
+			// Insert the inputted text character at the caret
+			std::string inputtedText;
+			AppendUTF8(inputtedText, event.input->codepoint);
+			this->InsertInputText(inputtedText);
+			m_caretBlinkTimer.Reset();
+
+			this->SetUpdateRequired(true);
+			return true;
 		}
+		default:
+			return false;
+		}
+	}
+
+	bool TextBox::GetInteractionBounds(glm::vec2& min, glm::vec2& max) const
+	{
+		min = glm::vec2(m_position) - (glm::vec2(m_size) / 2.0f);
+		max = glm::vec2(m_position) + (glm::vec2(m_size) / 2.0f);
+		return true;
+	}
+
+	bool TextBox::IsCursorHovering() const { return m_isCursorHovering; }
 
-		// Check if user entered any text (if focused)
-		if (m_isFocused && m_inputEnabled)
+	void TextBox::Update(float deltaTime)
+	{
+		// The text field leaves its clicked colors once it loses focus, displaying the hovered colors straight away if it's still hovered
+		if (m_lostFocus)
 		{
-			const char inputtedChar = (char)GUILib::InputSystem::GetInstance().GetInputtedCharacter();
-			std::string currentInputText = m_isInputVisible ? m_inputText->GetText() : m_obscuredInputText;
+			VisualStateTable::GetInstance().SetState(m_visualState, this->IsCursorHovering() ? VisualState::HOVERED : VisualState::BASE,
+				this->IsCursorHovering());
+		}
 
-			if (inputtedChar > 0 && !m_gainedFocus)
-				currentInputText += inputtedChar;
-			else if (!currentInputText.empty() && InputSystem::GetInstance().WasKeyPressed(KeyCode::KEY_BACKSPACE) && 
-				m_backspaceTimer.GetElapsedTime() >= 0.2f)
+		// Repeat the key pressed at a fixed rate while it is held down (and the textbox is still focused)
+		if (m_repeatKey != KeyCode::KEY_LAST)
+		{
+			if (!m_isFocused || !m_inputEnabled || !InputSystem::GetInstance().GetSnapshot().IsKeyDown(m_repeatKey))
 			{
-				currentInputText.pop_back();
-				m_backspaceTimer.Reset();
+				m_repeatKey = KeyCode::KEY_LAST;
 			}
-
-			if (m_isInputVisible)
-				m_inputText->SetText(currentInputText);
-			else
+			else if (m_keyRepeatTimer.GetElapsedTime() >= 0.2f)
 			{
-				m_obscuredInputText = currentInputText;
-				m_inputText->SetText(std::string(m_obscuredInputText.size(), '#'));
+				this->HandleKeyInput(m_repeatKey, m_repeatModifiers);
+				m_keyRepeatTimer.Reset();
 			}
 		}
 
@@ -203,21 +237,154 @@ namespace GUILib
 		}
 
 		if (!m_inputText->GetText().empty())
-		{
-			m_inputText->SetTextColor(m_currentInputTextColor);
 			m_inputText->Update(deltaTime);
-		}
 		else if (!m_isFocused)
-		{
-			m_hintText->SetTextColor(m_currentHintTextColor);
 			m_hintText->Update(deltaTime);
-		}
+
+		// Place the caret after the character before it, the obscured text has a single byte character per codepoint of the input text
+		const float caretOffsetX = m_inputText->GetCharacterOffset(m_isInputVisible ? m_caretOffset : m_caretIndex);
+		m_caretPosition = { m_inputText->GetPosition().x + caretOffsetX, m_position.y };
 
 		this->ResetActionFocusFlags(); // Reset the gained and lost focus flags to false
+
+		// The textbox only has to be updated again to repeat a held down key, the caret blinks by itself when rendered
+		this->SetUpdateRequired(m_repeatKey != KeyCode::KEY_LAST);
+	}
+
+	bool TextBox::HandleKeyInput(KeyCode key, KeyModifier modifiers)
+	{
+		if ((modifiers & KeyModifier::CONTROL) && key == KeyCode::KEY_V)
+		{
+			// Paste the clipboard text at the caret, the textbox only holds a single line so line breaks are removed
+			std::string clipboardText = InputSystem::GetInstance().GetClipboardText();
+			clipboardText.erase(std::remove_if(clipboardText.begin(), clipboardText.end(), [](char c) { return c == '\n' || c == '\r'; }), 
+				clipboardText.end());
+
+			this->InsertInputText(clipboardText);
+		}
+		else if (key == KeyCode::KEY_BACKSPACE)
+		{
+			if (m_caretOffset > 0)
+			{
+				const size_t previousOffset = this->GetPreviousCodepoint(m_caretOffset);
+				this->EraseInputText(previousOffset, m_caretOffset - previousOffset);
+			}
+		}
+		else if (key == KeyCode::KEY_DELETE)
+		{
+			if (m_caretOffset < m_inputBuffer.GetLength())
+				this->EraseInputText(m_caretOffset, this->GetNextCodepoint(m_caretOffset) - m_caretOffset);
+		}
+		else if (key == KeyCode::KEY_LEFT)
+		{
+			if (m_caretOffset > 0)
+			{
+				m_caretOffset = this->GetPreviousCodepoint(m_caretOffset);
+				m_caretIndex--;
+			}
+		}
+		else if (key == KeyCode::KEY_RIGHT)
+		{
+			if (m_caretOffset < m_inputBuffer.GetLength())
+			{
+				m_caretOffset = this->GetNextCodepoint(m_caretOffset);
+				m_caretIndex++;
+			}
+		}
+		else if (key == KeyCode::KEY_HOME)
+		{
+			m_caretOffset = m_caretIndex = 0;
+		}
+		else if (key == KeyCode::KEY_END)
+		{
+			m_caretOffset = m_inputBuffer.GetLength();
+			m_caretIndex = GetUTF8Length(m_inputText->GetText());
+		}
+		else
+		{
+			return false;
+		}
+
+		m_caretBlinkTimer.Reset();
+		return true;
+	}
+
+	void TextBox::InsertInputText(std::string_view text)
+	{
+		if (text.empty())
+			return;
+
+		const size_t codepointCount = GetUTF8Length(text);
+
+		// Edit the displayed text in place, rather than replacing it, so only the glyphs from the caret onwards are regenerated
+		m_inputBuffer.Insert(m_caretOffset, text);
+		if (m_isInputVisible)
+			m_inputText->InsertText(m_caretOffset, text);
+		else
+			m_inputText->InsertText(m_caretIndex, std::string(codepointCount, '#'));
+
+		m_caretOffset += text.size();
+		m_caretIndex += codepointCount;
+	}
+
+	void TextBox::EraseInputText(size_t offset, size_t length)
+	{
+		// Count the codepoints within the range, this is also the length of the range in the obscured text
+		size_t codepointCount = 0;
+		for (size_t i = offset; i < offset + length; i++)
+		{
+			if (((uint8_t)m_inputBuffer.GetCharacter(i) & 0xC0) != 0x80)
+				codepointCount++;
+		}
+
+		// The range either ends at the caret (erasing backwards) or starts at the caret (erasing forwards)
+		const bool erasingBackwards = offset < m_caretOffset;
+		const size_t obscuredOffset = erasingBackwards ? m_caretIndex - codepointCount : m_caretIndex;
+
+		m_inputBuffer.Erase(offset, length);
+		if (m_isInputVisible)
+			m_inputText->EraseText(offset, length);
+		else
+			m_inputText->EraseText(obscuredOffset, codepointCount);
+
+		if (erasingBackwards)
+		{
+			m_caretOffset = offset;
+			m_caretIndex = obscuredOffset;
+		}
+	}
+
+	size_t TextBox::GetPreviousCodepoint(size_t offset) const
+	{
+		if (offset == 0)
+			return 0;
+
+		do
+		{
+			offset--;
+		} while (offset > 0 && ((uint8_t)m_inputBuffer.GetCharacter(offset) & 0xC0) == 0x80);
+
+		return offset;
+	}
+
+	size_t TextBox::GetNextCodepoint(size_t offset) const
+	{
+		const size_t length = m_inputBuffer.GetLength();
+		if (offset >= length)
+			return length;
+
+		do
+		{
+			offset++;
+		} while (offset < length && ((uint8_t)m_inputBuffer.GetCharacter(offset) & 0xC0) == 0x80);
+
+		return offset;
 	}
 
 	void TextBox::Render(const Viewport& viewport) const
 	{
+		const VisualStateTable& visualStates = VisualStateTable::GetInstance();
+
 		/// Render the border first ///
 		// Construct the model matrix
 		glm::mat4 modelMatrix = glm::mat4(1.0f);
@@ -230,7 +397,7 @@ namespace GUILib
 		m_shaders->SetUniform("useTextures", false);
 		m_shaders->SetUniformGLM("model", modelMatrix);
 		m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
-		m_shaders->SetUniformGLM("color", m_currentBorderColor);
+		m_shaders->SetUniformGLM("color", visualStates.GetCurrentColor(m_visualState, VisualStateTable::BORDER_CHANNEL));
 
 		// Render the border
 		m_geometry.vao->Bind();
@@ -244,7 +411,7 @@ namespace GUILib
 
 		// Setup the shader uniforms
 		m_shaders->SetUniformGLM("model", modelMatrix);
-		m_shaders->SetUniformGLM("color", m_currentColor);
+		m_shaders->SetUniformGLM("color", visualStates.GetCurrentColor(m_visualState, VisualStateTable::FILL_CHANNEL));
 
 		// Render the text field
 		glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
@@ -254,14 +421,36 @@ namespace GUILib
 		m_geometry.vao->Bind();
 		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
 
-		/// Render the text in the field ///
+		/// Render the text in the field, in the text colors which the visual state table has transitioned to ///
 		glStencilFunc(GL_EQUAL, 1, 0xFF);
 		glStencilMask(0x00);
 
 		if (!m_inputText->GetText().empty())
+		{
+			m_inputText->SetTextColor(visualStates.GetCurrentColor(m_visualState, VisualStateTable::TEXT_CHANNEL));
 			m_inputText->Render(viewport);
+		}
 		else if (!m_isFocused)
+		{
+			m_hintText->SetTextColor(visualStates.GetCurrentColor(m_visualState, VisualStateTable::HINT_TEXT_CHANNEL));
 			m_hintText->Render(viewport);
+		}
+
+		/// Render the caret, blinking every half a second ///
+		if (m_isFocused && m_inputEnabled && std::fmod(m_caretBlinkTimer.GetElapsedTime(), 1.0f) < 0.5f)
+		{
+			modelMatrix = glm::mat4(1.0f);
+			modelMatrix = glm::translate(modelMatrix, { m_caretPosition.x + 1.0f, m_caretPosition.y, 0.0f });
+			modelMatrix = glm::scale(modelMatrix, { 2.0f, m_inputText->GetFontSize(), 0.0f });
+
+			m_shaders->Bind();
+			m_shaders->SetUniformGLM("model", modelMatrix);
+			m_shaders->SetUniformGLM("viewport", viewport.GetMatrix());
+			m_shaders->SetUniformGLM("color", visualStates.GetCurrentColor(m_visualState, VisualStateTable::TEXT_CHANNEL));
+
+			m_geometry.vao->Bind();
+			glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+		}
 
 		glStencilFunc(GL_ALWAYS, 1, 0xFF);
 	}
@@ -270,56 +459,43 @@ namespace GUILib
 	
 	const glm::ivec2& TextBox::GetSize() const { return m_size; }
 
+	bool TextBox::MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const
+	{
+		size = m_size;
+		anchor = size / 2;
+		return true;
+	}
+
+	void TextBox::ArrangeLayout(glm::ivec2 size) { this->SetSize(size); }
+
 	const std::string& TextBox::GetHintText() const { return m_hintText->GetText(); }
 
-	const std::string& TextBox::GetInputText() const { return m_isInputVisible ? m_inputText->GetText() : m_obscuredInputText; }
+	const std::string& TextBox::GetInputText() const { return m_inputBuffer.GetText(); }
 
-	const glm::vec4& TextBox::GetColor(ComponentEvent eventEnum) const
+	glm::vec4 TextBox::GetColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedColor;
-		}
-
-		return m_baseColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::FILL_CHANNEL, eventEnum);
 	}
 
-	const glm::vec4& TextBox::GetHintTextColor(ComponentEvent eventEnum) const
+	glm::vec4 TextBox::GetHintTextColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseHintTextColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverHintTextColor;
-		}
+		if (eventEnum == ComponentEvent::CLICKED_EVENT)
+			eventEnum = ComponentEvent::NO_EVENT;
 
-		return m_baseHintTextColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::HINT_TEXT_CHANNEL, eventEnum);
 	}
 
-	const glm::vec4& TextBox::GetInputTextColor(ComponentEvent eventEnum) const
+	glm::vec4 TextBox::GetInputTextColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseInputTextColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverInputTextColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedInputTextColor;
-		}
-
-		return m_baseInputTextColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::TEXT_CHANNEL, eventEnum);
 	}
 
-	const glm::vec4& TextBox::GetBorderColor(ComponentEvent eventEnum) const
+	glm::vec4 TextBox::GetBorderColor(ComponentEvent eventEnum) const
 	{
-		switch (eventEnum)
-		{
-		case ComponentEvent::NO_EVENT: return m_baseBorderColor;
-		case ComponentEvent::HOVERED_EVENT: return m_hoverBorderColor;
-		case ComponentEvent::CLICKED_EVENT: return m_clickedBorderColor;
-		}
-
-		return m_baseBorderColor;
+		return VisualStateTable::GetInstance().GetColor(m_visualState, VisualStateTable::BORDER_CHANNEL, eventEnum);
 	}
 	
 	const int& TextBox::GetBorderThickness() const { return m_borderThickness; }
+
+	size_t TextBox::GetCaretPosition() const { return m_caretOffset; }
 }
\ No newline at end of file
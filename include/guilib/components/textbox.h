@@ -3,13 +3,18 @@
 
 #include <components/focusable_component.h>
 #include <components/label.h>
+#include <components/visual_state_table.h>
 #include <graphics/font.h>
+#include <utilities/gap_buffer.h>
 #include <utilities/timer.h>
 
 namespace GUILib
 {
 	/**
 	* @brief This is a component class for handling and displaying textboxes.
+	* The input text is edited at a caret, and is stored in a gap buffer so that typing, deleting and pasting at the caret only cost in
+	* proportion to the text inserted or erased. The displayed text is edited in place as well, so only the glyphs after the caret have their
+	* geometry regenerated.
 	* Also, make sure that whenever you are using this class you are always allocating it on the heap, not the stack.
 	*/
 	class LIB_DECLSPEC TextBox : public FocusableComponent
@@ -48,7 +53,7 @@ namespace GUILib
 		* @brief Sets the current position of the textbox component.
 		* @param[in] pos - The new position of the component.
 		*/
-		void SetPosition(glm::ivec2 pos);
+		void SetPosition(glm::ivec2 pos) override;
 
 		/**
 		* @brief Sets the current size of the textbox component.
@@ -63,7 +68,7 @@ namespace GUILib
 		void SetHintText(std::string_view text);
 
 		/**
-		* @brief Sets the textbox component's input text.
+		* @brief Sets the textbox component's input text, the caret is moved to the end of the text.
 		* @param[in] text - The input text to be assigned to the textbox.
 		*/
 		void SetInputText(std::string_view text);
@@ -112,6 +117,14 @@ namespace GUILib
 		*/
 		void Update(float deltaTime) override;
 
+		/**
+		* @brief Handles the events dispatched to the textbox component, pressing the textbox focuses it and the focused textbox is edited by
+		* the key and character events. The pointer enter, leave and move events aren't consumed, so they still bubble up to its parents.
+		* @param[in] event - The dispatched event.
+		* @return TRUE if the event is handled by the textbox, FALSE otherwise.
+		*/
+		bool HandleEvent(const UIEvent& event) override;
+
 		/**
 		* @brief Renders the textbox component.
 		* @param[in] viewport - The viewport where the component is being rendered to.
@@ -122,7 +135,7 @@ namespace GUILib
 		* @brief Returns the current position of the textbox component.
 		* @return The position of the component.
 		*/
-		const glm::ivec2& GetPosition() const;
+		const glm::ivec2& GetPosition() const override;
 
 		/**
 		* @brief Returns the size of this textbox component.
@@ -130,6 +143,29 @@ namespace GUILib
 		*/
 		const glm::ivec2& GetSize() const;
 
+		/**
+		* @brief Measures the box which the textbox occupies when arranged by a layout panel, which is the size of the textbox.
+		* @param[out] size - The size of the component's box.
+		* @param[out] anchor - The offset of the component's position from the top-left corner of its box.
+		* @return TRUE, as textboxs always occupy a box.
+		*/
+		bool MeasureLayout(glm::ivec2& size, glm::ivec2& anchor) const override;
+
+		/**
+		* @brief Resizes the textbox to the size of the box given by the layout panel arranging it.
+		* @param[in] size - The new size of the component.
+		*/
+		void ArrangeLayout(glm::ivec2 size) override;
+
+		/**
+		* @brief Retrieves the bounds of the textbox component, these are used for hit testing.
+		*
+		* @param[out] min - The top-left corner of the bounds.
+		* @param[out] max - The bottom-right corner of the bounds.
+		* @return TRUE, as textboxes always respond to the cursor.
+		*/
+		bool GetInteractionBounds(glm::vec2& min, glm::vec2& max) const override;
+
 		/**
 		* @brief Returns the hint text displayed in the textbox component.
 		* @return The textbox's hint text.
@@ -149,7 +185,7 @@ namespace GUILib
 		* 
 		* @return The textbox field color attached to the specified event.
 		*/
-		const glm::vec4& GetColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the textbox field hint text color which is displayed when the specified component event occurs.
@@ -158,7 +194,7 @@ namespace GUILib
 		* 
 		* @return The textbox field hint text color attached to the specified event.
 		*/
-		const glm::vec4& GetHintTextColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetHintTextColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the textbox field input text color which is displayed when the specified component event occurs.
@@ -167,7 +203,7 @@ namespace GUILib
 		* 
 		* @return The textbox field input text color attached to the specified event.
 		*/
-		const glm::vec4& GetInputTextColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetInputTextColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the textbox field border color which is displayed when the specified component event occurs.
@@ -176,13 +212,19 @@ namespace GUILib
 		* 
 		* @return The textbox field border color attached to the specified event.
 		*/
-		const glm::vec4& GetBorderColor(ComponentEvent eventEnum) const;
+		glm::vec4 GetBorderColor(ComponentEvent eventEnum) const;
 
 		/**
 		* @brief Returns the thickness of the textbox component's border.
 		* @return The border thickness of the textbox.
 		*/
 		const int& GetBorderThickness() const;
+
+		/**
+		* @brief Returns the position of the caret within the input text.
+		* @return The byte offset of the caret within the input text.
+		*/
+		size_t GetCaretPosition() const;
 	protected:
 		/**
 		* @brief Initialises the textbox component.
@@ -191,23 +233,65 @@ namespace GUILib
 
 		/**
 		* @brief Checks if the cursor is hovering on the textbox.
+		* The interface frame resolves the topmost component under the cursor, so this is tracked from the pointer enter and leave events.
 		* @return TRUE if cursor is hovering on textbox, FALSE otherwise.
 		*/
 		bool IsCursorHovering() const;
+	private:
+		/**
+		* @brief Edits the input text or moves the caret in response to the key pressed (or repeated) given.
+		*
+		* @param[in] key - The key pressed.
+		* @param[in] modifiers - The modifier keys held down when the key was pressed.
+		* @return TRUE if the key is handled by the textbox, FALSE otherwise.
+		*/
+		bool HandleKeyInput(KeyCode key, KeyModifier modifiers);
+
+		/**
+		* @brief Inserts the text given into the input text at the caret, then moves the caret to the end of the inserted text.
+		* @param[in] text - The UTF-8 encoded text to be inserted.
+		*/
+		void InsertInputText(std::string_view text);
+
+		/**
+		* @brief Erases a range of the input text which either starts or ends at the caret, the caret is moved to the start of the range.
+		*
+		* @param[in] offset - The byte offset of the start of the range.
+		* @param[in] length - The length (in bytes) of the range.
+		*/
+		void EraseInputText(size_t offset, size_t length);
+
+		/**
+		* @brief Returns the byte offset of the codepoint before the offset given within the input text.
+		*/
+		size_t GetPreviousCodepoint(size_t offset) const;
+
+		/**
+		* @brief Returns the byte offset of the codepoint after the offset given within the input text.
+		*/
+		size_t GetNextCodepoint(size_t offset) const;
 	private:
 		glm::ivec2 m_position, m_size;
-		glm::vec4 m_baseColor, m_hoverColor, m_clickedColor, m_currentColor;
-		glm::vec4 m_baseHintTextColor, m_hoverHintTextColor, m_currentHintTextColor;
-		glm::vec4 m_baseInputTextColor, m_hoverInputTextColor, m_clickedInputTextColor, m_currentInputTextColor;
-		glm::vec4 m_baseBorderColor, m_hoverBorderColor, m_clickedBorderColor, m_currentBorderColor;
+		VisualStateTable::Handle m_visualState; // The textbox's colors, stored in every channel of the visual state table
 
 		int m_borderThickness;
 
-		std::string m_obscuredInputText;
+		GapBuffer m_inputBuffer;
 		Label* m_hintText, *m_inputText;
-		Timer m_backspaceTimer;
+		Timer m_keyRepeatTimer, m_caretBlinkTimer;
+
+		// The key repeated by the update while it is held down (KEY_LAST if no key is repeated), along with its modifier keys
+		KeyCode m_repeatKey;
+		KeyModifier m_repeatModifiers;
+
+		// The caret position within the input text, both as a byte offset and as a codepoint index (which is the offset in obscured text)
+		size_t m_caretOffset, m_caretIndex;
+		glm::vec2 m_caretPosition;
+
+		// The cursor position mapped to the interface frame's viewport, as of the last pointer event dispatched to the textbox
+		glm::vec2 m_cursorPosition;
 
-		bool m_inputEnabled, m_isInputVisible, m_textCentered;
+		bool m_inputEnabled, m_isInputVisible, m_textCentered, m_isCursorHovering;
 	};
 }
 
@@ -0,0 +1,218 @@
+#include <components/visual_state_table.h>
+#include <graphics/shader_program.h>
+#include <algorithm>
+
+namespace GUILib
+{
+	namespace
+	{
+		inline size_t GetEventIndex(VisualState state) { return (size_t)state; }
+	}
+
+	VisualStateTable::VisualStateTable() :
+		m_transitionDuration(0.125f), m_transitionEasing(EasingFunction::LINEAR)
+	{}
+
+	VisualStateTable::Handle VisualStateTable::Create(uint8_t channelCount)
+	{
+		const glm::vec4 initialColor = { 0.0f, 0.0f, 0.0f, 1.0f };
+		channelCount = std::min(channelCount, (uint8_t)MAX_CHANNELS);
+
+		Handle handle;
+		if (!m_freeHandles.empty())
+		{
+			handle = m_freeHandles.back();
+			m_freeHandles.pop_back();
+
+			for (size_t channel = 0; channel < MAX_CHANNELS; channel++)
+			{
+				for (size_t event = 0; event < EVENT_COUNT; event++)
+					m_eventColors[channel][event][handle] = initialColor;
+			}
+
+			m_states[handle] = VisualState::BASE;
+			m_channelCounts[handle] = channelCount;
+			m_animatedChannels[handle] = 0;
+		}
+		else
+		{
+			handle = (Handle)m_states.size();
+			for (size_t channel = 0; channel < MAX_CHANNELS; channel++)
+			{
+				for (size_t event = 0; event < EVENT_COUNT; event++)
+					m_eventColors[channel][event].emplace_back(initialColor);
+
+				m_animations[channel].emplace_back();
+
+				m_currentColors[channel].emplace_back(TweenManager::INVALID_HANDLE);
+			}
+
+			m_states.emplace_back(VisualState::BASE);
+			m_channelCounts.emplace_back(channelCount);
+			m_animatedChannels.emplace_back(0);
+		}
+
+		TweenManager& tweenManager = TweenManager::GetInstance();
+		for (size_t channel = 0; channel < channelCount; channel++)
+			m_currentColors[channel][handle] = tweenManager.Create(initialColor);
+
+		return handle;
+	}
+
+	void VisualStateTable::Destroy(Handle handle)
+	{
+		if (handle >= m_states.size())
+			return;
+
+		TweenManager& tweenManager = TweenManager::GetInstance();
+		for (size_t channel = 0; channel < m_channelCounts[handle]; channel++)
+		{
+			tweenManager.Destroy(m_currentColors[channel][handle]);
+			m_currentColors[channel][handle] = TweenManager::INVALID_HANDLE;
+		}
+
+		m_channelCounts[handle] = 0;
+		m_animatedChannels[handle] = 0;
+		m_freeHandles.emplace_back(handle);
+	}
+
+	void VisualStateTable::SetColor(Handle handle, Channel channel, glm::vec4 color, ComponentEvent eventEnum)
+	{
+		if (channel >= m_channelCounts[handle])
+			return;
+
+		TweenManager& tweenManager = TweenManager::GetInstance();
+		if (eventEnum & ComponentEvent::NO_EVENT)
+		{
+			m_eventColors[channel][GetEventIndex(VisualState::BASE)][handle] = color;
+			tweenManager.SetValue(m_currentColors[channel][handle], color);
+		}
+
+		if (eventEnum & ComponentEvent::HOVERED_EVENT)
+			m_eventColors[channel][GetEventIndex(VisualState::HOVERED)][handle] = color;
+		if (eventEnum & ComponentEvent::CLICKED_EVENT)
+			m_eventColors[channel][GetEventIndex(VisualState::CLICKED)][handle] = color;
+
+		// The displayed color may no longer match the state, clicked colors are displayed straight away whereas the others are animated
+		const VisualState state = m_states[handle];
+		if (state == VisualState::CLICKED)
+			tweenManager.SetValue(m_currentColors[channel][handle], m_eventColors[channel][GetEventIndex(state)][handle]);
+		else
+			this->AnimateChannel(handle, channel);
+	}
+
+	void VisualStateTable::SetState(Handle handle, VisualState state, bool skipTransition)
+	{
+		if (state == m_states[handle] && !skipTransition && state != VisualState::CLICKED)
+			return;
+
+		m_states[handle] = state;
+		if (state != VisualState::CLICKED && !skipTransition)
+		{
+			for (size_t channel = 0; channel < m_channelCounts[handle]; channel++)
+				this->AnimateChannel(handle, channel);
+
+			return;
+		}
+
+		TweenManager& tweenManager = TweenManager::GetInstance();
+		const size_t eventIndex = GetEventIndex(state);
+		for (size_t channel = 0; channel < m_channelCounts[handle]; channel++)
+			tweenManager.SetValue(m_currentColors[channel][handle], m_eventColors[channel][eventIndex][handle]);
+	}
+
+	void VisualStateTable::SetAnimation(Handle handle, Channel channel, const ColorAnimation& animation)
+	{
+		if (channel >= m_channelCounts[handle])
+			return;
+
+		m_animations[channel][handle] = animation;
+		m_animatedChannels[handle] |= (uint8_t)(1 << channel);
+	}
+
+	void VisualStateTable::StopAnimation(Handle handle, Channel channel) { m_animatedChannels[handle] &= (uint8_t)~(1 << channel); }
+
+	void VisualStateTable::SetTransition(float duration, EasingFunction easing)
+	{
+		m_transitionDuration = duration;
+		m_transitionEasing = easing;
+	}
+
+	glm::vec4 VisualStateTable::GetColor(Handle handle, Channel channel, ComponentEvent eventEnum) const
+	{
+		switch (eventEnum)
+		{
+		case ComponentEvent::NO_EVENT: return m_eventColors[channel][GetEventIndex(VisualState::BASE)][handle];
+		case ComponentEvent::HOVERED_EVENT: return m_eventColors[channel][GetEventIndex(VisualState::HOVERED)][handle];
+		case ComponentEvent::CLICKED_EVENT: return m_eventColors[channel][GetEventIndex(VisualState::CLICKED)][handle];
+		}
+
+		return m_eventColors[channel][GetEventIndex(VisualState::BASE)][handle];
+	}
+
+	const glm::vec4& VisualStateTable::GetCurrentColor(Handle handle, Channel channel) const
+	{
+		return TweenManager::GetInstance().GetValue(m_currentColors[channel][handle]);
+	}
+
+	bool VisualStateTable::IsAnimated(Handle handle, Channel channel) const { return m_animatedChannels[handle] & (1 << channel); }
+
+	void VisualStateTable::SetColorUniforms(Handle handle, Channel channel, const ShaderProgram& shaders) const
+	{
+		if (!this->IsAnimated(handle, channel))
+		{
+			if (m_animatedChannels[handle] != 0) // Another channel of the entry may have enabled the animation uniforms
+				shaders.SetUniform("useColorAnimation", false);
+
+			shaders.SetUniformGLM("color", this->GetCurrentColor(handle, channel));
+			return;
+		}
+
+		// Only the descriptor is uploaded, the shader evaluates the animation from the global time uniform set once per frame
+		const ColorAnimation& animation = m_animations[channel][handle];
+		shaders.SetUniform("useColorAnimation", true);
+		shaders.SetUniformGLM("animStartColor", animation.startColor);
+		shaders.SetUniformGLM("animEndColor", animation.endColor);
+		shaders.SetUniform("animStartTime", animation.startTime);
+		shaders.SetUniform("animDuration", animation.duration);
+		shaders.SetUniform("animEasing", (int)animation.easing);
+		shaders.SetUniform("animRepeat", (int)animation.repeat);
+	}
+
+	void VisualStateTable::ResetColorUniforms(Handle handle, const ShaderProgram& shaders) const
+	{
+		if (m_animatedChannels[handle] != 0)
+			shaders.SetUniform("useColorAnimation", false);
+	}
+
+	VisualState VisualStateTable::GetState(Handle handle) const { return m_states[handle]; }
+
+	bool VisualStateTable::IsTransitioning(Handle handle) const
+	{
+		const TweenManager& tweenManager = TweenManager::GetInstance();
+		for (size_t channel = 0; channel < m_channelCounts[handle]; channel++)
+		{
+			if (tweenManager.IsAnimating(m_currentColors[channel][handle]))
+				return true;
+		}
+
+		return false;
+	}
+
+	float VisualStateTable::GetTransitionDuration() const { return m_transitionDuration; }
+
+	EasingFunction VisualStateTable::GetTransitionEasing() const { return m_transitionEasing; }
+
+	void VisualStateTable::AnimateChannel(Handle handle, size_t channel)
+	{
+		// Nothing is registered with the tween manager if the channel is already at (or animating to) the state's color
+		const glm::vec4& targetColor = m_eventColors[channel][GetEventIndex(m_states[handle])][handle];
+		TweenManager::GetInstance().AnimateTo(m_currentColors[channel][handle], targetColor, m_transitionDuration, m_transitionEasing);
+	}
+
+	VisualStateTable& VisualStateTable::GetInstance()
+	{
+		static VisualStateTable instance;
+		return instance;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#ifndef VISUAL_STATE_TABLE_H
+#define VISUAL_STATE_TABLE_H
+
+#include <components/component.h>
+#include <graphics/tween_manager.h>
+#include <cstdint>
+#include <vector>
+
+namespace GUILib
+{
+	class ShaderProgram;
+
+	/**
+	* @brief An enumeration representing the visual states which a component's colors transition between.
+	*/
+	enum class VisualState : uint8_t { BASE, HOVERED, CLICKED };
+
+	/**
+	* @brief This is a class which stores the visual state (the colors of each component event, and the colors currently displayed) of the
+	* interactive UI components, such as buttons, checkboxes and textboxes.
+	*
+	* The colors are stored in a structure of arrays, one array per color channel and component event, and the components only hold a handle
+	* to their entry. Components only decide which state they are in, the displayed colors are animated values of the tween manager, which
+	* only animates a color when its entry's state (or the state's color) changes.
+	*/
+	class LIB_DECLSPEC VisualStateTable
+	{
+	public:
+		/**
+		* @brief An enumeration representing the color channels of an entry, each component uses as many of them as it needs.
+		*/
+		enum Channel : uint8_t { FILL_CHANNEL, BORDER_CHANNEL, TEXT_CHANNEL, HINT_TEXT_CHANNEL, MAX_CHANNELS };
+
+		typedef uint32_t Handle;
+		static constexpr Handle INVALID_HANDLE = UINT32_MAX;
+
+		VisualStateTable(const VisualStateTable&) = delete;
+
+		/**
+		* @brief Creates an entry in the table, all of its colors are initially opaque black.
+		* @param[in] channelCount - The number of color channels used by the entry, at most MAX_CHANNELS.
+		* @return The handle of the new entry.
+		*/
+		Handle Create(uint8_t channelCount);
+
+		/**
+		* @brief Destroys an entry in the table, the entry's storage is reused by the entries created later.
+		* @param[in] handle - The handle of the entry to be destroyed.
+		*/
+		void Destroy(Handle handle);
+
+		/**
+		* @brief Sets the color of a channel to be displayed when the specified component event occurs.
+		* The color set for NO_EVENT is also displayed straight away.
+		*
+		* @param[in] handle - The handle of the entry.
+		* @param[in] channel - The color channel.
+		* @param[in] color - The new color to be assigned.
+		* @param[in] eventEnum - The component event(s) which the color is assigned to.
+		*/
+		void SetColor(Handle handle, Channel channel, glm::vec4 color, ComponentEvent eventEnum);
+
+		/**
+		* @brief Sets the visual state of an entry.
+		* The clicked colors are displayed straight away, otherwise the entry's colors are animated to the new state's colors, unless the
+		* transition is skipped.
+		*
+		* @param[in] handle - The handle of the entry.
+		* @param[in] state - The new visual state.
+		* @param[in] skipTransition - Specifies whether the new state's colors are displayed straight away.
+		*/
+		void SetState(Handle handle, VisualState state, bool skipTransition = false);
+
+		/**
+		* @brief Attaches a color animation to a channel, which is displayed in place of the channel's state colors until it is stopped.
+		* The animation is evaluated by the geometry shader, so it runs without the component being updated or its color being set each
+		* frame.
+		*
+		* @param[in] handle - The handle of the entry.
+		* @param[in] channel - The color channel, which must be rendered with the geometry shader.
+		* @param[in] animation - The animation descriptor.
+		*/
+		void SetAnimation(Handle handle, Channel channel, const ColorAnimation& animation);
+
+		/**
+		* @brief Stops the color animation of a channel, the channel displays its state colors again.
+		* @param[in] handle - The handle of the entry.
+		* @param[in] channel - The color channel.
+		*/
+		void StopAnimation(Handle handle, Channel channel);
+
+		/**
+		* @brief Sets the duration and easing curve of the transitions between the base and hovered colors, for every entry.
+		* @param[in] duration - The duration of the transitions, in seconds.
+		* @param[in] easing - The easing curve which the transitions progress along.
+		*/
+		void SetTransition(float duration, EasingFunction easing);
+
+		/**
+		* @brief Returns the color of a channel which is displayed when the specified component event occurs.
+		*
+		* @param[in] handle - The handle of the entry.
+		* @param[in] channel - The color channel.
+		* @param[in] eventEnum - The component event to retrieve the attached color from.
+		* @return The color attached to the specified event.
+		*/
+		glm::vec4 GetColor(Handle handle, Channel channel, ComponentEvent eventEnum) const;
+
+		/**
+		* @brief Returns the color of a channel which is currently displayed.
+		*
+		* @param[in] handle - The handle of the entry.
+		* @param[in] channel - The color channel.
+		* @return The current color of the channel.
+		*/
+		const glm::vec4& GetCurrentColor(Handle handle, Channel channel) const;
+
+		/**
+		* @brief Returns whether or not a channel displays a color animation.
+		* @param[in] handle - The handle of the entry.
+		* @param[in] channel - The color channel.
+		* @return TRUE if the channel has a color animation attached, FALSE otherwise.
+		*/
+		bool IsAnimated(Handle handle, Channel channel) const;
+
+		/**
+		* @brief Sets the color uniforms of the geometry shader to the color of a channel, which is either its current color or its color
+		* animation. The shader must be bound.
+		*
+		* @param[in] handle - The handle of the entry.
+		* @param[in] channel - The color channel.
+		* @param[in] shaders - The geometry shader program.
+		*/
+		void SetColorUniforms(Handle handle, Channel channel, const ShaderProgram& shaders) const;
+
+		/**
+		* @brief Disables the color animation uniforms of the geometry shader, if any of an entry's channels set them, so that the geometry
+		* rendered afterwards (by the same or other components) is displayed in its plain color. The shader must be bound.
+		*
+		* @param[in] handle - The handle of the entry.
+		* @param[in] shaders - The geometry shader program.
+		*/
+		void ResetColorUniforms(Handle handle, const ShaderProgram& shaders) const;
+
+		/**
+		* @brief Returns the visual state of an entry.
+		* @param[in] handle - The handle of the entry.
+		* @return The visual state of the entry.
+		*/
+		VisualState GetState(Handle handle) const;
+
+		/**
+		* @brief Returns whether or not the colors of an entry are still transitioning to its state's colors.
+		* @param[in] handle - The handle of the entry.
+		* @return TRUE if the entry is transitioning, FALSE otherwise.
+		*/
+		bool IsTransitioning(Handle handle) const;
+
+		/**
+		* @brief Returns the duration of the transitions between the base and hovered colors.
+		* @return The duration of the transitions, in seconds.
+		*/
+		float GetTransitionDuration() const;
+
+		/**
+		* @brief Returns the easing curve of the transitions between the base and hovered colors.
+		* @return The easing curve of the transitions.
+		*/
+		EasingFunction GetTransitionEasing() const;
+
+		VisualStateTable& operator=(const VisualStateTable&) = delete;
+
+		/**
+		* @brief Returns the visual state table singleton instance.
+		* @return The visual state table instance.
+		*/
+		static VisualStateTable& GetInstance();
+	private:
+		VisualStateTable();
+
+		~VisualStateTable() = default;
+
+		/**
+		* @brief Animates the displayed color of a channel to the color of the entry's state.
+		*/
+		void AnimateChannel(Handle handle, size_t channel);
+	private:
+		static constexpr size_t EVENT_COUNT = 3; // The base, hovered and clicked colors
+
+		// The colors of every entry, in a separate array per channel and component event. The displayed colors are values animated by the
+		// tween manager, entries which use fewer channels don't have animated values for the remaining channels.
+		std::vector<glm::vec4> m_eventColors[MAX_CHANNELS][EVENT_COUNT];
+		std::vector<TweenManager::Handle> m_currentColors[MAX_CHANNELS];
+		std::vector<VisualState> m_states;
+		std::vector<uint8_t> m_channelCounts;
+
+		// The color animations of every entry, only the channels whose bit is set in the entry's animated channel mask have an animation
+		std::vector<ColorAnimation> m_animations[MAX_CHANNELS];
+		std::vector<uint8_t> m_animatedChannels;
+		std::vector<Handle> m_freeHandles;
+
+		float m_transitionDuration;
+		EasingFunction m_transitionEasing;
+	};
+}
+
+#endif
\ No newline at end of file
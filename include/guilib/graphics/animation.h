@@ -3,9 +3,55 @@
 
 #include <utilities/libexport.h>
 #include <external/glm/glm/glm.hpp>
+#include <cstdint>
 
 namespace GUILib
 {
+	/**
+	* @brief An enumeration representing the easing curves which an animation can progress along.
+	* The geometry shader evaluates the same curves, by the enumeration's underlying values.
+	*/
+	enum class EasingFunction : uint8_t { LINEAR, EASE_IN_QUAD, EASE_OUT_QUAD, EASE_IN_OUT_QUAD, EASE_OUT_CUBIC };
+
+	/**
+	* @brief Maps the linear progress of an animation onto an easing curve.
+	*
+	* @param[in] easing - The easing curve.
+	* @param[in] progress - The linear progress of the animation, between 0 and 1.
+	*
+	* @return The eased progress of the animation, which is 0 and 1 at the start and end of the animation respectively.
+	*/
+	static inline float Ease(EasingFunction easing, float progress)
+	{
+		switch (easing)
+		{
+		case EasingFunction::EASE_IN_QUAD: return progress * progress;
+		case EasingFunction::EASE_OUT_QUAD: return 1.0f - ((1.0f - progress) * (1.0f - progress));
+		case EasingFunction::EASE_IN_OUT_QUAD:
+			return progress < 0.5f ? 2.0f * progress * progress : 1.0f - (2.0f * (1.0f - progress) * (1.0f - progress));
+		case EasingFunction::EASE_OUT_CUBIC: return 1.0f - ((1.0f - progress) * (1.0f - progress) * (1.0f - progress));
+		default: return progress;
+		}
+	}
+
+	/**
+	* @brief An enumeration representing how an animation carries on once its duration has elapsed.
+	*/
+	enum class AnimationRepeat : uint8_t { NONE, LOOP, PING_PONG };
+
+	/**
+	* @brief This is a structure describing a time-based color animation which is evaluated by the geometry shader, from the time elapsed
+	* since its start time, so a running animation doesn't need to be advanced (or its color uploaded) by the CPU every frame.
+	*/
+	struct ColorAnimation
+	{
+		glm::vec4 startColor, endColor;
+		float startTime; // The time which the animation starts at, in seconds on the tween manager's clock (see TweenManager::GetTime())
+		float duration; // The duration of a single run of the animation, in seconds
+		EasingFunction easing;
+		AnimationRepeat repeat;
+	};
+
 	/**
 	* @brief Animation method for linearly transitioning a value from the base point to the target point.
 	* 
@@ -42,10 +88,10 @@ namespace GUILib
 	* @return The new calculated vector.
 	*/
 	template<>
-	static glm::vec2 FadeTo<glm::vec2>(glm::vec2 currentVal, glm::vec2 baseVal, glm::vec2 targetVal, float speed, float deltaTime)
+	inline glm::vec2 FadeTo<glm::vec2>(glm::vec2 currentVal, glm::vec2 baseVal, glm::vec2 targetVal, float speed, float deltaTime)
 	{
-		currentVal.x = FadeTo<double>(currentVal.x, baseVal.x, targetVal.x, speed, deltaTime);
-		currentVal.y = FadeTo<double>(currentVal.y, baseVal.y, targetVal.y, speed, deltaTime);
+		currentVal.x = FadeTo<float>(currentVal.x, baseVal.x, targetVal.x, speed, deltaTime);
+		currentVal.y = FadeTo<float>(currentVal.y, baseVal.y, targetVal.y, speed, deltaTime);
 		return currentVal;
 	}
 
@@ -61,11 +107,11 @@ namespace GUILib
 	* @return The new calculated vector.
 	*/
 	template<>
-	static glm::vec3 FadeTo<glm::vec3>(glm::vec3 currentVal, glm::vec3 baseVal, glm::vec3 targetVal, float speed, float deltaTime)
+	inline glm::vec3 FadeTo<glm::vec3>(glm::vec3 currentVal, glm::vec3 baseVal, glm::vec3 targetVal, float speed, float deltaTime)
 	{
-		currentVal.x = FadeTo<double>(currentVal.x, baseVal.x, targetVal.x, speed, deltaTime);
-		currentVal.y = FadeTo<double>(currentVal.y, baseVal.y, targetVal.y, speed, deltaTime);
-		currentVal.z = FadeTo<double>(currentVal.z, baseVal.z, targetVal.z, speed, deltaTime);
+		currentVal.x = FadeTo<float>(currentVal.x, baseVal.x, targetVal.x, speed, deltaTime);
+		currentVal.y = FadeTo<float>(currentVal.y, baseVal.y, targetVal.y, speed, deltaTime);
+		currentVal.z = FadeTo<float>(currentVal.z, baseVal.z, targetVal.z, speed, deltaTime);
 		return currentVal;
 	}
 
@@ -81,12 +127,12 @@ namespace GUILib
 	* @return The new calculated vector.
 	*/
 	template<>
-	static glm::vec4 FadeTo<glm::vec4>(glm::vec4 currentVal, glm::vec4 baseVal, glm::vec4 targetVal, float speed, float deltaTime)
+	inline glm::vec4 FadeTo<glm::vec4>(glm::vec4 currentVal, glm::vec4 baseVal, glm::vec4 targetVal, float speed, float deltaTime)
 	{
-		currentVal.x = FadeTo<double>(currentVal.x, baseVal.x, targetVal.x, speed, deltaTime);
-		currentVal.y = FadeTo<double>(currentVal.y, baseVal.y, targetVal.y, speed, deltaTime);
-		currentVal.z = FadeTo<double>(currentVal.z, baseVal.z, targetVal.z, speed, deltaTime);
-		currentVal.w = FadeTo<double>(currentVal.w, baseVal.w, targetVal.w, speed, deltaTime);
+		currentVal.x = FadeTo<float>(currentVal.x, baseVal.x, targetVal.x, speed, deltaTime);
+		currentVal.y = FadeTo<float>(currentVal.y, baseVal.y, targetVal.y, speed, deltaTime);
+		currentVal.z = FadeTo<float>(currentVal.z, baseVal.z, targetVal.z, speed, deltaTime);
+		currentVal.w = FadeTo<float>(currentVal.w, baseVal.w, targetVal.w, speed, deltaTime);
 		return currentVal;
 	}
 }
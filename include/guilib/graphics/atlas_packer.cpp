@@ -0,0 +1,120 @@
+#include <graphics/atlas_packer.h>
+#include <algorithm>
+#include <limits>
+
+namespace GUILib
+{
+	AtlasPacker::AtlasPacker(glm::ivec2 size, int spacing) :
+		m_size(size), m_spacing(spacing)
+	{
+		this->Reset();
+	}
+
+	bool AtlasPacker::FitRectangle(size_t nodeIndex, glm::ivec2 size, int& y) const
+	{
+		const int x = m_skyline[nodeIndex].x;
+		if (x + size.x > m_size.x)
+			return false;
+
+		// The rectangle rests on the highest skyline node underneath it
+		y = 0;
+		int remainingWidth = size.x;
+
+		for (size_t i = nodeIndex; remainingWidth > 0; i++)
+		{
+			y = std::max(y, m_skyline[i].y);
+			if (y + size.y > m_size.y)
+				return false;
+
+			remainingWidth -= m_skyline[i].width;
+		}
+
+		return true;
+	}
+
+	bool AtlasPacker::Pack(glm::ivec2 size, glm::ivec2& position)
+	{
+		// Leave a gap to the right of and below every rectangle, so that neighbouring rectangles don't bleed into each other when sampled
+		const glm::ivec2 paddedSize = size + glm::ivec2(m_spacing);
+
+		// Find the position where the rectangle's bottom edge would be the lowest, preferring narrower nodes when tied
+		size_t bestIndex = m_skyline.size();
+		int bestBottom = std::numeric_limits<int>::max(), bestWidth = std::numeric_limits<int>::max();
+
+		for (size_t i = 0; i < m_skyline.size(); i++)
+		{
+			int y = 0;
+			if (!this->FitRectangle(i, paddedSize, y))
+				continue;
+
+			if (y + paddedSize.y < bestBottom || (y + paddedSize.y == bestBottom && m_skyline[i].width < bestWidth))
+			{
+				bestIndex = i;
+				bestBottom = y + paddedSize.y;
+				bestWidth = m_skyline[i].width;
+			}
+		}
+
+		if (bestIndex == m_skyline.size())
+			return false;
+
+		position = { m_skyline[bestIndex].x, bestBottom - paddedSize.y };
+
+		// Insert the top edge of the rectangle into the skyline, then shrink or remove the nodes it now covers
+		m_skyline.insert(m_skyline.begin() + bestIndex, { position.x, bestBottom, paddedSize.x });
+
+		for (size_t i = bestIndex + 1; i < m_skyline.size();)
+		{
+			const int coveredEnd = m_skyline[i - 1].x + m_skyline[i - 1].width;
+			if (m_skyline[i].x >= coveredEnd)
+				break;
+
+			const int overlap = coveredEnd - m_skyline[i].x;
+			if (overlap < m_skyline[i].width)
+			{
+				m_skyline[i].x += overlap;
+				m_skyline[i].width -= overlap;
+				break;
+			}
+
+			m_skyline.erase(m_skyline.begin() + i);
+		}
+
+		this->MergeSkyline();
+		return true;
+	}
+
+	void AtlasPacker::MergeSkyline()
+	{
+		for (size_t i = 0; i + 1 < m_skyline.size();)
+		{
+			if (m_skyline[i].y == m_skyline[i + 1].y)
+			{
+				m_skyline[i].width += m_skyline[i + 1].width;
+				m_skyline.erase(m_skyline.begin() + i + 1);
+			}
+			else
+				i++;
+		}
+	}
+
+	void AtlasPacker::Resize(glm::ivec2 size)
+	{
+		// Any extra width is added to the skyline as an empty node at ground level
+		if (size.x > m_size.x)
+		{
+			m_skyline.push_back({ m_size.x, 0, size.x - m_size.x });
+			this->MergeSkyline();
+		}
+
+		m_size = glm::max(m_size, size);
+	}
+
+	void AtlasPacker::Reset()
+	{
+		m_skyline.clear();
+		m_skyline.push_back({ 0, 0, m_size.x });
+	}
+
+	const glm::ivec2& AtlasPacker::GetSize() const { return m_size; }
+}
\ No newline at end of file
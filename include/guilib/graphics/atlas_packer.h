@@ -0,0 +1,83 @@
+#ifndef ATLAS_PACKER_H
+#define ATLAS_PACKER_H
+
+#include <utilities/libexport.h>
+#include <external/glm/glm/glm.hpp>
+#include <vector>
+
+namespace GUILib
+{
+	/**
+	* @brief This is a class for packing rectangles (e.g. glyph bitmaps) into a texture atlas, using the skyline bottom-left algorithm.
+	* The packer only keeps track of the top edge (the skyline) of the packed rectangles, and places each new rectangle wherever it ends up
+	* the lowest, which keeps the packed area compact while being cheap to update.
+	*/
+	class LIB_DECLSPEC AtlasPacker
+	{
+	public:
+		/**
+		* @brief This is a class constructor for setting up an empty atlas of the given size.
+		* 
+		* @param[in] size - The size of the atlas (in pixels).
+		* @param[in] spacing - The gap (in pixels) to leave between packed rectangles.
+		*/
+		AtlasPacker(glm::ivec2 size, int spacing);
+
+		~AtlasPacker() = default;
+
+		/**
+		* @brief Finds space for a rectangle of the size given and marks it as used.
+		* 
+		* @param[in] size - The size of the rectangle to be packed.
+		* @param[out] position - The position of the top-left corner of the space found.
+		* @return TRUE if the rectangle was packed, FALSE if there isn't enough space left in the atlas.
+		*/
+		bool Pack(glm::ivec2 size, glm::ivec2& position);
+
+		/**
+		* @brief Enlarges the atlas, previously packed rectangles keep their positions.
+		* @param[in] size - The new size of the atlas, this must not be smaller than the current size.
+		*/
+		void Resize(glm::ivec2 size);
+
+		/**
+		* @brief Removes every packed rectangle, making the whole atlas available again.
+		*/
+		void Reset();
+
+		/**
+		* @brief Returns the size of the atlas.
+		* @return The size of the atlas (in pixels).
+		*/
+		const glm::ivec2& GetSize() const;
+	private:
+		/**
+		* @brief A struct describing a horizontal segment of the skyline.
+		*/
+		struct SkylineNode
+		{
+			int x, y, width;
+		};
+
+		/**
+		* @brief Calculates the height at which a rectangle would rest if placed with its left edge on the skyline node specified.
+		* 
+		* @param[in] nodeIndex - The index of the skyline node.
+		* @param[in] size - The size of the rectangle.
+		* @param[out] y - The vertical position the rectangle would be placed at.
+		* @return TRUE if the rectangle fits within the atlas at that position, FALSE otherwise.
+		*/
+		bool FitRectangle(size_t nodeIndex, glm::ivec2 size, int& y) const;
+
+		/**
+		* @brief Joins neighbouring skyline nodes which are at the same height.
+		*/
+		void MergeSkyline();
+	private:
+		std::vector<SkylineNode> m_skyline;
+		glm::ivec2 m_size;
+		int m_spacing;
+	};
+}
+
+#endif
\ No newline at end of file
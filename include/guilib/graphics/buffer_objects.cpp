@@ -68,7 +68,8 @@ namespace GUILib
 
         // Fill the texture buffer with the pixel data given (then generate mipmaps if specified to do so)
         glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, pixelData);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        if (genMipmaps)
+            glGenerateMipmap(GL_TEXTURE_2D);
 
         // Unbind the texture buffer
         glBindTexture(GL_TEXTURE_2D, 0);
@@ -1,20 +1,809 @@
 #include <graphics/font.h>
 #include <graphics/buffer_objects.h>
+#include <graphics/text_layout_cache.h>
+#include <utilities/resource_loader.h>
+
+#include <external/freetype/include/ft2build.h>
+#include <external/freetype/include/freetype/freetype.h>
+#include <external/freetype/include/freetype/ftsizes.h>
+
 #include <algorithm>
+#include <cstring>
+#include <cmath>
 
 namespace GUILib
 {
-	Font::Font(TextureBuffer2D* textureAtlas, const std::unordered_map<char, GlyphMetrics>& glyphMetricsSet) :
-		m_textureAtlas(textureAtlas), m_glyphMetricsSet(glyphMetricsSet)
-	{}
+	static_assert(sizeof(Font::GlyphMetrics) == 16, "Glyph metrics are expected to be packed into 16 bytes");
+
+	Font::Font(FT_Library freetypeLib, std::vector<uint8_t>&& fontFileData, FontRenderMode renderMode) :
+		m_freetypeLib(freetypeLib), m_fontFace(nullptr), m_fontFileData(std::move(fontFileData)), m_renderMode(renderMode),
+		m_glyphPadding(renderMode == FontRenderMode::SIGNED_DISTANCE_FIELD ? ResourceConstants::fontSDFSpread : 0), m_hasKerning(false),
+		m_isKerningKnown(false), m_defaultPixelSize(ResourceConstants::fontGlyphPixelSize),
+		m_maxAtlasPages(ResourceConstants::fontAtlasMaxPages), m_maxAtlasPageSize(ResourceConstants::fontAtlasMaxPageSize),
+		m_atlasMemoryBudget(ResourceConstants::fontAtlasMemoryBudget), m_useCounter(0), m_atlasGeneration(0)
+	{
+		// Make sure the atlas pages don't exceed the largest texture size supported by the GPU
+		int maxTextureSize = 0;
+		glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+		if (maxTextureSize > 0)
+			m_maxAtlasPageSize = std::min(m_maxAtlasPageSize, (uint32_t)maxTextureSize);
+	}
+
+	Font::~Font()
+	{
+		TextLayoutCache::GetInstance().RemoveFont(this);
+
+		for (SizeBucket& bucket : m_sizeBuckets)
+		{
+			for (AtlasPage& page : bucket.atlasPages)
+				delete page.texture;
+		}
+
+		if (m_fontFace)
+			FT_Done_Face(m_fontFace); // The size objects of the size buckets are freed along with the face
+	}
+
+	FT_Face Font::GetFontFace() const
+	{
+		if (m_fontFace)
+			return m_fontFace;
+
+		const FT_Error resultCode = FT_New_Memory_Face(m_freetypeLib, m_fontFileData.data(), (FT_Long)m_fontFileData.size(), 0, &m_fontFace);
+		if (resultCode != 0)
+		{
+			m_fontFace = nullptr;
+			throw std::exception(FT_Error_String(resultCode));
+		}
+
+		m_hasKerning = FT_HAS_KERNING(m_fontFace);
+		m_isKerningKnown = true;
+		return m_fontFace;
+	}
+
+	bool Font::ActivateSizeBucket(SizeBucket& bucket) const
+	{
+		if (bucket.size)
+			return FT_Activate_Size(bucket.size) == 0;
+
+		// Create a new size object for the pixel size, so that the pixel size of the shared font face doesn't have to be changed back and forth
+		const FT_Face fontFace = this->GetFontFace();
+
+		FT_Error resultCode = FT_New_Size(fontFace, &bucket.size);
+		if (resultCode == 0)
+			resultCode = FT_Activate_Size(bucket.size);
+		if (resultCode == 0)
+			resultCode = FT_Set_Pixel_Sizes(fontFace, 0, bucket.pixelSize);
+
+		if (resultCode != 0)
+			throw std::exception(FT_Error_String(resultCode));
+
+		bucket.lineHeight = (int)(bucket.size->metrics.height >> 6);
+		bucket.ascender = (int)(bucket.size->metrics.ascender >> 6);
+		bucket.hasLineMetrics = true;
+		return true;
+	}
+
+	bool Font::HasKerning() const
+	{
+		if (!m_isKerningKnown)
+			this->GetFontFace();
+
+		return m_hasKerning;
+	}
+
+	Font::SizeBucket& Font::GetSizeBucket(uint32_t pixelSize) const
+	{
+		if (pixelSize == 0)
+			pixelSize = m_defaultPixelSize;
+
+		for (SizeBucket& bucket : m_sizeBuckets)
+		{
+			if (bucket.pixelSize == pixelSize)
+				return bucket;
+		}
+
+		// The bucket's size object is created once the font face is first used at the pixel size, cached glyphs are added without it
+		SizeBucket bucket;
+		bucket.pixelSize = pixelSize;
+
+		m_sizeBuckets.emplace_back(std::move(bucket));
+		return m_sizeBuckets.back();
+	}
+
+	const Font::SizeBucket* Font::FindSizeBucket(uint32_t pixelSize) const
+	{
+		if (pixelSize == 0)
+			pixelSize = m_defaultPixelSize;
+
+		for (const SizeBucket& bucket : m_sizeBuckets)
+		{
+			if (bucket.pixelSize == pixelSize)
+				return &bucket;
+		}
+
+		return nullptr;
+	}
+
+	const Font::GlyphMetrics& Font::RasterizeGlyph(SizeBucket& bucket, uint32_t codepoint) const
+	{
+		// If the glyph can't be loaded, store empty metrics for it so that loading isn't attempted again
+		const bool renderSDF = m_renderMode == FontRenderMode::SIGNED_DISTANCE_FIELD;
+		if (!this->ActivateSizeBucket(bucket) || FT_Load_Char(m_fontFace, codepoint, renderSDF ? FT_LOAD_DEFAULT : FT_LOAD_RENDER) != 0)
+		{
+			this->AddGlyph(bucket, codepoint, GlyphMetrics(), nullptr);
+			return *bucket.glyphTable.Find(codepoint);
+		}
+
+		// Generate the distance field from the glyph outline, glyphs without an outline (e.g. whitespace) are left without a bitmap
+		if (renderSDF && m_fontFace->glyph->outline.n_points > 0)
+			FT_Render_Glyph(m_fontFace->glyph, FT_RENDER_MODE_SDF);
+
+		const FT_Bitmap& bitmap = m_fontFace->glyph->bitmap;
+
+		GlyphMetrics metrics;
+		metrics.bearing = glm::i16vec2(m_fontFace->glyph->bitmap_left, m_fontFace->glyph->bitmap_top);
+		metrics.size = glm::i16vec2(bitmap.width, bitmap.rows);
+		metrics.advance = (int16_t)(m_fontFace->glyph->advance.x >> 6);
+
+		// Copy the glyph bitmap row by row, since the bitmap pitch may include padding
+		std::vector<uint8_t> glyphBitmap(bitmap.width * bitmap.rows);
+		for (uint32_t row = 0; row < bitmap.rows; row++)
+			std::memcpy(glyphBitmap.data() + (row * bitmap.width), bitmap.buffer + (row * bitmap.pitch), bitmap.width);
+
+		this->AddGlyph(bucket, codepoint, metrics, glyphBitmap.data());
+		return *bucket.glyphTable.Find(codepoint);
+	}
+
+	void Font::AddGlyph(uint32_t codepoint, const GlyphMetrics& metrics, const uint8_t* bitmapData, uint32_t pixelSize) const
+	{
+		if (codepoint <= GlyphTable::maxCodepoint)
+			this->AddGlyph(this->GetSizeBucket(pixelSize), codepoint, metrics, bitmapData);
+	}
+
+	void Font::AddGlyph(SizeBucket& bucket, uint32_t codepoint, const GlyphMetrics& metrics, const uint8_t* bitmapData) const
+	{
+		if (bucket.glyphTable.Find(codepoint))
+			return;
+
+		GlyphMetrics& storedMetrics = bucket.glyphTable.Insert(codepoint);
+		storedMetrics.size = metrics.size;
+		storedMetrics.bearing = metrics.bearing;
+		storedMetrics.advance = metrics.advance;
+
+		// Glyphs without a bitmap (e.g. whitespace) don't take up any space in the atlas
+		const glm::ivec2 size = glm::ivec2(metrics.size);
+		if (size.x <= 0 || size.y <= 0 || !bitmapData)
+			return;
+
+		uint32_t pageIndex = 0;
+		glm::ivec2 offset = glm::ivec2(0);
+		if (!this->AllocateAtlasRegion(bucket, size, pageIndex, offset))
+		{
+			storedMetrics.size = glm::i16vec2(0);
+			return;
+		}
+
+		// Write the glyph bitmap into the page's pixel data, then extend the region which needs uploading
+		AtlasPage& page = bucket.atlasPages[pageIndex];
+		const int pageWidth = page.packer.GetSize().x;
+
+		storedMetrics.atlasOffset = glm::u16vec2(offset);
+		storedMetrics.atlasPage = (uint8_t)pageIndex;
+
+		for (int row = 0; row < size.y; row++)
+			std::memcpy(page.pixelData.data() + ((offset.y + row) * pageWidth) + offset.x, bitmapData + (row * size.x), size.x);
+
+		if (page.dirtyMax.x <= page.dirtyMin.x || page.dirtyMax.y <= page.dirtyMin.y)
+		{
+			page.dirtyMin = offset;
+			page.dirtyMax = offset + size;
+		}
+		else
+		{
+			page.dirtyMin = glm::min(page.dirtyMin, offset);
+			page.dirtyMax = glm::max(page.dirtyMax, offset + size);
+		}
+
+		page.glyphs.emplace_back(codepoint);
+		bucket.lastUsed = ++m_useCounter;
+		bucket.glyphTable.Touch(codepoint, m_useCounter);
+	}
+
+	bool Font::AllocateAtlasRegion(SizeBucket& bucket, glm::ivec2 size, uint32_t& page, glm::ivec2& offset) const
+	{
+		const int spacing = (int)ResourceConstants::fontGlyphAtlasSpacing;
+		if (size.x + spacing > (int)m_maxAtlasPageSize || size.y + spacing > (int)m_maxAtlasPageSize)
+			return false;
+
+		// Try to fit the glyph into one of the existing pages
+		for (page = 0; page < (uint32_t)bucket.atlasPages.size(); page++)
+		{
+			if (bucket.atlasPages[page].packer.Pack(size, offset))
+				return true;
+		}
+
+		// Only the newest page can be smaller than the largest page size, so keep growing it until the glyph fits
+		if (!bucket.atlasPages.empty())
+		{
+			page = (uint32_t)bucket.atlasPages.size() - 1;
+			while (this->GrowAtlasPage(bucket, page))
+			{
+				if (bucket.atlasPages[page].packer.Pack(size, offset))
+					return true;
+			}
+		}
+
+		// Every page is full, so either add a new page or evict the least recently used page
+		if (bucket.atlasPages.size() < m_maxAtlasPages)
+		{
+			const glm::ivec2 pageSize = glm::ivec2(std::min(ResourceConstants::fontAtlasInitialPageSize, m_maxAtlasPageSize));
+
+			AtlasPage newPage;
+			newPage.pixelData.resize((size_t)pageSize.x * pageSize.y, 0);
+			newPage.packer = AtlasPacker(pageSize, spacing);
+			this->CreateAtlasPageTexture(newPage);
+
+			bucket.atlasPages.emplace_back(std::move(newPage));
+			page = (uint32_t)bucket.atlasPages.size() - 1;
+			this->EnforceAtlasMemoryBudget(bucket);
+
+			while (!bucket.atlasPages[page].packer.Pack(size, offset))
+			{
+				if (!this->GrowAtlasPage(bucket, page))
+					return false;
+			}
+
+			return true;
+		}
+
+		// The page limit has been reached, so evict the coldest glyphs until the glyph fits into one of the compacted pages
+		while (this->EvictColdGlyphs(bucket))
+		{
+			for (page = 0; page < (uint32_t)bucket.atlasPages.size(); page++)
+			{
+				if (bucket.atlasPages[page].packer.Pack(size, offset))
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool Font::GrowAtlasPage(SizeBucket& bucket, uint32_t pageIndex) const
+	{
+		AtlasPage& page = bucket.atlasPages[pageIndex];
+		const glm::ivec2 oldSize = page.packer.GetSize();
+
+		// Double the shorter side of the page, so the page stays near-square
+		glm::ivec2 newSize = oldSize;
+		if (oldSize.x <= oldSize.y)
+			newSize.x *= 2;
+		else
+			newSize.y *= 2;
+
+		if (newSize.x > (int)m_maxAtlasPageSize || newSize.y > (int)m_maxAtlasPageSize)
+			return false;
+
+		// Copy the existing pixel data into the top-left corner of the enlarged page
+		std::vector<uint8_t> pixelData((size_t)newSize.x * newSize.y, 0);
+		for (int row = 0; row < oldSize.y; row++)
+			std::memcpy(pixelData.data() + (row * newSize.x), page.pixelData.data() + (row * oldSize.x), oldSize.x);
+
+		page.pixelData = std::move(pixelData);
+		page.packer.Resize(newSize);
+		this->CreateAtlasPageTexture(page);
+
+		// The glyphs keep their pixel positions, however their texture coordinates change along with the page size
+		m_atlasGeneration++;
+		this->EnforceAtlasMemoryBudget(bucket);
+		return true;
+	}
+
+	void Font::CreateAtlasPageTexture(AtlasPage& page) const
+	{
+		const glm::ivec2& pageSize = page.packer.GetSize();
+
+		if (page.texture)
+			delete page.texture;
+
+		// The atlas is only sampled at the size it was rasterized at (or magnified), so mipmaps aren't generated
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // Disregard unpack byte-alignment
+		page.texture = new TextureBuffer2D(GL_RED, pageSize.x, pageSize.y, GL_RED, GL_UNSIGNED_BYTE, page.pixelData.data(), false);
+		page.texture->SetWrapMode(GL_CLAMP_TO_BORDER, GL_CLAMP_TO_BORDER);
+
+		// The texture was created with the page's full pixel data, so nothing is left to upload
+		page.dirtyMin = page.dirtyMax = { 0, 0 };
+	}
+
+	bool Font::EvictColdGlyphs(SizeBucket& bucket) const
+	{
+		std::vector<std::pair<uint64_t, uint32_t>> glyphUses; // When each glyph in the atlas was last used, along with its codepoint
+		for (const AtlasPage& page : bucket.atlasPages)
+		{
+			for (const uint32_t codepoint : page.glyphs)
+				glyphUses.emplace_back(bucket.glyphTable.GetLastUsed(codepoint), codepoint);
+		}
+
+		if (glyphUses.empty())
+			return false;
+
+		// Only the least recently used glyphs are evicted, the glyphs of the text currently displayed have been used more recently
+		const size_t evictedCount = std::clamp((size_t)(glyphUses.size() * ResourceConstants::fontAtlasEvictionFraction), (size_t)1,
+			glyphUses.size());
+
+		std::nth_element(glyphUses.begin(), glyphUses.begin() + (evictedCount - 1), glyphUses.end());
+		for (size_t i = 0; i < evictedCount; i++)
+			bucket.glyphTable.Erase(glyphUses[i].second);
+
+		for (uint32_t page = 0; page < (uint32_t)bucket.atlasPages.size(); page++)
+			this->CompactAtlasPage(bucket, page);
+
+		// The remaining glyphs may have moved within their pages
+		m_atlasGeneration++;
+		return true;
+	}
+
+	void Font::CompactAtlasPage(SizeBucket& bucket, uint32_t pageIndex) const
+	{
+		AtlasPage& page = bucket.atlasPages[pageIndex];
+
+		std::vector<uint32_t> remainingGlyphs;
+		remainingGlyphs.reserve(page.glyphs.size());
+		for (const uint32_t codepoint : page.glyphs)
+		{
+			if (bucket.glyphTable.Find(codepoint))
+				remainingGlyphs.emplace_back(codepoint);
+		}
+
+		if (remainingGlyphs.size() == page.glyphs.size()) // Nothing was evicted from the page
+			return;
+
+		// Pack the remaining glyphs tallest first, which keeps the skyline of the packer even
+		std::sort(remainingGlyphs.begin(), remainingGlyphs.end(), [&bucket](uint32_t lhs, uint32_t rhs) {
+			return bucket.glyphTable.Find(lhs)->size.y > bucket.glyphTable.Find(rhs)->size.y;
+			});
+
+		// Clear the page, copying the bitmaps of the remaining glyphs over from its previous pixel data
+		const int pageWidth = page.packer.GetSize().x;
+		std::vector<uint8_t> previousPixelData(page.pixelData.size(), 0);
+		previousPixelData.swap(page.pixelData);
+		page.glyphs.clear();
+		page.packer.Reset();
+
+		for (const uint32_t codepoint : remainingGlyphs)
+		{
+			GlyphMetrics& metrics = *bucket.glyphTable.Find(codepoint);
+			const glm::ivec2 size = glm::ivec2(metrics.size);
+
+			// The glyphs are packed in another order than they were originally, so a glyph may no longer fit, in which case it's evicted too
+			glm::ivec2 offset = glm::ivec2(0);
+			if (!page.packer.Pack(size, offset))
+			{
+				bucket.glyphTable.Erase(codepoint);
+				continue;
+			}
+
+			for (int row = 0; row < size.y; row++)
+			{
+				std::memcpy(page.pixelData.data() + ((offset.y + row) * pageWidth) + offset.x,
+					previousPixelData.data() + ((metrics.atlasOffset.y + row) * pageWidth) + metrics.atlasOffset.x, size.x);
+			}
+
+			metrics.atlasOffset = glm::u16vec2(offset);
+			page.glyphs.emplace_back(codepoint);
+		}
+
+		// The whole page is uploaded again, so the evicted glyph bitmaps don't linger in the texture
+		page.dirtyMin = { 0, 0 };
+		page.dirtyMax = page.packer.GetSize();
+	}
+
+	void Font::EnforceAtlasMemoryBudget(const SizeBucket& activeBucket) const
+	{
+		while (this->GetAtlasMemoryUsage() > m_atlasMemoryBudget)
+		{
+			// Find the least recently used size bucket which still has an atlas
+			SizeBucket* leastRecentlyUsed = nullptr;
+			for (SizeBucket& bucket : m_sizeBuckets)
+			{
+				if (&bucket != &activeBucket && !bucket.atlasPages.empty() &&
+					(!leastRecentlyUsed || bucket.lastUsed < leastRecentlyUsed->lastUsed))
+					leastRecentlyUsed = &bucket;
+			}
+
+			if (!leastRecentlyUsed)
+				break;
+
+			// Free the size bucket's atlas, its glyphs will be rasterized again if the size bucket gets used again
+			for (AtlasPage& page : leastRecentlyUsed->atlasPages)
+				delete page.texture;
+
+			leastRecentlyUsed->atlasPages.clear();
+			leastRecentlyUsed->glyphTable.Clear();
+			m_atlasGeneration++;
+		}
+	}
+
+	void Font::SetFaceMetrics(const FaceMetrics& metrics) const
+	{
+		SizeBucket& bucket = this->GetSizeBucket(0);
+		if (!bucket.hasLineMetrics)
+		{
+			bucket.lineHeight = metrics.lineHeight;
+			bucket.ascender = metrics.ascender;
+			bucket.hasLineMetrics = true;
+		}
+
+		if (!m_isKerningKnown)
+		{
+			m_hasKerning = metrics.hasKerning;
+			m_isKerningKnown = true;
+		}
+	}
+
+	Font::FaceMetrics Font::GetFaceMetrics() const
+	{
+		FaceMetrics metrics;
+		metrics.lineHeight = this->GetLineHeight();
+		metrics.ascender = this->GetAscender();
+		metrics.hasKerning = this->HasKerning();
+		return metrics;
+	}
+
+	bool Font::GetGlyphBitmap(uint32_t codepoint, std::vector<uint8_t>& bitmapData, uint32_t pixelSize) const
+	{
+		const SizeBucket* bucket = this->FindSizeBucket(pixelSize);
+		if (!bucket)
+			return false;
+
+		const GlyphMetrics* glyph = bucket->glyphTable.Find(codepoint);
+		if (!glyph)
+			return false;
+
+		const GlyphMetrics& metrics = *glyph;
+		bitmapData.resize((size_t)metrics.size.x * metrics.size.y);
+
+		if (!bitmapData.empty())
+		{
+			const AtlasPage& page = bucket->atlasPages[metrics.atlasPage];
+			const int pageWidth = page.packer.GetSize().x;
+
+			for (int row = 0; row < metrics.size.y; row++)
+			{
+				std::memcpy(bitmapData.data() + (row * metrics.size.x),
+					page.pixelData.data() + ((metrics.atlasOffset.y + row) * pageWidth) + metrics.atlasOffset.x, metrics.size.x);
+			}
+		}
+
+		return true;
+	}
+
+	void Font::FlushAtlasUpdates() const
+	{
+		for (SizeBucket& bucket : m_sizeBuckets)
+		{
+			for (AtlasPage& page : bucket.atlasPages)
+			{
+				if (page.dirtyMax.x <= page.dirtyMin.x || page.dirtyMax.y <= page.dirtyMin.y)
+					continue;
+
+				// Upload the modified region straight out of the page's pixel data, using the row length to skip over the unmodified columns
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+				glPixelStorei(GL_UNPACK_ROW_LENGTH, (int)page.texture->GetWidth());
+
+				const glm::ivec2 regionSize = page.dirtyMax - page.dirtyMin;
+				page.texture->Update(page.dirtyMin.x, page.dirtyMin.y, regionSize.x, regionSize.y, GL_RED, GL_UNSIGNED_BYTE,
+					page.pixelData.data() + (page.dirtyMin.y * page.texture->GetWidth()) + page.dirtyMin.x);
+
+				glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+				page.dirtyMin = page.dirtyMax = { 0, 0 };
+			}
+		}
+	}
+
+	void Font::SetMaxAtlasPages(uint32_t maxPages) { m_maxAtlasPages = std::clamp(maxPages, 1u, 256u); }
+
+	void Font::SetAtlasMemoryBudget(size_t budget) { m_atlasMemoryBudget = budget; }
+
+	const Font::GlyphMetrics& Font::GetGlyph(uint32_t codepoint, uint32_t pixelSize) const
+	{
+		// Codepoints outside of the unicode range are displayed as the replacement character
+		if (codepoint > GlyphTable::maxCodepoint)
+			codepoint = 0xFFFD;
+
+		SizeBucket& bucket = this->GetSizeBucket(pixelSize);
+
+		const GlyphMetrics* metrics = bucket.glyphTable.Find(codepoint);
+		if (!metrics)
+			return this->RasterizeGlyph(bucket, codepoint);
+
+		// Mark the size bucket and the glyph as recently used so that they aren't evicted
+		bucket.lastUsed = ++m_useCounter;
+		bucket.glyphTable.Touch(codepoint, m_useCounter);
+
+		return *metrics;
+	}
+
+	int Font::GetKerning(uint32_t leftCodepoint, uint32_t rightCodepoint, uint32_t pixelSize) const
+	{
+		if (!this->HasKerning())
+			return 0;
+
+		SizeBucket& bucket = this->GetSizeBucket(pixelSize);
+
+		int adjustment = 0;
+		if (bucket.kerningTable.Find(leftCodepoint, rightCodepoint, adjustment))
+			return adjustment;
+
+		// Look up the pair from the font face, pairs without any kerning are cached as well so that the lookup isn't repeated
+		const FT_Face fontFace = this->GetFontFace();
+		const FT_UInt leftIndex = FT_Get_Char_Index(fontFace, leftCodepoint), rightIndex = FT_Get_Char_Index(fontFace, rightCodepoint);
+
+		FT_Vector kerning = { 0, 0 };
+		if (leftIndex != 0 && rightIndex != 0 && this->ActivateSizeBucket(bucket))
+			FT_Get_Kerning(fontFace, leftIndex, rightIndex, FT_KERNING_DEFAULT, &kerning);
+
+		adjustment = (int)(kerning.x >> 6);
+		bucket.kerningTable.Insert(leftCodepoint, rightCodepoint, adjustment);
+		return adjustment;
+	}
+
+	int Font::GetLineHeight(uint32_t pixelSize) const
+	{
+		SizeBucket& bucket = this->GetSizeBucket(pixelSize);
+		if (!bucket.hasLineMetrics)
+			this->ActivateSizeBucket(bucket);
+
+		return bucket.lineHeight;
+	}
+
+	int Font::GetAscender(uint32_t pixelSize) const
+	{
+		SizeBucket& bucket = this->GetSizeBucket(pixelSize);
+		if (!bucket.hasLineMetrics)
+			this->ActivateSizeBucket(bucket);
+
+		return bucket.ascender;
+	}
+
+	std::vector<uint32_t> Font::GetGlyphCodepoints(uint32_t pixelSize) const
+	{
+		std::vector<uint32_t> codepoints;
+
+		const SizeBucket* bucket = this->FindSizeBucket(pixelSize);
+		if (!bucket)
+			return codepoints;
+
+		for (uint32_t codepoint = 0; codepoint < GlyphTable::pageSize; codepoint++)
+		{
+			if (bucket->glyphTable.latinGlyphs[codepoint].isLoaded)
+				codepoints.emplace_back(codepoint);
+		}
+
+		for (uint32_t pageIndex = 1; pageIndex < (uint32_t)bucket->glyphTable.glyphPages.size(); pageIndex++)
+		{
+			const std::vector<GlyphMetrics>& page = bucket->glyphTable.glyphPages[pageIndex];
+			for (uint32_t i = 0; i < (uint32_t)page.size(); i++)
+			{
+				if (page[i].isLoaded)
+					codepoints.emplace_back((pageIndex * GlyphTable::pageSize) + i);
+			}
+		}
+
+		return codepoints;
+	}
+
+	glm::ivec2 Font::GetAtlasPageSize(uint32_t page, uint32_t pixelSize) const
+	{
+		const SizeBucket* bucket = this->FindSizeBucket(pixelSize);
+		return bucket && page < bucket->atlasPages.size() ? bucket->atlasPages[page].packer.GetSize() : glm::ivec2(0);
+	}
+
+	uint32_t Font::GetNearestPixelSize(float fontSize) const
+	{
+		// Distance field glyphs scale to any size, so only the default size is used
+		if (m_renderMode == FontRenderMode::SIGNED_DISTANCE_FIELD)
+			return m_defaultPixelSize;
+
+		// Pick the closest size bucket, preferring the larger size when two sizes are equally close since downscaling looks better
+		uint32_t nearestPixelSize = m_defaultPixelSize;
+		float nearestDistance = std::fabs(fontSize - (float)m_defaultPixelSize);
+
+		for (const uint32_t pixelSize : ResourceConstants::fontSizeBuckets)
+		{
+			const float distance = std::fabs(fontSize - (float)pixelSize);
+			if (distance < nearestDistance || (distance == nearestDistance && pixelSize > nearestPixelSize))
+			{
+				nearestPixelSize = pixelSize;
+				nearestDistance = distance;
+			}
+		}
+
+		return nearestPixelSize;
+	}
+
+	uint32_t Font::GetDefaultPixelSize() const { return m_defaultPixelSize; }
+
+	FontRenderMode Font::GetRenderMode() const { return m_renderMode; }
+
+	int Font::GetGlyphPadding() const { return m_glyphPadding; }
+
+	uint32_t Font::GetAtlasPageCount(uint32_t pixelSize) const
+	{
+		const SizeBucket* bucket = this->FindSizeBucket(pixelSize);
+		return bucket ? (uint32_t)bucket->atlasPages.size() : 0;
+	}
+
+	size_t Font::GetAtlasMemoryUsage() const
+	{
+		// Each atlas page stores a single byte per pixel
+		size_t memoryUsage = 0;
+		for (const SizeBucket& bucket : m_sizeBuckets)
+		{
+			for (const AtlasPage& page : bucket.atlasPages)
+				memoryUsage += (size_t)page.texture->GetWidth() * page.texture->GetHeight();
+		}
+
+		return memoryUsage;
+	}
+
+	uint32_t Font::GetAtlasGeneration() const { return m_atlasGeneration; }
+
+	TextureBuffer2D* Font::GetTextureAtlas(uint32_t page, uint32_t pixelSize)
+	{
+		const SizeBucket* bucket = this->FindSizeBucket(pixelSize);
+		return bucket && page < bucket->atlasPages.size() ? bucket->atlasPages[page].texture : nullptr;
+	}
+
+	const TextureBuffer2D* Font::GetTextureAtlas(uint32_t page, uint32_t pixelSize) const
+	{
+		const SizeBucket* bucket = this->FindSizeBucket(pixelSize);
+		return bucket && page < bucket->atlasPages.size() ? bucket->atlasPages[page].texture : nullptr;
+	}
+
+	Font::GlyphMetrics* Font::GlyphTable::Find(uint32_t codepoint)
+	{
+		return const_cast<GlyphMetrics*>(static_cast<const GlyphTable*>(this)->Find(codepoint));
+	}
+
+	const Font::GlyphMetrics* Font::GlyphTable::Find(uint32_t codepoint) const
+	{
+		if (codepoint < pageSize)
+			return latinGlyphs[codepoint].isLoaded ? &latinGlyphs[codepoint] : nullptr;
+
+		const uint32_t pageIndex = codepoint / pageSize;
+		if (pageIndex >= glyphPages.size() || glyphPages[pageIndex].empty())
+			return nullptr;
+
+		const GlyphMetrics& metrics = glyphPages[pageIndex][codepoint % pageSize];
+		return metrics.isLoaded ? &metrics : nullptr;
+	}
+
+	Font::GlyphMetrics& Font::GlyphTable::Insert(uint32_t codepoint)
+	{
+		GlyphMetrics* metrics = nullptr;
+		if (codepoint < pageSize)
+		{
+			metrics = &latinGlyphs[codepoint];
+		}
+		else
+		{
+			// Allocate the glyph page on first use, the page table only grows as far as the highest page used
+			const uint32_t pageIndex = codepoint / pageSize;
+			if (pageIndex >= glyphPages.size())
+			{
+				glyphPages.resize(pageIndex + 1);
+				lastUsedPages.resize(pageIndex + 1);
+			}
+
+			if (glyphPages[pageIndex].empty())
+			{
+				glyphPages[pageIndex].resize(pageSize);
+				lastUsedPages[pageIndex].resize(pageSize, 0);
+			}
+
+			metrics = &glyphPages[pageIndex][codepoint % pageSize];
+		}
+
+		*metrics = GlyphMetrics();
+		metrics->isLoaded = true;
+		return *metrics;
+	}
+
+	void Font::GlyphTable::Erase(uint32_t codepoint)
+	{
+		GlyphMetrics* metrics = this->Find(codepoint);
+		if (metrics)
+			*metrics = GlyphMetrics();
+	}
+
+	void Font::GlyphTable::Touch(uint32_t codepoint, uint64_t useCounter)
+	{
+		if (codepoint < pageSize)
+			latinLastUsed[codepoint] = useCounter;
+		else
+			lastUsedPages[codepoint / pageSize][codepoint % pageSize] = useCounter;
+	}
+
+	uint64_t Font::GlyphTable::GetLastUsed(uint32_t codepoint) const
+	{
+		return codepoint < pageSize ? latinLastUsed[codepoint] : lastUsedPages[codepoint / pageSize][codepoint % pageSize];
+	}
+
+	void Font::GlyphTable::Clear()
+	{
+		latinGlyphs.fill(GlyphMetrics());
+		glyphPages.clear();
+		latinLastUsed.fill(0);
+		lastUsedPages.clear();
+	}
+
+	bool Font::KerningTable::Find(uint32_t leftCodepoint, uint32_t rightCodepoint, int& adjustment) const
+	{
+		if (entries.empty())
+			return false;
+
+		const uint64_t pairKey = GetPairKey(leftCodepoint, rightCodepoint);
+		const size_t mask = entries.size() - 1;
+
+		// Probe until either the pair or an empty entry is found, the table is never full so this always terminates
+		for (size_t slot = this->GetSlot(pairKey); entries[slot] != 0; slot = (slot + 1) & mask)
+		{
+			if ((entries[slot] >> 16) == pairKey)
+			{
+				adjustment = (int16_t)(entries[slot] & 0xFFFF);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void Font::KerningTable::Insert(uint32_t leftCodepoint, uint32_t rightCodepoint, int adjustment)
+	{
+		// Double the capacity once the table is half full, re-inserting the existing entries
+		if ((count + 1) * 2 > entries.size())
+		{
+			std::vector<uint64_t> oldEntries(std::max(entries.size() * 2, (size_t)initialCapacity), 0);
+			entries.swap(oldEntries);
+			count = 0;
+
+			for (const uint64_t entry : oldEntries)
+			{
+				if (entry != 0)
+				{
+					const uint64_t pairKey = entry >> 16;
+					size_t slot = this->GetSlot(pairKey);
+					while (entries[slot] != 0)
+						slot = (slot + 1) & (entries.size() - 1);
+
+					entries[slot] = entry;
+					count++;
+				}
+			}
+		}
 
-	Font::~Font() { delete m_textureAtlas; }
+		const uint64_t pairKey = GetPairKey(leftCodepoint, rightCodepoint);
+		size_t slot = this->GetSlot(pairKey);
+		while (entries[slot] != 0 && (entries[slot] >> 16) != pairKey)
+			slot = (slot + 1) & (entries.size() - 1);
 
-	const Font::GlyphMetrics& Font::GetGlyph(char asciiCode) const { return m_glyphMetricsSet.find(asciiCode)->second; }
+		if (entries[slot] == 0)
+			count++;
 
-	const std::unordered_map<char, Font::GlyphMetrics>& Font::GetGlyphSet() const { return m_glyphMetricsSet; }
+		entries[slot] = (pairKey << 16) | (uint16_t)(int16_t)adjustment;
+	}
 
-	TextureBuffer2D* Font::GetTextureAtlas() { return m_textureAtlas; }
+	uint64_t Font::KerningTable::GetPairKey(uint32_t leftCodepoint, uint32_t rightCodepoint)
+	{
+		// Unicode codepoints fit into 21 bits, so the pair fits into 42 bits (plus one for the offset)
+		return ((((uint64_t)leftCodepoint & 0x1FFFFF) << 21) | ((uint64_t)rightCodepoint & 0x1FFFFF)) + 1;
+	}
 
-	const TextureBuffer2D* Font::GetTextureAtlas() const { return m_textureAtlas; }
+	size_t Font::KerningTable::GetSlot(uint64_t pairKey) const
+	{
+		// Fibonacci hashing, the capacity is always a power of two
+		return (size_t)((pairKey * 0x9E3779B97F4A7C15ull) >> 32) & (entries.size() - 1);
+	}
 }
\ No newline at end of file
@@ -1,72 +1,499 @@
 #ifndef FREETYPE_FONT_H
 #define FREETYPE_FONT_H
 
-#include <utilities/libexport.h>
-#include <external/glm/glm/glm.hpp>
-#include <unordered_map>
+#include <graphics/atlas_packer.h>
+#include <external/glm/glm/gtc/type_precision.hpp>
+#include <array>
+#include <deque>
+#include <vector>
+
+typedef struct FT_LibraryRec_* FT_Library;
+typedef struct FT_FaceRec_* FT_Face;
+typedef struct FT_SizeRec_* FT_Size;
 
 namespace GUILib
 {
 	class TextureBuffer2D;
 
+	/**
+	* @brief An enumeration specifying how the glyphs of a font are rasterized.
+	* BITMAP glyphs are anti-aliased coverage bitmaps, which look best when rendered close to the size they were rasterized at.
+	* SIGNED_DISTANCE_FIELD glyphs store the distance to the glyph outline instead, so that text stays sharp when rendered at any size.
+	*/
+	enum class FontRenderMode { BITMAP, SIGNED_DISTANCE_FIELD };
+
 	/**
 	* @brief This class stores the font data necessary in order to render text using it.
-	* Also, make sure that whenever you are using this class you are always allocating it on the heap, not the stack.
+	* Bitmap fonts are rasterized at several pixel sizes (size buckets), so that text can be rendered using hinted glyphs rasterized close to
+	* the size the text is displayed at. The size buckets are created on first use and all share the same font face. Signed distance field
+	* fonts only use a single size bucket, since they can be scaled to any size.
+	*
+	* The glyph metrics of each size bucket are stored in a flat lookup table indexed directly by codepoint, made up of a dense block for the
+	* ASCII/Latin-1 range and 256 glyph pages for the rest of unicode, which are allocated as glyphs within them are rasterized.
+	*
+	* Glyphs are rasterized on first use into the texture atlas of their size bucket, which is made up of one or more pages. Each page starts
+	* off small and doubles in size (alternating between width and height, so it stays near-square and power-of-two sized) as it fills up,
+	* then once the largest page size is reached another page is added. When the page limit is reached, the least recently used glyphs are
+	* evicted to make room for new glyphs and the remaining glyphs are packed together again, so the glyphs in use stay in the atlas. Also,
+	* when the atlases of all size buckets exceed the atlas memory budget, the least recently used size buckets are evicted.
+	*
+	* The font face is only loaded from the font file's memory once it's first needed, such as for rasterizing a glyph which wasn't added
+	* from the disk cache, so fonts whose glyphs are all in the cache don't load a font face at all.
+	*
+	* Make sure that whenever you are using this class you are always allocating it on the heap, not the stack.
 	*/
 	class LIB_DECLSPEC Font
 	{
 	public:
 		/**
-		* @brief A struct used for containing the metric data for a glyph.
+		* @brief A struct used for containing the metric data for a glyph, packed into 16 bytes so that a full page of glyphs stays compact.
 		*/
 		struct GlyphMetrics
 		{
-			glm::ivec2 size; // The size of the glyph
-			glm::ivec2 bearing; // The bearing of the glyph
-			glm::ivec2 advance; // The amount to increment the cursor position after rendering the glyph (must be measured in pixels).
+			glm::i16vec2 size = glm::i16vec2(0); // The size of the glyph
+			glm::i16vec2 bearing = glm::i16vec2(0); // The bearing of the glyph
+			int16_t advance = 0; // The amount to increment the cursor's x position after rendering the glyph (must be measured in pixels).
 
-			uint32_t atlasOffsetX; // The horizontal offset of the glyph bitmap in the font texture atlas
+			glm::u16vec2 atlasOffset = glm::u16vec2(0); // The position of the top-left corner of the glyph bitmap in its texture atlas page
+			uint8_t atlasPage = 0; // The index of the texture atlas page containing the glyph bitmap
+			bool isLoaded = false; // Whether or not the glyph has been rasterized, used to tell empty lookup table entries apart
+		};
+
+		/**
+		* @brief A struct containing the metrics of the font face at the default pixel size, which are stored in the disk cache along with the
+		* glyphs so that they're known without loading the font face.
+		*/
+		struct FaceMetrics
+		{
+			int lineHeight = 0; // The distance between the baselines of two consecutive lines of text (in pixels)
+			int ascender = 0; // The distance from the baseline to the top of the tallest glyphs (in pixels)
+			bool hasKerning = false; // Whether or not the font face contains kerning adjustments
 		};
 
 		/**
-		* @brief This is a class constructor that stores the given texture atlas and glyph metrics set for the font.
-		* @param[in] textureAtlas - The texture atlas of the font, should contain all glyph bitmaps.
-		* Note that this class will take ownership of the texture buffer pointer, therefore it will be automatically deleted it upon
-		* destruction of the Font object.
-		* 
-		* @param[in] glyphMetricsSet - A set of metrics data for each glyph included in the font.
+		* @brief This is a class constructor that takes ownership of the font file data given, which the font face used to rasterize glyphs
+		* on demand is loaded from once it's first needed.
+		*
+		* @param[in] freetypeLib - The FreeType library which the font face is loaded with, it must outlive the Font object.
+		* @param[in] fontFileData - The contents of the font file (FreeType reads from this memory for as long as the face is alive).
+		* @param[in] renderMode - Specifies how the glyphs of the font are rasterized.
 		*/
-		Font(TextureBuffer2D* textureAtlas, const std::unordered_map<char, GlyphMetrics>& glyphMetricsSet);
+		Font(FT_Library freetypeLib, std::vector<uint8_t>&& fontFileData, FontRenderMode renderMode = FontRenderMode::BITMAP);
 
 		~Font();
 
 		/**
-		* @brief Returns the metrics data for the specified glyph.
-		* @param[in] asciiCode - The ascii code for the glyph to be looked up.
+		* @brief Adds the glyph given to the font, writing its bitmap into the texture atlas.
+		* This is used for inserting glyphs which have been rasterized beforehand (e.g. loaded from the disk cache), any existing glyph with the
+		* same codepoint is left untouched.
+		*
+		* @param[in] codepoint - The unicode codepoint of the glyph.
+		* @param[in] metrics - The metrics of the glyph, the atlas position members are ignored.
+		* @param[in] bitmapData - The single channel bitmap of the glyph, tightly packed with dimensions matching the glyph's size.
+		* @param[in] pixelSize - The pixel size the glyph was rasterized at, 0 specifies the font's default pixel size.
+		*/
+		void AddGlyph(uint32_t codepoint, const GlyphMetrics& metrics, const uint8_t* bitmapData, uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Copies the bitmap of the specified glyph out of the texture atlas.
+		*
+		* @param[in] codepoint - The unicode codepoint of the glyph.
+		* @param[out] bitmapData - The vector which the tightly packed single channel bitmap will be written to.
+		* @param[in] pixelSize - The pixel size of the glyph, 0 specifies the font's default pixel size.
+		* @return TRUE if the glyph is currently in the atlas, FALSE otherwise.
+		*/
+		bool GetGlyphBitmap(uint32_t codepoint, std::vector<uint8_t>& bitmapData, uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Sets the metrics of the font face at the default pixel size, which have been retrieved beforehand (e.g. loaded from the disk
+		* cache), so that looking them up doesn't load the font face.
+		*
+		* @param[in] metrics - The metrics of the font face.
+		*/
+		void SetFaceMetrics(const FaceMetrics& metrics) const;
+
+		/**
+		* @brief Returns the metrics of the font face at the default pixel size, the font face is loaded if they aren't known yet.
+		* @return The metrics of the font face.
+		*/
+		FaceMetrics GetFaceMetrics() const;
+
+		/**
+		* @brief Uploads every region of the texture atlases modified since the last upload, each atlas page is updated with a single call.
+		* This is called automatically before text is rendered, so the newly rasterized glyphs of a frame are uploaded all at once.
+		*/
+		void FlushAtlasUpdates() const;
+
+		/**
+		* @brief Sets the maximum number of texture atlas pages each size bucket may allocate before glyphs get evicted.
+		* @param[in] maxPages - The maximum number of atlas pages (between 1 and 256 pages are allowed).
+		*/
+		void SetMaxAtlasPages(uint32_t maxPages);
+
+		/**
+		* @brief Sets the amount of video memory the texture atlases of all size buckets may take up, before the least recently used size
+		* buckets get evicted. The size bucket currently being rasterized into is never evicted, even if it exceeds the budget by itself.
+		*
+		* @param[in] budget - The atlas memory budget (in bytes).
+		*/
+		void SetAtlasMemoryBudget(size_t budget);
+
+		/**
+		* @brief Returns the metrics data for the specified glyph, the glyph is rasterized into the texture atlas if it isn't already.
+		* If the font doesn't contain the glyph, then the font's missing glyph is used instead.
+		*
+		* @param[in] codepoint - The unicode codepoint for the glyph to be looked up.
+		* @param[in] pixelSize - The pixel size of the glyph, 0 specifies the font's default pixel size.
 		* @return The metrics data for the specified glyph.
 		*/
-		const GlyphMetrics& GetGlyph(char asciiCode) const;
-		
+		const GlyphMetrics& GetGlyph(uint32_t codepoint, uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Returns the kerning adjustment to apply to the cursor's x position between the two glyphs given.
+		* The adjustment of each pair is looked up from the font face once, then cached in a per size bucket kerning table.
+		*
+		* @param[in] leftCodepoint - The unicode codepoint of the glyph on the left of the pair.
+		* @param[in] rightCodepoint - The unicode codepoint of the glyph on the right of the pair.
+		* @param[in] pixelSize - The pixel size of the glyphs, 0 specifies the font's default pixel size.
+		* @return The kerning adjustment (in pixels), this is usually negative or zero.
+		*/
+		int GetKerning(uint32_t leftCodepoint, uint32_t rightCodepoint, uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Returns the codepoints of every glyph currently rasterized in the font at the pixel size given.
+		* @param[in] pixelSize - The pixel size of the glyphs, 0 specifies the font's default pixel size.
+		* @return The codepoints of every rasterized glyph in the font, in ascending order.
+		*/
+		std::vector<uint32_t> GetGlyphCodepoints(uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Returns the size of the specified texture atlas page.
+		*
+		* @param[in] page - The index of the atlas page.
+		* @param[in] pixelSize - The pixel size of the size bucket, 0 specifies the font's default pixel size.
+		* @return The size of the atlas page (in pixels), or zero if the page doesn't exist.
+		*/
+		glm::ivec2 GetAtlasPageSize(uint32_t page = 0, uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Returns the distance between the baselines of two consecutive lines of text, as specified by the font.
+		* @param[in] pixelSize - The pixel size of the glyphs, 0 specifies the font's default pixel size.
+		* @return The line height (in pixels).
+		*/
+		int GetLineHeight(uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Returns the distance from the baseline to the top of the tallest glyphs, as specified by the font.
+		* @param[in] pixelSize - The pixel size of the glyphs, 0 specifies the font's default pixel size.
+		* @return The ascender (in pixels).
+		*/
+		int GetAscender(uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Returns the pixel size of the size bucket best suited for rendering text at the font size given.
+		* For signed distance field fonts this is always the default pixel size.
+		*
+		* @param[in] fontSize - The size of the text (in pixels).
+		* @return The pixel size of the nearest size bucket.
+		*/
+		uint32_t GetNearestPixelSize(float fontSize) const;
+
+		/**
+		* @brief Returns the pixel size that glyphs are rasterized at when no pixel size is specified.
+		* @return The default pixel size of the font.
+		*/
+		uint32_t GetDefaultPixelSize() const;
+
+		/**
+		* @brief Returns how the glyphs of the font are rasterized.
+		* @return The font's render mode.
+		*/
+		FontRenderMode GetRenderMode() const;
+
+		/**
+		* @brief Returns the amount of padding surrounding the outline of each glyph bitmap, this is included in the size and bearing of the
+		* glyph metrics. The padding is only non-zero for signed distance field fonts, where it holds the distance field falloff.
+		*
+		* @return The glyph padding (in pixels).
+		*/
+		int GetGlyphPadding() const;
+
+		/**
+		* @brief Returns the number of pages the texture atlas of the specified size bucket currently consists of.
+		* @param[in] pixelSize - The pixel size of the size bucket, 0 specifies the font's default pixel size.
+		* @return The number of texture atlas pages.
+		*/
+		uint32_t GetAtlasPageCount(uint32_t pixelSize = 0) const;
+
+		/**
+		* @brief Returns the amount of video memory taken up by the texture atlases of every size bucket.
+		* @return The atlas memory usage (in bytes).
+		*/
+		size_t GetAtlasMemoryUsage() const;
+
+		/**
+		* @brief Returns a counter which is incremented every time glyphs are evicted from the texture atlas, or an atlas page is resized.
+		* Geometry built from previously looked up glyph metrics must be rebuilt whenever this value changes.
+		*
+		* @return The atlas generation counter.
+		*/
+		uint32_t GetAtlasGeneration() const;
+
+		/**
+		* @brief Returns the texture buffer containing the glyph bitmaps of the specified atlas page.
+		* @param[in] page - The index of the atlas page.
+		* @param[in] pixelSize - The pixel size of the size bucket, 0 specifies the font's default pixel size.
+		* @return The font's texture atlas page, or nullptr if the page doesn't exist.
+		*/
+		TextureBuffer2D* GetTextureAtlas(uint32_t page = 0, uint32_t pixelSize = 0);
+
+		/**
+		* @brief Returns the texture buffer containing the glyph bitmaps of the specified atlas page.
+		* @param[in] page - The index of the atlas page.
+		* @param[in] pixelSize - The pixel size of the size bucket, 0 specifies the font's default pixel size.
+		* @return The font's texture atlas page, or nullptr if the page doesn't exist.
+		*/
+		const TextureBuffer2D* GetTextureAtlas(uint32_t page = 0, uint32_t pixelSize = 0) const;
+	private:
+		/**
+		* @brief A struct containing a page of the texture atlas along with a copy of its pixel data, which new glyphs are written into before
+		* being uploaded.
+		*/
+		struct AtlasPage
+		{
+			TextureBuffer2D* texture = nullptr;
+			std::vector<uint8_t> pixelData;
+			std::vector<uint32_t> glyphs; // The codepoints of the glyphs stored in the page
+			AtlasPacker packer = AtlasPacker(glm::ivec2(0), 0);
+
+			glm::ivec2 dirtyMin = glm::ivec2(0), dirtyMax = glm::ivec2(0); // The region modified since the last upload
+		};
+
+		/**
+		* @brief A struct containing a lookup table of glyph metrics indexed directly by codepoint.
+		* Codepoints below 256 are stored in a dense block, the rest are stored in pages of 256 glyphs (selected by the upper bits of the
+		* codepoint) which are only allocated once a glyph within the page is inserted. When each glyph was last used is stored in a parallel
+		* table laid out the same way, so that the glyph metrics themselves stay packed.
+		*/
+		struct GlyphTable
+		{
+			static constexpr uint32_t pageSize = 256;
+			static constexpr uint32_t maxCodepoint = 0x10FFFF;
+
+			std::array<GlyphMetrics, pageSize> latinGlyphs;
+			std::vector<std::vector<GlyphMetrics>> glyphPages;
+
+			std::array<uint64_t, pageSize> latinLastUsed = {};
+			std::vector<std::vector<uint64_t>> lastUsedPages;
+
+			/**
+			* @brief Returns the metrics of the glyph given, or nullptr if the glyph isn't in the table.
+			*/
+			GlyphMetrics* Find(uint32_t codepoint);
+
+			/**
+			* @brief Returns the metrics of the glyph given, or nullptr if the glyph isn't in the table.
+			*/
+			const GlyphMetrics* Find(uint32_t codepoint) const;
+
+			/**
+			* @brief Returns the table entry for the glyph given (allocating its page if required), the entry is marked as loaded.
+			*/
+			GlyphMetrics& Insert(uint32_t codepoint);
+
+			/**
+			* @brief Removes the glyph given from the table.
+			*/
+			void Erase(uint32_t codepoint);
+
+			/**
+			* @brief Marks the glyph given, which must be in the table, as used at the point given by the use counter.
+			*/
+			void Touch(uint32_t codepoint, uint64_t useCounter);
+
+			/**
+			* @brief Returns the value of the use counter when the glyph given, which must be in the table, was last used.
+			*/
+			uint64_t GetLastUsed(uint32_t codepoint) const;
+
+			/**
+			* @brief Removes every glyph from the table, freeing the glyph pages.
+			*/
+			void Clear();
+		};
+
+		/**
+		* @brief A struct containing an open addressing (linear probing) hash table of kerning adjustments keyed by glyph pair.
+		* Each entry is packed into a single 64-bit integer, holding the pair key in the upper bits and the adjustment in the lower 16 bits. An
+		* entry of zero is empty, which is why pair keys are offset by one.
+		*/
+		struct KerningTable
+		{
+			static constexpr uint32_t initialCapacity = 256;
+
+			std::vector<uint64_t> entries;
+			uint32_t count = 0;
+
+			/**
+			* @brief Looks up the kerning adjustment of the pair given.
+			* @return TRUE if the pair is in the table, FALSE otherwise.
+			*/
+			bool Find(uint32_t leftCodepoint, uint32_t rightCodepoint, int& adjustment) const;
+
+			/**
+			* @brief Inserts the kerning adjustment of the pair given, the table is doubled in size once it becomes half full.
+			*/
+			void Insert(uint32_t leftCodepoint, uint32_t rightCodepoint, int adjustment);
+
+			/**
+			* @brief Returns the key of the pair given, which is never zero.
+			*/
+			static uint64_t GetPairKey(uint32_t leftCodepoint, uint32_t rightCodepoint);
+
+			/**
+			* @brief Returns the index of the slot where probing starts for the pair key given.
+			*/
+			size_t GetSlot(uint64_t pairKey) const;
+		};
+
+		/**
+		* @brief A struct containing the glyphs rasterized at a specific pixel size, along with the texture atlas storing them.
+		*/
+		struct SizeBucket
+		{
+			FT_Size size = nullptr; // The size object is only created once the font face is used at the bucket's pixel size
+			uint32_t pixelSize = 0;
+			int lineHeight = 0, ascender = 0;
+			bool hasLineMetrics = false;
+
+			GlyphTable glyphTable;
+			KerningTable kerningTable;
+			std::vector<AtlasPage> atlasPages;
+			uint64_t lastUsed = 0;
+		};
+
+		/**
+		* @brief Returns the size bucket for the pixel size given, creating the size bucket if it doesn't exist yet.
+		* @param[in] pixelSize - The pixel size of the size bucket, 0 specifies the font's default pixel size.
+		* @return The size bucket for the pixel size.
+		*/
+		SizeBucket& GetSizeBucket(uint32_t pixelSize) const;
+
+		/**
+		* @brief Returns the size bucket for the pixel size given.
+		* @param[in] pixelSize - The pixel size of the size bucket, 0 specifies the font's default pixel size.
+		* @return The size bucket for the pixel size, or nullptr if it doesn't exist.
+		*/
+		const SizeBucket* FindSizeBucket(uint32_t pixelSize) const;
+
 		/**
-		* @brief Returns set of metrics data for every glyph included in the font.
-		* @return A set of metrics data for every available glyph in the font.
+		* @brief Returns the font face, loading it from the font file data if it hasn't been loaded yet.
+		* If the font face fails to load, an exception will be thrown with an error log message.
+		*
+		* @return The font face.
 		*/
-		const std::unordered_map<char, GlyphMetrics>& GetGlyphSet() const;
+		FT_Face GetFontFace() const;
 
 		/**
-		* @brief Returns the texture buffer containing the bitmaps of every glyph in the font.
-		* @return The font's texture atlas.
+		* @brief Sets the pixel size of the font face to the pixel size of the size bucket given, creating the size bucket's size object (and
+		* loading the font face) if it hasn't been created yet. The bucket's line metrics are set once its size object is created.
+		*
+		* @param[in] bucket - The size bucket to be activated.
+		* @return TRUE if the pixel size was set, FALSE otherwise.
 		*/
-		TextureBuffer2D* GetTextureAtlas();
+		bool ActivateSizeBucket(SizeBucket& bucket) const;
 
 		/**
-		* @brief Returns the texture buffer containing the bitmaps of every glyph in the font.
-		* @return The font's texture atlas.
+		* @brief Returns whether or not the font face contains kerning adjustments, the font face is loaded if this isn't known yet.
+		* @return TRUE if the font has kerning, FALSE otherwise.
 		*/
-		const TextureBuffer2D* GetTextureAtlas() const;
+		bool HasKerning() const;
+
+		/**
+		* @brief Rasterizes the specified glyph using the font face and adds it to the size bucket given.
+		*
+		* @param[in] bucket - The size bucket to rasterize the glyph into.
+		* @param[in] codepoint - The unicode codepoint of the glyph.
+		* @return The metrics data for the glyph.
+		*/
+		const GlyphMetrics& RasterizeGlyph(SizeBucket& bucket, uint32_t codepoint) const;
+
+		/**
+		* @brief Adds the glyph given to the size bucket given, writing its bitmap into the bucket's texture atlas.
+		*
+		* @param[in] bucket - The size bucket to add the glyph to.
+		* @param[in] codepoint - The unicode codepoint of the glyph.
+		* @param[in] metrics - The metrics of the glyph, the atlas position members are ignored.
+		* @param[in] bitmapData - The single channel bitmap of the glyph, tightly packed with dimensions matching the glyph's size.
+		*/
+		void AddGlyph(SizeBucket& bucket, uint32_t codepoint, const GlyphMetrics& metrics, const uint8_t* bitmapData) const;
+
+		/**
+		* @brief Finds space in the texture atlas of the size bucket given for a glyph bitmap of the size given, allocating a new page or
+		* evicting the least recently used glyphs if required.
+		*
+		* @param[in] bucket - The size bucket to allocate space in.
+		* @param[in] size - The size of the glyph bitmap.
+		* @param[out] page - The index of the page where space was found.
+		* @param[out] offset - The position of the space found within the page.
+		* @return TRUE if space was found, FALSE if the bitmap is too large to fit in an atlas page.
+		*/
+		bool AllocateAtlasRegion(SizeBucket& bucket, glm::ivec2 size, uint32_t& page, glm::ivec2& offset) const;
+
+		/**
+		* @brief Doubles the size of the specified atlas page along its shorter side, the page's texture is recreated with the existing glyph
+		* bitmaps.
+		*
+		* @param[in] bucket - The size bucket which the page belongs to.
+		* @param[in] page - The index of the page to be grown.
+		* @return TRUE if the page was grown, FALSE if the page is already at the largest page size.
+		*/
+		bool GrowAtlasPage(SizeBucket& bucket, uint32_t page) const;
+
+		/**
+		* @brief Creates the texture of the atlas page given from the page's pixel data, replacing any existing texture.
+		* @param[in] page - The atlas page.
+		*/
+		void CreateAtlasPageTexture(AtlasPage& page) const;
+
+		/**
+		* @brief Evicts the least recently used fraction of the glyphs stored in the texture atlas of the size bucket given, then compacts the
+		* atlas pages which glyphs were evicted from.
+		*
+		* @param[in] bucket - The size bucket to evict glyphs from.
+		* @return TRUE if glyphs were evicted, FALSE if the atlas doesn't store any glyphs.
+		*/
+		bool EvictColdGlyphs(SizeBucket& bucket) const;
+
+		/**
+		* @brief Packs the glyphs remaining in the specified atlas page together again, after glyphs have been evicted from it. The atlas
+		* packer can't reuse the space of individual glyphs, so this is how the space of the evicted glyphs is reclaimed.
+		*
+		* @param[in] bucket - The size bucket which the page belongs to.
+		* @param[in] page - The index of the page to be compacted.
+		*/
+		void CompactAtlasPage(SizeBucket& bucket, uint32_t page) const;
+
+		/**
+		* @brief Evicts the least recently used size buckets until the atlas memory usage is within the atlas memory budget.
+		* @param[in] activeBucket - The size bucket currently being rasterized into, which won't be evicted.
+		*/
+		void EnforceAtlasMemoryBudget(const SizeBucket& activeBucket) const;
 	private:
-		TextureBuffer2D* m_textureAtlas;
-		std::unordered_map<char, GlyphMetrics> m_glyphMetricsSet;
+		FT_Library m_freetypeLib;
+		mutable FT_Face m_fontFace;
+		std::vector<uint8_t> m_fontFileData;
+		FontRenderMode m_renderMode;
+		int m_glyphPadding;
+		mutable bool m_hasKerning, m_isKerningKnown;
+		uint32_t m_defaultPixelSize, m_maxAtlasPages, m_maxAtlasPageSize;
+		size_t m_atlasMemoryBudget;
+
+		// The size buckets, glyphs and atlas data are populated lazily as glyphs are looked up. The size buckets are stored in a deque,
+		// as adding a bucket (for any pixel size requested) mustn't move the existing buckets, whose glyph metrics are handed out by reference
+		mutable std::deque<SizeBucket> m_sizeBuckets;
+		mutable uint64_t m_useCounter;
+		mutable uint32_t m_atlasGeneration;
 	};
 }
 
@@ -1,10 +1,52 @@
 #include <graphics/shader_program.h>
+#include <utilities/disk_cache.h>
 #include <external/glad/glad.h>
 #include <memory>
+#include <vector>
+#include <cstring>
 
 namespace GUILib
 {
-	ShaderProgram::ShaderProgram(std::string_view vshSourceCode, std::string_view fshSourceCode, std::string_view gshSourceCode)
+	namespace
+	{
+		/**
+		* @brief Appends a part of the shader cache key data, the part's length is written in front of it so that different splits of the
+		* same characters between the parts (e.g. the sources "ab" and "c", and "a" and "bc") produce different key data.
+		*/
+		void AppendCacheKeyPart(std::string& cacheKeyData, std::string_view part)
+		{
+			const uint32_t partLength = (uint32_t)part.size();
+			cacheKeyData.append((const char*)&partLength, sizeof(uint32_t));
+			cacheKeyData.append(part.data(), part.size());
+		}
+	}
+
+	ShaderProgram::ShaderProgram(std::string_view vshSourceCode, std::string_view fshSourceCode, std::string_view gshSourceCode) :
+		m_id(0)
+	{
+		// Program binaries are only valid for the exact driver they were produced by, so the driver details form part of the cache key
+		std::string cacheKeyData;
+		AppendCacheKeyPart(cacheKeyData, vshSourceCode);
+		AppendCacheKeyPart(cacheKeyData, fshSourceCode);
+		AppendCacheKeyPart(cacheKeyData, gshSourceCode);
+
+		for (const uint32_t driverString : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+		{
+			const char* driverStringValue = (const char*)glGetString(driverString);
+			AppendCacheKeyPart(cacheKeyData, driverStringValue ? driverStringValue : std::string_view());
+		}
+
+		const uint64_t cacheKey = DiskCache::HashBytes(cacheKeyData.data(), cacheKeyData.size());
+
+		// Try to reuse a previously linked program binary, fall back to compiling from source if there isn't one or the driver rejects it
+		if (!this->LoadCachedBinary(cacheKey, cacheKeyData))
+		{
+			this->CompileAndLink(vshSourceCode, fshSourceCode, gshSourceCode);
+			this->StoreCachedBinary(cacheKey, cacheKeyData);
+		}
+	}
+
+	void ShaderProgram::CompileAndLink(std::string_view vshSourceCode, std::string_view fshSourceCode, std::string_view gshSourceCode)
 	{
 		const char* vshSrcCode = vshSourceCode.data();
 		const char* fshSrcCode = fshSourceCode.data();
@@ -42,6 +84,9 @@ namespace GUILib
 		if (gshID > 0) // Attach geometry shader if existing
 			glAttachShader(m_id, gshID);
 
+		if (GLAD_GL_ARB_get_program_binary) // Let the driver know that the linked binary will be retrieved for caching
+			glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 		glLinkProgram(m_id);
 		this->CheckShaderOperationStatus(m_id, ShaderOperation::LINKAGE);
 
@@ -53,6 +98,66 @@ namespace GUILib
 			glDeleteShader(gshID);
 	}
 
+	bool ShaderProgram::LoadCachedBinary(uint64_t cacheKey, std::string_view cacheKeyData)
+	{
+		if (!GLAD_GL_ARB_get_program_binary)
+			return false;
+
+		// The cached entry consists of the key data's length and the key data, the binary format enum, then the program binary itself
+		std::vector<uint8_t> cacheData;
+		const size_t headerSize = sizeof(uint32_t) + cacheKeyData.size() + sizeof(uint32_t);
+		if (!DiskCache::GetInstance().Load("shader", cacheKey, cacheData) || cacheData.size() <= headerSize)
+			return false;
+
+		// The entry must have been stored for exactly the same sources and driver, rather than for others whose key collides
+		uint32_t keyDataLength = 0;
+		std::memcpy(&keyDataLength, cacheData.data(), sizeof(uint32_t));
+		if (keyDataLength != cacheKeyData.size() || std::memcmp(cacheData.data() + sizeof(uint32_t), cacheKeyData.data(), keyDataLength) != 0)
+			return false;
+
+		uint32_t binaryFormat = 0;
+		std::memcpy(&binaryFormat, cacheData.data() + headerSize - sizeof(uint32_t), sizeof(uint32_t));
+
+		m_id = glCreateProgram();
+		glProgramBinary(m_id, binaryFormat, cacheData.data() + headerSize, (int)(cacheData.size() - headerSize));
+
+		// The driver may reject the binary (e.g. after a driver update), in which case the program has to be compiled from source
+		int linkSuccessful = 0;
+		glGetProgramiv(m_id, GL_LINK_STATUS, &linkSuccessful);
+		if (!linkSuccessful)
+		{
+			glDeleteProgram(m_id);
+			m_id = 0;
+			return false;
+		}
+
+		return true;
+	}
+
+	void ShaderProgram::StoreCachedBinary(uint64_t cacheKey, std::string_view cacheKeyData) const
+	{
+		if (!GLAD_GL_ARB_get_program_binary || !DiskCache::GetInstance().IsEnabled())
+			return;
+
+		int binaryLength = 0;
+		glGetProgramiv(m_id, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+		if (binaryLength <= 0)
+			return;
+
+		// Retrieve the linked program binary, leaving room at the front for the key data and the binary format enum
+		const uint32_t keyDataLength = (uint32_t)cacheKeyData.size();
+		const size_t headerSize = sizeof(uint32_t) + keyDataLength + sizeof(uint32_t);
+		std::vector<uint8_t> cacheData(headerSize + binaryLength);
+
+		uint32_t binaryFormat = 0;
+		glGetProgramBinary(m_id, binaryLength, nullptr, &binaryFormat, cacheData.data() + headerSize);
+		std::memcpy(cacheData.data(), &keyDataLength, sizeof(uint32_t));
+		std::memcpy(cacheData.data() + sizeof(uint32_t), cacheKeyData.data(), keyDataLength);
+		std::memcpy(cacheData.data() + headerSize - sizeof(uint32_t), &binaryFormat, sizeof(uint32_t));
+
+		DiskCache::GetInstance().Store("shader", cacheKey, cacheData.data(), cacheData.size());
+	}
+
 	ShaderProgram::~ShaderProgram()
 	{
 		glDeleteProgram(m_id);
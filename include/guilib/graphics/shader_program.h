@@ -18,6 +18,8 @@ namespace GUILib
 		/**
 		* @brief This is a class constructor method for creating and setting up the OpenGL shader program object.
 		* If an error occurs while compiling or linking the shaders, an exception will be thrown with the fetched OpenGL error log message.
+		* If supported by the driver, the linked program binary is stored in the disk cache (see @ref GUILib::DiskCache) and reused on later
+		* launches instead of compiling the shaders again.
 		* 
 		* @param[in] vshCodeContents - A string containing the source code of the vertex shader.
 		* @param[in] fshCodeContents - A string containing the source code of the fragment shader.
@@ -122,6 +124,34 @@ namespace GUILib
 		*/
 		void CheckShaderOperationStatus(const uint32_t& id, ShaderOperation operation) const;
 
+		/**
+		* @brief Compiles the given shader source code and links the compiled shaders into the shader program.
+		* An exception is thrown along with the fetched OpenGL error log message if compilation or linking failed.
+		*
+		* @param[in] vshSourceCode - A string containing the source code of the vertex shader.
+		* @param[in] fshSourceCode - A string containing the source code of the fragment shader.
+		* @param[in] gshSourceCode - A string containing the source code of the geometry shader (this can be empty).
+		*/
+		void CompileAndLink(std::string_view vshSourceCode, std::string_view fshSourceCode, std::string_view gshSourceCode);
+
+		/**
+		* @brief Creates the shader program from the program binary stored in the disk cache under the key given.
+		*
+		* @param[in] cacheKey - The key of the cached program binary, which is the hash of the key data.
+		* @param[in] cacheKeyData - The data which the program binary depends on, this is compared with the data stored in the cached entry
+		* so that an entry whose key collides with the program's key isn't used.
+		* @return TRUE if the shader program was created from the cached binary, FALSE if there is no cached binary (for the key data given)
+		* or the driver rejected it.
+		*/
+		bool LoadCachedBinary(uint64_t cacheKey, std::string_view cacheKeyData);
+
+		/**
+		* @brief Stores the linked program binary in the disk cache under the key given.
+		* @param[in] cacheKey - The key which the program binary will be stored under.
+		* @param[in] cacheKeyData - The data which the program binary depends on, which is stored in front of the binary.
+		*/
+		void StoreCachedBinary(uint64_t cacheKey, std::string_view cacheKeyData) const;
+
 		// Returns the location unit of the specified shader uniform variable.
 		// The locations of fetched shader uniform are stored in the cache (unordered map) for faster future fetching.
 
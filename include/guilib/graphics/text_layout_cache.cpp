@@ -0,0 +1,197 @@
+#include <graphics/text_layout_cache.h>
+#include <utilities/resource_loader.h>
+#include <utilities/utf8.h>
+
+#include <functional>
+#include <algorithm>
+
+namespace GUILib
+{
+	TextLayoutCache::TextLayoutCache() :
+		m_capacity(ResourceConstants::textLayoutCacheCapacity), m_hitCount(0), m_missCount(0)
+	{}
+
+	const TextLayout& TextLayoutCache::GetLayout(const Font& font, float fontSize, std::string_view text)
+	{
+		const LayoutKey key = { &font, fontSize, std::hash<std::string_view>()(text) };
+
+		// Move the layout to the front of the list if it's cached, as long as it was laid out from the same string
+		auto lookupIterator = m_entryLookup.find(key);
+		if (lookupIterator != m_entryLookup.end())
+		{
+			if (lookupIterator->second->text == text)
+			{
+				m_hitCount++;
+				m_entries.splice(m_entries.begin(), m_entries, lookupIterator->second);
+				return lookupIterator->second->layout;
+			}
+
+			// Hash collision, replace the cached layout with the layout for this string
+			m_entries.erase(lookupIterator->second);
+			m_entryLookup.erase(lookupIterator);
+		}
+
+		m_missCount++;
+
+		// Evict the least recently used layouts to make room for the new layout
+		while (!m_entries.empty() && m_entries.size() >= m_capacity)
+		{
+			m_entryLookup.erase(m_entries.back().key);
+			m_entries.pop_back();
+		}
+
+		m_entries.push_front({ key, std::string(text), TextLayout() });
+		m_entryLookup[key] = m_entries.begin();
+
+		LayoutText(font, fontSize, DecodeUTF8(text), m_entries.front().layout);
+		return m_entries.front().layout;
+	}
+
+	void TextLayoutCache::LayoutText(const Font& font, float fontSize, std::u32string_view codepoints, TextLayout& layout, size_t firstGlyph)
+	{
+		// The glyphs before the first glyph can only be kept if they were laid out using the same font size bucket
+		const uint32_t pixelSize = font.GetNearestPixelSize(fontSize);
+		if (layout.pixelSize != pixelSize || firstGlyph > layout.glyphs.size())
+			firstGlyph = 0;
+
+		// Use the glyphs rasterized at the pixel size closest to the font size, so that they need as little scaling as possible
+		layout.pixelSize = pixelSize;
+		layout.size = { 0, 0 };
+		layout.glyphs.resize(codepoints.size());
+
+		if (fontSize <= 0 || codepoints.empty())
+			return;
+
+		const float scale = fontSize / (float)layout.pixelSize;
+		const int padding = font.GetGlyphPadding();
+
+		glm::vec2 cursorPos = glm::vec2(0.0f);
+		int textWidth = 0, highestGlyphEdge = 0, lowestGlyphEdge = 0;
+
+		// Resume from the state after the glyph before the first glyph, the last glyph is always laid out again since it's measured differently
+		firstGlyph = std::min(firstGlyph, codepoints.size() - 1);
+		if (firstGlyph > 0)
+		{
+			const TextLayout::GlyphQuad& previousQuad = layout.glyphs[firstGlyph - 1];
+			cursorPos.x = previousQuad.penX;
+			textWidth = previousQuad.width;
+			highestGlyphEdge = previousQuad.highestEdge;
+			lowestGlyphEdge = previousQuad.lowestEdge;
+		}
+
+		for (size_t i = firstGlyph; i < codepoints.size(); i++)
+		{
+			const Font::GlyphMetrics& glyph = font.GetGlyph(codepoints[i], layout.pixelSize);
+
+			// Apply the kerning between the previous glyph and this glyph
+			if (i > 0)
+			{
+				const int kerning = font.GetKerning(codepoints[i - 1], codepoints[i], layout.pixelSize);
+				cursorPos.x += kerning * scale;
+				textWidth += kerning * scale;
+			}
+
+			// Calculate the position and size of the glyph
+			const int bearingX = i > 0 ? glyph.bearing.x : -padding; // Don't add horizontal bearing on first glyph position
+
+			TextLayout::GlyphQuad& quad = layout.glyphs[i];
+			quad.codepoint = codepoints[i];
+			quad.position = { cursorPos.x + bearingX * scale, cursorPos.y + (glyph.size.y - glyph.bearing.y) * scale };
+			quad.size = { glyph.size.x * scale, glyph.size.y * scale };
+
+			// Apply glyph advance amount onto the cursor's x position
+			if (i > 0)
+				cursorPos.x += glyph.advance * scale;
+			else
+				cursorPos.x += (glyph.advance - (glyph.bearing.x + padding)) * scale;
+
+			// Measure the glyph excluding any padding surrounding the glyph outline
+			glm::ivec2 glyphSize = glm::ivec2(glyph.size), glyphBearing = glm::ivec2(glyph.bearing);
+			if (padding > 0 && glyphSize.x > 0 && glyphSize.y > 0)
+			{
+				glyphSize -= glm::ivec2(padding * 2);
+				glyphBearing += glm::ivec2(padding, -padding);
+			}
+
+			// The text width spans the advance of every glyph apart from the last glyph, which is measured up to the edge of its outline
+			layout.size.x = textWidth + (glyphBearing.x * scale) + (glyphSize.x * scale);
+			textWidth += glyph.advance * scale;
+
+			// Check if the glyph is positioned higher or lower than the rest
+			const int glyphBottom = (glyphSize.y - glyphBearing.y) * scale,
+				glyphTop = glyphBearing.y * scale;
+
+			if (glyphTop > highestGlyphEdge)
+				highestGlyphEdge = glyphTop;
+			if (glyphBottom < lowestGlyphEdge)
+				lowestGlyphEdge = glyphBottom;
+
+			quad.penX = cursorPos.x;
+			quad.width = textWidth;
+			quad.highestEdge = highestGlyphEdge;
+			quad.lowestEdge = lowestGlyphEdge;
+		}
+
+		layout.size.y = highestGlyphEdge + lowestGlyphEdge; // Calculate the text string height from retrieved highest and lowest glyph edges
+	}
+
+	void TextLayoutCache::RemoveFont(const Font* font)
+	{
+		for (auto iterator = m_entries.begin(); iterator != m_entries.end();)
+		{
+			if (iterator->key.font == font)
+			{
+				m_entryLookup.erase(iterator->key);
+				iterator = m_entries.erase(iterator);
+			}
+			else
+			{
+				++iterator;
+			}
+		}
+	}
+
+	void TextLayoutCache::Clear()
+	{
+		m_entries.clear();
+		m_entryLookup.clear();
+		m_hitCount = m_missCount = 0;
+	}
+
+	void TextLayoutCache::SetCapacity(size_t capacity)
+	{
+		m_capacity = std::max(capacity, (size_t)1);
+
+		while (m_entries.size() > m_capacity)
+		{
+			m_entryLookup.erase(m_entries.back().key);
+			m_entries.pop_back();
+		}
+	}
+
+	size_t TextLayoutCache::GetSize() const { return m_entries.size(); }
+
+	uint64_t TextLayoutCache::GetHitCount() const { return m_hitCount; }
+
+	uint64_t TextLayoutCache::GetMissCount() const { return m_missCount; }
+
+	TextLayoutCache& TextLayoutCache::GetInstance()
+	{
+		static TextLayoutCache instance;
+		return instance;
+	}
+
+	bool TextLayoutCache::LayoutKey::operator==(const LayoutKey& other) const
+	{
+		return font == other.font && fontSize == other.fontSize && textHash == other.textHash;
+	}
+
+	size_t TextLayoutCache::LayoutKeyHasher::operator()(const LayoutKey& key) const
+	{
+		// Combine the hashes of the key members
+		size_t hash = std::hash<const Font*>()(key.font);
+		hash ^= std::hash<float>()(key.fontSize) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+		hash ^= std::hash<uint64_t>()(key.textHash) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+		return hash;
+	}
+}
\ No newline at end of file
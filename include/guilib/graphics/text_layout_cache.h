@@ -0,0 +1,157 @@
+#ifndef TEXT_LAYOUT_CACHE_H
+#define TEXT_LAYOUT_CACHE_H
+
+#include <graphics/font.h>
+#include <string_view>
+#include <string>
+#include <list>
+#include <unordered_map>
+
+namespace GUILib
+{
+	/**
+	* @brief A struct containing the layout of a string of text, this is everything needed to build the text's geometry apart from the
+	* glyphs' texture coordinates (which depend on the current state of the font's texture atlas).
+	*/
+	struct LIB_DECLSPEC TextLayout
+	{
+		/**
+		* @brief A struct containing the placement of a single glyph, relative to the origin of the text.
+		*/
+		struct GlyphQuad
+		{
+			uint32_t codepoint;
+			glm::vec2 position; // The position of the bottom-left corner of the glyph quad
+			glm::vec2 size; // The size of the glyph quad
+
+			// The state of the layout after this glyph, so that laying out the text can be resumed from the next glyph
+			float penX;
+			int width, highestEdge, lowestEdge;
+		};
+
+		std::vector<GlyphQuad> glyphs;
+		glm::ivec2 size = { 0, 0 }; // The measured size of the text, excluding any padding surrounding the glyph outlines
+		uint32_t pixelSize = 0; // The pixel size of the font size bucket which the glyphs are taken from
+	};
+
+	/**
+	* @brief This is a class for sharing text layouts between every piece of text using the same font, font size and string.
+	* The most recently used layouts are kept, so laying out a string that was laid out recently (e.g. the same option in several dropdowns,
+	* or a label switching between a small set of values) skips the glyph lookups and measurements entirely.
+	*/
+	class LIB_DECLSPEC TextLayoutCache
+	{
+	public:
+		~TextLayoutCache() = default;
+
+		/**
+		* @brief Returns the layout of the text given, laying out the text if it isn't already cached.
+		* The returned layout is only guaranteed to stay valid until the cache is next used.
+		*
+		* @param[in] font - The font which the text is rendered with.
+		* @param[in] fontSize - The size of the text font (in pixels).
+		* @param[in] text - The UTF-8 encoded string of text.
+		* @return The layout of the text.
+		*/
+		const TextLayout& GetLayout(const Font& font, float fontSize, std::string_view text);
+
+		/**
+		* @brief Removes every cached layout of the font given, this should be called before the font is freed.
+		* @param[in] font - The font whose layouts are to be removed.
+		*/
+		void RemoveFont(const Font* font);
+
+		/**
+		* @brief Removes every cached layout, the hit and miss counters are also reset.
+		*/
+		void Clear();
+
+		/**
+		* @brief Sets the maximum number of layouts that are cached, once exceeded the least recently used layouts are removed.
+		* @param[in] capacity - The maximum number of cached layouts.
+		*/
+		void SetCapacity(size_t capacity);
+
+		/**
+		* @brief Returns the number of layouts currently cached.
+		* @return The number of cached layouts.
+		*/
+		size_t GetSize() const;
+
+		/**
+		* @brief Returns the number of layout lookups which were found in the cache.
+		* @return The cache hit counter.
+		*/
+		uint64_t GetHitCount() const;
+
+		/**
+		* @brief Returns the number of layout lookups which had to lay out the text.
+		* @return The cache miss counter.
+		*/
+		uint64_t GetMissCount() const;
+
+		/**
+		* @brief Lays out the text given using the glyph metrics of the font.
+		* If the layout already contains the layout of text which shares its first glyphs with the text given (laid out with the same font
+		* and font size), then only the glyphs from the first glyph given onwards are laid out again. This is used by text which is edited
+		* in place, so that an edit only costs in proportion to the glyphs after the edit point.
+		*
+		* @param[in] font - The font which the text is rendered with.
+		* @param[in] fontSize - The size of the text font (in pixels).
+		* @param[in] codepoints - The codepoints of the text.
+		* @param[in,out] layout - The layout which the text is laid out into.
+		* @param[in] firstGlyph - The index of the first glyph which differs from the text previously laid out into the layout.
+		*/
+		static void LayoutText(const Font& font, float fontSize, std::u32string_view codepoints, TextLayout& layout, size_t firstGlyph = 0);
+
+		/**
+		* @brief Returns a singleton instance of this class.
+		* @return Singleton instance object of this class.
+		*/
+		static TextLayoutCache& GetInstance();
+	private:
+		/**
+		* @brief A struct identifying a cached layout, the hash of the string is stored rather than the string itself.
+		*/
+		struct LayoutKey
+		{
+			const Font* font;
+			float fontSize;
+			uint64_t textHash;
+
+			bool operator==(const LayoutKey& other) const;
+		};
+
+		/**
+		* @brief A struct used for hashing layout keys.
+		*/
+		struct LayoutKeyHasher
+		{
+			size_t operator()(const LayoutKey& key) const;
+		};
+
+		/**
+		* @brief A struct containing a cached layout, along with the string it was laid out from (so that hash collisions can be detected).
+		*/
+		struct CacheEntry
+		{
+			LayoutKey key;
+			std::string text;
+			TextLayout layout;
+		};
+
+		/**
+		* @brief This is the default class constructor.
+		*/
+		TextLayoutCache();
+	private:
+		// The cached layouts are ordered from most to least recently used
+		std::list<CacheEntry> m_entries;
+		std::unordered_map<LayoutKey, std::list<CacheEntry>::iterator, LayoutKeyHasher> m_entryLookup;
+		size_t m_capacity;
+
+		uint64_t m_hitCount, m_missCount;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include <graphics/tween_manager.h>
+#include <algorithm>
+
+namespace GUILib
+{
+	TweenManager::TweenManager() {}
+
+	TweenManager::Handle TweenManager::Create(glm::vec4 value)
+	{
+		if (!m_freeHandles.empty())
+		{
+			const Handle handle = m_freeHandles.back();
+			m_freeHandles.pop_back();
+
+			m_values[handle] = value;
+			return handle;
+		}
+
+		m_values.emplace_back(value);
+		m_tweenIndices.emplace_back(NO_TWEEN);
+		return (Handle)(m_values.size() - 1);
+	}
+
+	void TweenManager::Destroy(Handle handle)
+	{
+		if (handle >= m_values.size())
+			return;
+
+		if (m_tweenIndices[handle] != NO_TWEEN)
+			this->RemoveTween(m_tweenIndices[handle]);
+
+		m_freeHandles.emplace_back(handle);
+	}
+
+	void TweenManager::SetValue(Handle handle, glm::vec4 value)
+	{
+		m_values[handle] = value;
+		if (m_tweenIndices[handle] != NO_TWEEN)
+			this->RemoveTween(m_tweenIndices[handle]);
+	}
+
+	void TweenManager::AnimateTo(Handle handle, glm::vec4 target, float duration, EasingFunction easing)
+	{
+		uint32_t index = m_tweenIndices[handle];
+		if (index != NO_TWEEN ? m_tweenTargets[index] == target : m_values[handle] == target)
+			return;
+
+		if (duration <= 0.0f)
+		{
+			this->SetValue(handle, target);
+			return;
+		}
+
+		if (index == NO_TWEEN)
+		{
+			index = m_tweenIndices[handle] = (uint32_t)m_tweenHandles.size();
+			m_tweenStarts.emplace_back();
+			m_tweenTargets.emplace_back();
+			m_tweenValues.emplace_back();
+			m_tweenElapsedTimes.emplace_back();
+			m_tweenInverseDurations.emplace_back();
+			m_tweenProgress.emplace_back();
+			m_tweenFactors.emplace_back();
+			m_tweenEasings.emplace_back();
+			m_tweenHandles.emplace_back(handle);
+		}
+
+		// The tween is restarted from wherever the value currently is, so retargeting a running tween doesn't make the value jump
+		m_tweenStarts[index] = m_values[handle];
+		m_tweenTargets[index] = target;
+		m_tweenElapsedTimes[index] = 0.0f;
+		m_tweenInverseDurations[index] = 1.0f / duration;
+		m_tweenEasings[index] = easing;
+	}
+
+	void TweenManager::Update()
+	{
+		const float deltaTime = m_deltaTimeClock.GetElapsedTime();
+		m_deltaTimeClock.Reset();
+		this->Update(deltaTime);
+	}
+
+	void TweenManager::Update(float deltaTime)
+	{
+		const size_t tweenCount = m_tweenHandles.size();
+		if (tweenCount == 0)
+			return;
+
+		// The tweens are evaluated in separate passes over the packed arrays, so that the passes without branching can be vectorised
+		float* elapsedTimes = m_tweenElapsedTimes.data();
+		float* progress = m_tweenProgress.data();
+		float* factors = m_tweenFactors.data();
+		const float* inverseDurations = m_tweenInverseDurations.data();
+
+		for (size_t i = 0; i < tweenCount; i++)
+		{
+			elapsedTimes[i] += deltaTime;
+			progress[i] = std::min(elapsedTimes[i] * inverseDurations[i], 1.0f);
+		}
+
+		for (size_t i = 0; i < tweenCount; i++)
+			factors[i] = Ease(m_tweenEasings[i], progress[i]);
+
+		// Interpolate every component of every tween, each tween's four components share its eased factor
+		float* values = &m_tweenValues[0].x;
+		const float* starts = &m_tweenStarts[0].x;
+		const float* targets = &m_tweenTargets[0].x;
+
+		const size_t componentCount = tweenCount * 4;
+		for (size_t i = 0; i < componentCount; i++)
+			values[i] = starts[i] + ((targets[i] - starts[i]) * factors[i / 4]);
+
+		// Copy the tweened values back to the animated values, and retire the tweens which have completed
+		size_t keptCount = 0;
+		for (size_t i = 0; i < tweenCount; i++)
+		{
+			const Handle handle = m_tweenHandles[i];
+			if (progress[i] >= 1.0f)
+			{
+				m_values[handle] = m_tweenTargets[i];
+				m_tweenIndices[handle] = NO_TWEEN;
+				continue;
+			}
+
+			m_values[handle] = m_tweenValues[i];
+			if (keptCount != i)
+			{
+				m_tweenStarts[keptCount] = m_tweenStarts[i];
+				m_tweenTargets[keptCount] = m_tweenTargets[i];
+				m_tweenElapsedTimes[keptCount] = m_tweenElapsedTimes[i];
+				m_tweenInverseDurations[keptCount] = m_tweenInverseDurations[i];
+				m_tweenEasings[keptCount] = m_tweenEasings[i];
+				m_tweenHandles[keptCount] = handle;
+			}
+
+			m_tweenIndices[handle] = (uint32_t)keptCount++;
+		}
+
+		m_tweenStarts.resize(keptCount);
+		m_tweenTargets.resize(keptCount);
+		m_tweenValues.resize(keptCount);
+		m_tweenElapsedTimes.resize(keptCount);
+		m_tweenInverseDurations.resize(keptCount);
+		m_tweenProgress.resize(keptCount);
+		m_tweenFactors.resize(keptCount);
+		m_tweenEasings.resize(keptCount);
+		m_tweenHandles.resize(keptCount);
+	}
+
+	const glm::vec4& TweenManager::GetValue(Handle handle) const { return m_values[handle]; }
+
+	bool TweenManager::IsAnimating(Handle handle) const { return m_tweenIndices[handle] != NO_TWEEN; }
+
+	float TweenManager::GetTime() const { return m_clock.GetElapsedTime(); }
+
+	size_t TweenManager::GetActiveTweenCount() const { return m_tweenHandles.size(); }
+
+	void TweenManager::RemoveTween(uint32_t index)
+	{
+		m_tweenIndices[m_tweenHandles[index]] = NO_TWEEN;
+
+		// Swap the last tween into the removed tween's place, so that the tweens stay densely packed
+		const size_t lastIndex = m_tweenHandles.size() - 1;
+		if (index != lastIndex)
+		{
+			m_tweenStarts[index] = m_tweenStarts[lastIndex];
+			m_tweenTargets[index] = m_tweenTargets[lastIndex];
+			m_tweenElapsedTimes[index] = m_tweenElapsedTimes[lastIndex];
+			m_tweenInverseDurations[index] = m_tweenInverseDurations[lastIndex];
+			m_tweenEasings[index] = m_tweenEasings[lastIndex];
+			m_tweenHandles[index] = m_tweenHandles[lastIndex];
+			m_tweenIndices[m_tweenHandles[index]] = index;
+		}
+
+		m_tweenStarts.pop_back();
+		m_tweenTargets.pop_back();
+		m_tweenValues.pop_back();
+		m_tweenElapsedTimes.pop_back();
+		m_tweenInverseDurations.pop_back();
+		m_tweenProgress.pop_back();
+		m_tweenFactors.pop_back();
+		m_tweenEasings.pop_back();
+		m_tweenHandles.pop_back();
+	}
+
+	TweenManager& TweenManager::GetInstance()
+	{
+		static TweenManager instance;
+		return instance;
+	}
+}
\ No newline at end of file
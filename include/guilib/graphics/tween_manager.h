@@ -0,0 +1,131 @@
+#ifndef TWEEN_MANAGER_H
+#define TWEEN_MANAGER_H
+
+#include <graphics/animation.h>
+#include <utilities/timer.h>
+#include <vector>
+
+namespace GUILib
+{
+	/**
+	* @brief This is a class which animates values (such as the colors of UI components) towards their targets over a set duration, along an
+	* easing curve.
+	*
+	* Every animated value is stored by the manager and referred to by a handle. A tween is only registered when a value is given a new
+	* target, the tweens which are running are packed densely and evaluated together by a single batch of loops each frame, and retired as
+	* soon as they complete. So values which are at rest, or a screen which isn't animating at all, cost no animation work.
+	*/
+	class LIB_DECLSPEC TweenManager
+	{
+	public:
+		typedef uint32_t Handle;
+		static constexpr Handle INVALID_HANDLE = UINT32_MAX;
+
+		TweenManager(const TweenManager&) = delete;
+
+		/**
+		* @brief Creates a value which can be animated.
+		* @param[in] value - The initial value.
+		* @return The handle of the new value.
+		*/
+		Handle Create(glm::vec4 value);
+
+		/**
+		* @brief Destroys a value, stopping its tween if it is being animated.
+		* @param[in] handle - The handle of the value to be destroyed.
+		*/
+		void Destroy(Handle handle);
+
+		/**
+		* @brief Sets a value straight away, stopping its tween if it is being animated.
+		* @param[in] handle - The handle of the value.
+		* @param[in] value - The new value.
+		*/
+		void SetValue(Handle handle, glm::vec4 value);
+
+		/**
+		* @brief Animates a value from its current value to the target given.
+		* Nothing is registered if the value is already at (or being animated to) the target, otherwise the value's tween is restarted
+		* from its current value.
+		*
+		* @param[in] handle - The handle of the value.
+		* @param[in] target - The value to be animated to.
+		* @param[in] duration - The duration of the animation, in seconds. The value is set straight away if this isn't positive.
+		* @param[in] easing - The easing curve which the animation progresses along.
+		*/
+		void AnimateTo(Handle handle, glm::vec4 target, float duration, EasingFunction easing = EasingFunction::LINEAR);
+
+		/**
+		* @brief Advances every tween by the time elapsed since they were last advanced.
+		* This is called by every interface frame, after their UI components have been updated.
+		*/
+		void Update();
+
+		/**
+		* @brief Advances every tween, the tweens which complete are retired.
+		* @param[in] deltaTime - The elapsed time since the tweens were last advanced.
+		*/
+		void Update(float deltaTime);
+
+		/**
+		* @brief Returns the current value of an animated value.
+		* @param[in] handle - The handle of the value.
+		* @return The current value.
+		*/
+		const glm::vec4& GetValue(Handle handle) const;
+
+		/**
+		* @brief Returns whether or not a value is being animated.
+		* @param[in] handle - The handle of the value.
+		* @return TRUE if the value has a tween which hasn't completed yet, FALSE otherwise.
+		*/
+		bool IsAnimating(Handle handle) const;
+
+		/**
+		* @brief Returns the time elapsed since the tween manager was created, which is the clock that the color animations evaluated by the
+		* geometry shader are timed against.
+		* @return The time, in seconds.
+		*/
+		float GetTime() const;
+
+		/**
+		* @brief Returns the number of tweens which are running.
+		* @return The number of running tweens.
+		*/
+		size_t GetActiveTweenCount() const;
+
+		TweenManager& operator=(const TweenManager&) = delete;
+
+		/**
+		* @brief Returns the tween manager singleton instance.
+		* @return The tween manager instance.
+		*/
+		static TweenManager& GetInstance();
+	private:
+		TweenManager();
+
+		~TweenManager() = default;
+
+		/**
+		* @brief Removes the tween at the index given, by swapping the last tween into its place.
+		*/
+		void RemoveTween(uint32_t index);
+	private:
+		static constexpr uint32_t NO_TWEEN = UINT32_MAX;
+
+		std::vector<glm::vec4> m_values; // The current value of every animated value
+		std::vector<uint32_t> m_tweenIndices; // The index of each value's tween, or NO_TWEEN
+		std::vector<Handle> m_freeHandles;
+
+		// The running tweens, packed densely so that they are evaluated in a single batch. The progress is eased into a factor which
+		// interpolates from the start to the target value.
+		std::vector<glm::vec4> m_tweenStarts, m_tweenTargets, m_tweenValues;
+		std::vector<float> m_tweenElapsedTimes, m_tweenInverseDurations, m_tweenProgress, m_tweenFactors;
+		std::vector<EasingFunction> m_tweenEasings;
+		std::vector<Handle> m_tweenHandles;
+
+		Timer m_deltaTimeClock, m_clock;
+	};
+}
+
+#endif
\ No newline at end of file
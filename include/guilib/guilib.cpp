@@ -29,6 +29,7 @@ namespace GUILib
 		// Initialise the shaders required by the UI components
 		ResourceLoader::GetInstance().LoadShadersFromString("Geometry", ResourceConstants::geometryVshSrc, ResourceConstants::geometryFshSrc);
 		ResourceLoader::GetInstance().LoadShadersFromString("Text", ResourceConstants::geometryVshSrc, ResourceConstants::textRenderFshSrc);
+		ResourceLoader::GetInstance().LoadShadersFromString("TextSDF", ResourceConstants::geometryVshSrc, ResourceConstants::textRenderSDFFshSrc);
 
 		/// Initialise the basic geometry required by the UI components ///
 		// Square Geometry
@@ -0,0 +1,106 @@
+#include <utilities/disk_cache.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+namespace GUILib
+{
+	DiskCache::DiskCache()
+	{
+		// Default to a folder in the system's temporary directory
+		std::error_code errorCode;
+		const std::filesystem::path tempDirectory = std::filesystem::temp_directory_path(errorCode);
+		if (!errorCode)
+			this->SetDirectory((tempDirectory / "guilib-cache").string());
+	}
+
+	void DiskCache::SetDirectory(std::string_view path)
+	{
+		m_directory = path;
+
+		// Make sure the cache directory exists, if it can't be created then disable disk caching
+		if (!m_directory.empty())
+		{
+			std::error_code errorCode;
+			std::filesystem::create_directories(m_directory, errorCode);
+			if (errorCode)
+				m_directory.clear();
+		}
+	}
+
+	std::string DiskCache::GetEntryPath(std::string_view category, uint64_t key) const
+	{
+		std::stringstream fileName;
+		fileName << category << "-" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+		return (std::filesystem::path(m_directory) / fileName.str()).string();
+	}
+
+	bool DiskCache::Load(std::string_view category, uint64_t key, std::vector<uint8_t>& data) const
+	{
+		if (m_directory.empty())
+			return false;
+
+		std::ifstream fileStream(this->GetEntryPath(category, key), std::ios::binary | std::ios::ate);
+		if (fileStream.fail())
+			return false;
+
+		// Read the whole file into the vector given
+		const std::streamsize fileSize = fileStream.tellg();
+		if (fileSize <= 0)
+			return false;
+
+		data.resize((size_t)fileSize);
+		fileStream.seekg(0, std::ios::beg);
+		return (bool)fileStream.read((char*)data.data(), fileSize);
+	}
+
+	void DiskCache::Store(std::string_view category, uint64_t key, const void* data, size_t size) const
+	{
+		if (m_directory.empty())
+			return;
+
+		// Write into a temporary file first then rename it, this way a partially written entry is never picked up by Load()
+		const std::string entryPath = this->GetEntryPath(category, key);
+		const std::string tempPath = entryPath + ".tmp";
+		{
+			std::ofstream fileStream(tempPath, std::ios::binary | std::ios::trunc);
+			if (fileStream.fail())
+				return;
+
+			fileStream.write((const char*)data, (std::streamsize)size);
+			if (fileStream.fail())
+				return;
+		}
+
+		std::error_code errorCode;
+		std::filesystem::rename(tempPath, entryPath, errorCode);
+		if (errorCode)
+			std::filesystem::remove(tempPath, errorCode);
+	}
+
+	bool DiskCache::IsEnabled() const { return !m_directory.empty(); }
+
+	const std::string& DiskCache::GetDirectory() const { return m_directory; }
+
+	uint64_t DiskCache::HashBytes(const void* data, size_t size, uint64_t seed)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		uint64_t hash = seed;
+
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001b3ull;
+		}
+
+		return hash;
+	}
+
+	DiskCache& DiskCache::GetInstance()
+	{
+		static DiskCache instance;
+		return instance;
+	}
+}
\ No newline at end of file
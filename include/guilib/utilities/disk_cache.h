@@ -0,0 +1,93 @@
+#ifndef DISK_CACHE_H
+#define DISK_CACHE_H
+
+#include <utilities/libexport.h>
+#include <string_view>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace GUILib
+{
+	/**
+	* @brief This is a class for persisting expensive to generate resource data (e.g. font atlases) to disk, so that it can be reused across
+	* application launches.
+	* Each cached entry is identified by a category name and a 64-bit key, the key should be a hash of everything the cached data depends on.
+	*/
+	class LIB_DECLSPEC DiskCache
+	{
+	public:
+		~DiskCache() = default;
+
+		/**
+		* @brief Sets the directory where cached data is stored, the directory will be created if it doesn't exist.
+		* By default, a "guilib-cache" folder in the system's temporary directory is used.
+		*
+		* @param[in] path - The path of the cache directory. If an empty path is given, then disk caching will be disabled.
+		*/
+		void SetDirectory(std::string_view path);
+
+		/**
+		* @brief Loads the cached data identified by the category and key given.
+		*
+		* @param[in] category - The category of the cached data (e.g. "fonts").
+		* @param[in] key - The key identifying the cached data.
+		* @param[out] data - The vector which the cached data will be read into.
+		* @return TRUE if the cached data was found and read, FALSE otherwise.
+		*/
+		bool Load(std::string_view category, uint64_t key, std::vector<uint8_t>& data) const;
+
+		/**
+		* @brief Stores the data given in the cache, any existing data with the same category and key will be overwritten.
+		* Failing to write the data is not treated as an error, since the cache is only an optimisation.
+		*
+		* @param[in] category - The category of the cached data (e.g. "fonts").
+		* @param[in] key - The key identifying the cached data.
+		* @param[in] data - The data to be stored.
+		* @param[in] size - The size (in bytes) of the data.
+		*/
+		void Store(std::string_view category, uint64_t key, const void* data, size_t size) const;
+
+		/**
+		* @brief Returns whether or not disk caching is enabled.
+		* @return TRUE if a cache directory is set, FALSE otherwise.
+		*/
+		bool IsEnabled() const;
+
+		/**
+		* @brief Returns the directory where cached data is stored.
+		* @return The path of the cache directory, this will be empty if disk caching is disabled.
+		*/
+		const std::string& GetDirectory() const;
+
+		/**
+		* @brief Computes the 64-bit FNV-1a hash of the data given.
+		*
+		* @param[in] data - The data to be hashed.
+		* @param[in] size - The size (in bytes) of the data.
+		* @param[in] seed - The starting hash value, pass a previously computed hash in order to combine multiple blocks of data.
+		* @return The computed hash value.
+		*/
+		static uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull);
+
+		/**
+		* @brief Returns a singleton instance of this class.
+		* @return Singleton instance object of this class.
+		*/
+		static DiskCache& GetInstance();
+	private:
+		/**
+		* @brief This is the default class constructor.
+		*/
+		DiskCache();
+
+		/**
+		* @brief Returns the file path of the cached data identified by the category and key given.
+		*/
+		std::string GetEntryPath(std::string_view category, uint64_t key) const;
+	private:
+		std::string m_directory;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include <utilities/gap_buffer.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace GUILib
+{
+	GapBuffer::GapBuffer(std::string_view text) :
+		m_gapStart(0), m_gapEnd(0), m_textChanged(true)
+	{
+		this->SetText(text);
+	}
+
+	void GapBuffer::SetText(std::string_view text)
+	{
+		m_buffer.assign(text.begin(), text.end());
+		m_gapStart = m_gapEnd = text.size();
+		m_textChanged = true;
+	}
+
+	void GapBuffer::Insert(size_t offset, std::string_view text)
+	{
+		if (text.empty())
+			return;
+
+		this->MoveGap(std::min(offset, this->GetLength()));
+		if (m_gapEnd - m_gapStart < text.size())
+			this->GrowGap(text.size());
+
+		// Fill the start of the gap with the text
+		std::memcpy(m_buffer.data() + m_gapStart, text.data(), text.size());
+		m_gapStart += text.size();
+		m_textChanged = true;
+	}
+
+	void GapBuffer::Erase(size_t offset, size_t length)
+	{
+		offset = std::min(offset, this->GetLength());
+		length = std::min(length, this->GetLength() - offset);
+		if (length == 0)
+			return;
+
+		// Widen the gap over the erased text, erasing just before the gap (e.g. backspace) doesn't move the gap at all
+		if (offset + length == m_gapStart)
+		{
+			m_gapStart = offset;
+		}
+		else
+		{
+			this->MoveGap(offset);
+			m_gapEnd += length;
+		}
+
+		m_textChanged = true;
+	}
+
+	char GapBuffer::GetCharacter(size_t offset) const
+	{
+		return offset < m_gapStart ? m_buffer[offset] : m_buffer[offset + (m_gapEnd - m_gapStart)];
+	}
+
+	const std::string& GapBuffer::GetText() const
+	{
+		if (m_textChanged)
+		{
+			m_text.assign(m_buffer.data(), m_gapStart);
+			m_text.append(m_buffer.data() + m_gapEnd, m_buffer.size() - m_gapEnd);
+			m_textChanged = false;
+		}
+
+		return m_text;
+	}
+
+	size_t GapBuffer::GetLength() const { return m_buffer.size() - (m_gapEnd - m_gapStart); }
+
+	void GapBuffer::MoveGap(size_t offset)
+	{
+		if (offset < m_gapStart)
+		{
+			// Move the text between the offset and the gap to the end of the gap
+			const size_t moveLength = m_gapStart - offset;
+			std::memmove(m_buffer.data() + m_gapEnd - moveLength, m_buffer.data() + offset, moveLength);
+
+			m_gapStart -= moveLength;
+			m_gapEnd -= moveLength;
+		}
+		else if (offset > m_gapStart)
+		{
+			// Move the text between the gap and the offset to the start of the gap
+			const size_t moveLength = offset - m_gapStart;
+			std::memmove(m_buffer.data() + m_gapStart, m_buffer.data() + m_gapEnd, moveLength);
+
+			m_gapStart += moveLength;
+			m_gapEnd += moveLength;
+		}
+	}
+
+	void GapBuffer::GrowGap(size_t minimumSize)
+	{
+		const size_t textAfterGap = m_buffer.size() - m_gapEnd;
+		const size_t newSize = std::max(m_buffer.size() * 2, this->GetLength() + minimumSize);
+
+		// Enlarge the buffer, then move the text after the gap to the end of the enlarged buffer
+		m_buffer.resize(newSize);
+		std::memmove(m_buffer.data() + newSize - textAfterGap, m_buffer.data() + m_gapEnd, textAfterGap);
+		m_gapEnd = newSize - textAfterGap;
+	}
+}
\ No newline at end of file
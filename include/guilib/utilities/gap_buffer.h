@@ -0,0 +1,91 @@
+#ifndef GAP_BUFFER_H
+#define GAP_BUFFER_H
+
+#include <utilities/libexport.h>
+#include <string_view>
+#include <string>
+#include <vector>
+
+namespace GUILib
+{
+	/**
+	* @brief This is a class for storing a string of text which is edited around a caret.
+	* The text is stored in a single buffer with a gap of unused space at the position of the most recent edit. Inserting or erasing text
+	* at the gap only moves the gap's boundaries, so consecutive edits at the same position (e.g. typing, or holding backspace) cost in
+	* proportion to the amount of text changed rather than the length of the text. Moving the gap costs in proportion to the distance moved.
+	*/
+	class LIB_DECLSPEC GapBuffer
+	{
+	public:
+		/**
+		* @brief This is a class constructor that sets up the buffer with the text given.
+		* @param[in] text - The initial text of the buffer.
+		*/
+		GapBuffer(std::string_view text = "");
+
+		~GapBuffer() = default;
+
+		/**
+		* @brief Replaces the whole text of the buffer, the gap is moved to the end of the text.
+		* @param[in] text - The new text of the buffer.
+		*/
+		void SetText(std::string_view text);
+
+		/**
+		* @brief Inserts the text given into the buffer, moving the gap to the insertion point if required.
+		*
+		* @param[in] offset - The byte offset where the text is inserted (clamped to the length of the text).
+		* @param[in] text - The text to be inserted.
+		*/
+		void Insert(size_t offset, std::string_view text);
+
+		/**
+		* @brief Erases a range of text from the buffer, moving the gap to the range if required.
+		*
+		* @param[in] offset - The byte offset of the start of the range.
+		* @param[in] length - The length (in bytes) of the range, the range is clamped to the end of the text.
+		*/
+		void Erase(size_t offset, size_t length);
+
+		/**
+		* @brief Returns the byte at the offset given.
+		* @param[in] offset - The byte offset within the text, this must be less than the length of the text.
+		* @return The byte at the offset.
+		*/
+		char GetCharacter(size_t offset) const;
+
+		/**
+		* @brief Returns the whole text of the buffer.
+		* The text is assembled the first time it's requested after an edit, and then reused until the buffer is next edited.
+		*
+		* @return The buffer's text.
+		*/
+		const std::string& GetText() const;
+
+		/**
+		* @brief Returns the length of the text stored in the buffer.
+		* @return The length (in bytes) of the text.
+		*/
+		size_t GetLength() const;
+	private:
+		/**
+		* @brief Moves the gap so that it starts at the byte offset given.
+		* @param[in] offset - The byte offset within the text.
+		*/
+		void MoveGap(size_t offset);
+
+		/**
+		* @brief Enlarges the gap so that it's at least the size given, the buffer at least doubles in size to keep insertions cheap.
+		* @param[in] minimumSize - The minimum size (in bytes) of the gap.
+		*/
+		void GrowGap(size_t minimumSize);
+	private:
+		std::vector<char> m_buffer;
+		size_t m_gapStart, m_gapEnd;
+
+		mutable std::string m_text; // The assembled text, only valid if the text hasn't changed since it was assembled
+		mutable bool m_textChanged;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include <utilities/input_event_queue.h>
+
+namespace GUILib
+{
+	InputEventQueue::InputEventQueue(size_t capacity) :
+		m_head(0), m_tail(0), m_droppedEventCount(0)
+	{
+		// The indices wrap around by masking, so the capacity has to be a power of two
+		size_t powerOfTwoCapacity = 1;
+		while (powerOfTwoCapacity < capacity)
+			powerOfTwoCapacity <<= 1;
+
+		m_events.resize(powerOfTwoCapacity);
+		m_mask = powerOfTwoCapacity - 1;
+	}
+
+	bool InputEventQueue::Push(const InputEvent& event)
+	{
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		if (head - m_tail.load(std::memory_order_acquire) > m_mask)
+		{
+			m_droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		// Write the event before publishing it by advancing the head
+		m_events[head & m_mask] = event;
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool InputEventQueue::Pop(InputEvent& event)
+	{
+		const size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail == m_head.load(std::memory_order_acquire))
+			return false;
+
+		// Read the event before releasing its slot back to the producer by advancing the tail
+		event = m_events[tail & m_mask];
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool InputEventQueue::IsEmpty() const { return m_tail.load(std::memory_order_relaxed) == m_head.load(std::memory_order_acquire); }
+
+	uint64_t InputEventQueue::GetDroppedEventCount() const { return m_droppedEventCount.load(std::memory_order_relaxed); }
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef INPUT_EVENT_QUEUE_H
+#define INPUT_EVENT_QUEUE_H
+
+#include <utilities/input_system.h>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace GUILib
+{
+	/**
+	* @brief This is a bounded, lock-free queue of input events, for a single producer (the platform's event callbacks) and a single consumer
+	* (the input system, once per frame).
+	* Events are stored in a ring buffer, the producer only ever advances the head and the consumer only ever advances the tail, so neither
+	* side has to wait on the other. If the queue is full, newly pushed events are dropped (and counted) rather than overwriting unread events.
+	*/
+	class LIB_DECLSPEC InputEventQueue
+	{
+	public:
+		/**
+		* @brief This is a class constructor that allocates the ring buffer.
+		* @param[in] capacity - The maximum number of unread events, this is rounded up to a power of two.
+		*/
+		InputEventQueue(size_t capacity = 1024);
+
+		~InputEventQueue() = default;
+
+		/**
+		* @brief Adds an event onto the end of the queue, this must only be called by the producer.
+		* @param[in] event - The event to be added.
+		* @return TRUE if the event was added, FALSE if the queue was full (in which case the event is dropped).
+		*/
+		bool Push(const InputEvent& event);
+
+		/**
+		* @brief Removes the event at the front of the queue, this must only be called by the consumer.
+		* @param[out] event - The removed event.
+		* @return TRUE if an event was removed, FALSE if the queue was empty.
+		*/
+		bool Pop(InputEvent& event);
+
+		/**
+		* @brief Checks whether or not the queue is empty, this must only be called by the consumer.
+		* @return TRUE if there are no unread events, FALSE otherwise.
+		*/
+		bool IsEmpty() const;
+
+		/**
+		* @brief Returns the number of events dropped because the queue was full.
+		* @return The dropped event counter.
+		*/
+		uint64_t GetDroppedEventCount() const;
+	private:
+		std::vector<InputEvent> m_events;
+		size_t m_mask;
+
+		// The head and tail are kept on separate cache lines, so that the producer and consumer don't invalidate each other's cache line
+		alignas(64) std::atomic<size_t> m_head; // The index where the next event is pushed, only written by the producer
+		alignas(64) std::atomic<size_t> m_tail; // The index of the next event to be popped, only written by the consumer
+		std::atomic<uint64_t> m_droppedEventCount;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -1,223 +1,417 @@
 #include <utilities/input_system.h>
+#include <utilities/input_event_queue.h>
 #include <GLFW/glfw3.h>
+#include <array>
 
 namespace GUILib
 {
+	namespace
+	{
+		// The GLFW key code of each key code, in the order of the key code enumeration
+		constexpr std::array<int, (size_t)KeyCode::KEY_LAST> glfwKeyCodes =
+		{
+			GLFW_KEY_SPACE,
+			GLFW_KEY_APOSTROPHE,
+			GLFW_KEY_COMMA,
+			GLFW_KEY_MINUS,
+			GLFW_KEY_PERIOD,
+			GLFW_KEY_SLASH,
+			GLFW_KEY_0,
+			GLFW_KEY_1,
+			GLFW_KEY_2,
+			GLFW_KEY_3,
+			GLFW_KEY_4,
+			GLFW_KEY_5,
+			GLFW_KEY_6,
+			GLFW_KEY_7,
+			GLFW_KEY_8,
+			GLFW_KEY_9,
+			GLFW_KEY_SEMICOLON,
+			GLFW_KEY_EQUAL,
+			GLFW_KEY_A,
+			GLFW_KEY_B,
+			GLFW_KEY_C,
+			GLFW_KEY_D,
+			GLFW_KEY_E,
+			GLFW_KEY_F,
+			GLFW_KEY_G,
+			GLFW_KEY_H,
+			GLFW_KEY_I,
+			GLFW_KEY_J,
+			GLFW_KEY_K,
+			GLFW_KEY_L,
+			GLFW_KEY_M,
+			GLFW_KEY_N,
+			GLFW_KEY_O,
+			GLFW_KEY_P,
+			GLFW_KEY_Q,
+			GLFW_KEY_R,
+			GLFW_KEY_S,
+			GLFW_KEY_T,
+			GLFW_KEY_U,
+			GLFW_KEY_V,
+			GLFW_KEY_W,
+			GLFW_KEY_X,
+			GLFW_KEY_Y,
+			GLFW_KEY_Z,
+			GLFW_KEY_LEFT_BRACKET,
+			GLFW_KEY_BACKSLASH,
+			GLFW_KEY_RIGHT_BRACKET,
+			GLFW_KEY_GRAVE_ACCENT,
+			GLFW_KEY_WORLD_1,
+			GLFW_KEY_WORLD_2,
+			GLFW_KEY_ESCAPE,
+			GLFW_KEY_ENTER,
+			GLFW_KEY_TAB,
+			GLFW_KEY_BACKSPACE,
+			GLFW_KEY_INSERT,
+			GLFW_KEY_DELETE,
+			GLFW_KEY_RIGHT,
+			GLFW_KEY_LEFT,
+			GLFW_KEY_DOWN,
+			GLFW_KEY_UP,
+			GLFW_KEY_PAGE_UP,
+			GLFW_KEY_PAGE_DOWN,
+			GLFW_KEY_HOME,
+			GLFW_KEY_END,
+			GLFW_KEY_CAPS_LOCK,
+			GLFW_KEY_SCROLL_LOCK,
+			GLFW_KEY_NUM_LOCK,
+			GLFW_KEY_PRINT_SCREEN,
+			GLFW_KEY_PAUSE,
+			GLFW_KEY_F1,
+			GLFW_KEY_F2,
+			GLFW_KEY_F3,
+			GLFW_KEY_F4,
+			GLFW_KEY_F5,
+			GLFW_KEY_F6,
+			GLFW_KEY_F7,
+			GLFW_KEY_F8,
+			GLFW_KEY_F9,
+			GLFW_KEY_F10,
+			GLFW_KEY_F11,
+			GLFW_KEY_F12,
+			GLFW_KEY_F13,
+			GLFW_KEY_F14,
+			GLFW_KEY_F15,
+			GLFW_KEY_F16,
+			GLFW_KEY_F17,
+			GLFW_KEY_F18,
+			GLFW_KEY_F19,
+			GLFW_KEY_F20,
+			GLFW_KEY_F21,
+			GLFW_KEY_F22,
+			GLFW_KEY_F23,
+			GLFW_KEY_F24,
+			GLFW_KEY_F25,
+			GLFW_KEY_KP_0,
+			GLFW_KEY_KP_1,
+			GLFW_KEY_KP_2,
+			GLFW_KEY_KP_3,
+			GLFW_KEY_KP_4,
+			GLFW_KEY_KP_5,
+			GLFW_KEY_KP_6,
+			GLFW_KEY_KP_7,
+			GLFW_KEY_KP_8,
+			GLFW_KEY_KP_9,
+			GLFW_KEY_KP_DECIMAL,
+			GLFW_KEY_KP_DIVIDE,
+			GLFW_KEY_KP_MULTIPLY,
+			GLFW_KEY_KP_SUBTRACT,
+			GLFW_KEY_KP_ADD,
+			GLFW_KEY_KP_ENTER,
+			GLFW_KEY_KP_EQUAL,
+			GLFW_KEY_LEFT_SHIFT,
+			GLFW_KEY_LEFT_CONTROL,
+			GLFW_KEY_LEFT_ALT,
+			GLFW_KEY_LEFT_SUPER,
+			GLFW_KEY_RIGHT_SHIFT,
+			GLFW_KEY_RIGHT_CONTROL,
+			GLFW_KEY_RIGHT_ALT,
+			GLFW_KEY_RIGHT_SUPER,
+			GLFW_KEY_MENU
+		};
+		static_assert(glfwKeyCodes.back() == GLFW_KEY_MENU, "Every key code must have a GLFW key code");
+
+		// The bit index of each mouse button code within the input snapshot, the named mouse buttons share the bits of the numbered ones
+		constexpr std::array<size_t, (size_t)MouseButtonCode::MOUSE_BUTTON_MIDDLE + 1> mouseButtonIndices = { 0, 1, 2, 3, 4, 5, 6, 7, 7, 0, 1, 2 };
+
+		/**
+		* @brief Builds the reverse mapping from GLFW key codes to key codes, GLFW keys without a key code map to KEY_LAST.
+		*/
+		constexpr std::array<KeyCode, GLFW_KEY_LAST + 1> CreateKeyCodeTable()
+		{
+			std::array<KeyCode, GLFW_KEY_LAST + 1> keyCodes = {};
+			for (size_t i = 0; i < keyCodes.size(); i++)
+				keyCodes[i] = KeyCode::KEY_LAST;
+			for (size_t key = 0; key < glfwKeyCodes.size(); key++)
+				keyCodes[glfwKeyCodes[key]] = (KeyCode)key;
+
+			return keyCodes;
+		}
+
+		constexpr std::array<KeyCode, GLFW_KEY_LAST + 1> keyCodes = CreateKeyCodeTable();
+	}
+
 	namespace Callbacks
 	{
-		static uint32_t characterInputted = 0x0;
-		static void PollTextInputCallback(GLFWwindow* window, uint32_t codePoint)
+		// Every callback pushes its event onto the queue, which is drained by the input system at the start of each frame
+		static InputEventQueue eventQueue;
+
+		static KeyModifier GetKeyModifiers(int mods)
 		{
-			characterInputted = codePoint;
+			KeyModifier modifiers = KeyModifier::NONE;
+			if (mods & GLFW_MOD_SHIFT)
+				modifiers = modifiers | KeyModifier::SHIFT;
+			if (mods & GLFW_MOD_CONTROL)
+				modifiers = modifiers | KeyModifier::CONTROL;
+			if (mods & GLFW_MOD_ALT)
+				modifiers = modifiers | KeyModifier::ALT;
+			if (mods & GLFW_MOD_SUPER)
+				modifiers = modifiers | KeyModifier::SUPER;
+
+			return modifiers;
 		}
 
-		static glm::vec2 scrollOffset;
-		static void GetScrollOffsetsCallback(GLFWwindow* window, double offsetX, double offsetY)
+		static void PollTextInputCallback(GLFWwindow* /*window*/, uint32_t codePoint)
 		{
-			scrollOffset = { (float)offsetX, (float)offsetY };
+			InputEvent event = {};
+			event.type = InputEventType::CHARACTER;
+			event.timestamp = glfwGetTime();
+			event.codepoint = codePoint;
+
+			eventQueue.Push(event);
 		}
-	}
 
-	void InputSystem::InitGLFWImpl(GLFWwindow* window) 
-	{ 
-		m_glfwWindow = window; 
+		static void PollKeyCallback(GLFWwindow* /*window*/, int key, int /*scancode*/, int action, int mods)
+		{
+			if (key < 0 || key > GLFW_KEY_LAST || keyCodes[key] == KeyCode::KEY_LAST || action == GLFW_REPEAT)
+				return;
 
-		// Setup the callback functions
-		glfwSetCharCallback(window, Callbacks::PollTextInputCallback);
-		glfwSetScrollCallback(window, Callbacks::GetScrollOffsetsCallback);
-	}
+			InputEvent event = {};
+			event.type = action == GLFW_PRESS ? InputEventType::KEY_DOWN : InputEventType::KEY_UP;
+			event.timestamp = glfwGetTime();
+			event.key = keyCodes[key];
+			event.modifiers = GetKeyModifiers(mods);
 
-	int InputSystem::GetGLFWKeyCode(KeyCode key) const
-	{
-		switch (key)
+			eventQueue.Push(event);
+		}
+
+		static void PollMouseButtonCallback(GLFWwindow* /*window*/, int button, int action, int mods)
 		{
-			case KeyCode::KEY_SPACE: return GLFW_KEY_SPACE;
-			case KeyCode::KEY_APOSTROPHE: return GLFW_KEY_APOSTROPHE;
-			case KeyCode::KEY_COMMA: return GLFW_KEY_COMMA;
-			case KeyCode::KEY_MINUS: return GLFW_KEY_MINUS;
-			case KeyCode::KEY_PERIOD: return GLFW_KEY_PERIOD;
-			case KeyCode::KEY_SLASH: return GLFW_KEY_SLASH;
-			case KeyCode::KEY_0: return GLFW_KEY_0;
-			case KeyCode::KEY_1: return GLFW_KEY_1;
-			case KeyCode::KEY_2: return GLFW_KEY_2;
-			case KeyCode::KEY_3: return GLFW_KEY_3;
-			case KeyCode::KEY_4: return GLFW_KEY_4;
-			case KeyCode::KEY_5: return GLFW_KEY_5;
-			case KeyCode::KEY_6: return GLFW_KEY_6;
-			case KeyCode::KEY_7: return GLFW_KEY_7;
-			case KeyCode::KEY_8: return GLFW_KEY_8;
-			case KeyCode::KEY_9: return GLFW_KEY_9;
-			case KeyCode::KEY_SEMICOLON: return GLFW_KEY_SEMICOLON;
-			case KeyCode::KEY_EQUAL: return GLFW_KEY_EQUAL;
-			case KeyCode::KEY_A: return GLFW_KEY_A;
-			case KeyCode::KEY_B: return GLFW_KEY_B;
-			case KeyCode::KEY_C: return GLFW_KEY_C;
-			case KeyCode::KEY_D: return GLFW_KEY_D;
-			case KeyCode::KEY_E: return GLFW_KEY_E;
-			case KeyCode::KEY_F: return GLFW_KEY_F;
-			case KeyCode::KEY_G: return GLFW_KEY_G;
-			case KeyCode::KEY_H: return GLFW_KEY_H;
-			case KeyCode::KEY_I: return GLFW_KEY_I;
-			case KeyCode::KEY_J: return GLFW_KEY_J;
-			case KeyCode::KEY_K: return GLFW_KEY_K;
-			case KeyCode::KEY_L: return GLFW_KEY_L;
-			case KeyCode::KEY_M: return GLFW_KEY_M;
-			case KeyCode::KEY_N: return GLFW_KEY_N;
-			case KeyCode::KEY_O: return GLFW_KEY_O;
-			case KeyCode::KEY_P: return GLFW_KEY_P;
-			case KeyCode::KEY_Q: return GLFW_KEY_Q;
-			case KeyCode::KEY_R: return GLFW_KEY_R;
-			case KeyCode::KEY_S: return GLFW_KEY_S;
-			case KeyCode::KEY_T: return GLFW_KEY_T;
-			case KeyCode::KEY_U: return GLFW_KEY_U;
-			case KeyCode::KEY_V: return GLFW_KEY_V;
-			case KeyCode::KEY_W: return GLFW_KEY_W;
-			case KeyCode::KEY_X: return GLFW_KEY_X;
-			case KeyCode::KEY_Y: return GLFW_KEY_Y;
-			case KeyCode::KEY_Z: return GLFW_KEY_Z;
-			case KeyCode::KEY_LEFT_BRACKET: return GLFW_KEY_LEFT_BRACKET; // [
-			case KeyCode::KEY_BACKSLASH: return GLFW_KEY_BACKSLASH;
-			case KeyCode::KEY_RIGHT_BRACKET: return GLFW_KEY_RIGHT_BRACKET; // ]
-			case KeyCode::KEY_GRAVE_ACCENT: return GLFW_KEY_GRAVE_ACCENT;
-			case KeyCode::KEY_WORLD_1: return GLFW_KEY_WORLD_1;
-			case KeyCode::KEY_WORLD_2: return GLFW_KEY_WORLD_2;
-			case KeyCode::KEY_ESCAPE: return GLFW_KEY_ESCAPE;
-			case KeyCode::KEY_ENTER: return GLFW_KEY_ENTER;
-			case KeyCode::KEY_TAB: return GLFW_KEY_TAB;
-			case KeyCode::KEY_BACKSPACE: return GLFW_KEY_BACKSPACE;
-			case KeyCode::KEY_INSERT: return GLFW_KEY_INSERT;
-			case KeyCode::KEY_DELETE: return GLFW_KEY_DELETE;
-			case KeyCode::KEY_RIGHT: return GLFW_KEY_RIGHT;
-			case KeyCode::KEY_LEFT: return GLFW_KEY_LEFT;
-			case KeyCode::KEY_DOWN: return GLFW_KEY_DOWN;
-			case KeyCode::KEY_UP: return GLFW_KEY_UP;
-			case KeyCode::KEY_PAGE_UP: return GLFW_KEY_PAGE_UP;
-			case KeyCode::KEY_PAGE_DOWN: return GLFW_KEY_PAGE_DOWN;
-			case KeyCode::KEY_HOME: return GLFW_KEY_HOME;
-			case KeyCode::KEY_END: return GLFW_KEY_END;
-			case KeyCode::KEY_CAPS_LOCK: return GLFW_KEY_CAPS_LOCK;
-			case KeyCode::KEY_SCROLL_LOCK: return GLFW_KEY_SCROLL_LOCK;
-			case KeyCode::KEY_NUM_LOCK: return GLFW_KEY_NUM_LOCK;
-			case KeyCode::KEY_PRINT_SCREEN: return GLFW_KEY_PRINT_SCREEN;
-			case KeyCode::KEY_PAUSE: return GLFW_KEY_PAUSE;
-			case KeyCode::KEY_F1: return GLFW_KEY_F1;
-			case KeyCode::KEY_F2: return GLFW_KEY_F2;
-			case KeyCode::KEY_F3: return GLFW_KEY_F3;
-			case KeyCode::KEY_F4: return GLFW_KEY_F4;
-			case KeyCode::KEY_F5: return GLFW_KEY_F5;
-			case KeyCode::KEY_F6: return GLFW_KEY_F6;
-			case KeyCode::KEY_F7: return GLFW_KEY_F7;
-			case KeyCode::KEY_F8: return GLFW_KEY_F8;
-			case KeyCode::KEY_F9: return GLFW_KEY_F9;
-			case KeyCode::KEY_F10: return GLFW_KEY_F10;
-			case KeyCode::KEY_F11: return GLFW_KEY_F11;
-			case KeyCode::KEY_F12: return GLFW_KEY_F12;
-			case KeyCode::KEY_F13: return GLFW_KEY_F13;
-			case KeyCode::KEY_F14: return GLFW_KEY_F14;
-			case KeyCode::KEY_F15: return GLFW_KEY_F15;
-			case KeyCode::KEY_F16: return GLFW_KEY_F16;
-			case KeyCode::KEY_F17: return GLFW_KEY_F17;
-			case KeyCode::KEY_F18: return GLFW_KEY_F18;
-			case KeyCode::KEY_F19: return GLFW_KEY_F19;
-			case KeyCode::KEY_F20: return GLFW_KEY_F20;
-			case KeyCode::KEY_F21: return GLFW_KEY_F21;
-			case KeyCode::KEY_F22: return GLFW_KEY_F22;
-			case KeyCode::KEY_F23: return GLFW_KEY_F23;
-			case KeyCode::KEY_F24: return GLFW_KEY_F24;
-			case KeyCode::KEY_F25: return GLFW_KEY_F25;
-			case KeyCode::KEY_KP_0: return GLFW_KEY_KP_0;
-			case KeyCode::KEY_KP_1: return GLFW_KEY_KP_1;
-			case KeyCode::KEY_KP_2: return GLFW_KEY_KP_2;
-			case KeyCode::KEY_KP_3: return GLFW_KEY_KP_3;
-			case KeyCode::KEY_KP_4: return GLFW_KEY_KP_4;
-			case KeyCode::KEY_KP_5: return GLFW_KEY_KP_5;
-			case KeyCode::KEY_KP_6: return GLFW_KEY_KP_6;
-			case KeyCode::KEY_KP_7: return GLFW_KEY_KP_7;
-			case KeyCode::KEY_KP_8: return GLFW_KEY_KP_8;
-			case KeyCode::KEY_KP_9: return GLFW_KEY_KP_9;
-			case KeyCode::KEY_KP_DECIMAL: return GLFW_KEY_KP_DECIMAL;
-			case KeyCode::KEY_KP_DIVIDE: return GLFW_KEY_KP_DIVIDE;
-			case KeyCode::KEY_KP_MULTIPLY: return GLFW_KEY_KP_MULTIPLY;
-			case KeyCode::KEY_KP_SUBTRACT: return GLFW_KEY_KP_SUBTRACT;
-			case KeyCode::KEY_KP_ADD: return GLFW_KEY_KP_ADD;
-			case KeyCode::KEY_KP_ENTER: return GLFW_KEY_KP_ENTER;
-			case KeyCode::KEY_KP_EQUAL: return GLFW_KEY_KP_EQUAL;
-			case KeyCode::KEY_LEFT_SHIFT: return GLFW_KEY_LEFT_SHIFT;
-			case KeyCode::KEY_LEFT_CONTROL: return GLFW_KEY_LEFT_CONTROL;
-			case KeyCode::KEY_LEFT_ALT: return GLFW_KEY_LEFT_ALT;
-			case KeyCode::KEY_LEFT_SUPER: return GLFW_KEY_LEFT_SUPER;
-			case KeyCode::KEY_RIGHT_SHIFT: return GLFW_KEY_RIGHT_SHIFT;
-			case KeyCode::KEY_RIGHT_CONTROL: return GLFW_KEY_RIGHT_CONTROL;
-			case KeyCode::KEY_RIGHT_ALT: return GLFW_KEY_RIGHT_ALT;
-			case KeyCode::KEY_RIGHT_SUPER: return GLFW_KEY_RIGHT_SUPER;
-			case KeyCode::KEY_MENU: return GLFW_KEY_MENU;
-			case KeyCode::KEY_LAST: return GLFW_KEY_MENU;
+			InputEvent event = {};
+			event.type = action == GLFW_PRESS ? InputEventType::MOUSE_BUTTON_DOWN : InputEventType::MOUSE_BUTTON_UP;
+			event.timestamp = glfwGetTime();
+			event.button = (MouseButtonCode)button; // The numbered mouse button codes match the GLFW mouse button codes
+			event.modifiers = GetKeyModifiers(mods);
+
+			eventQueue.Push(event);
 		}
 
-		return -1;
-	}
+		static void PollCursorPositionCallback(GLFWwindow* /*window*/, double positionX, double positionY)
+		{
+			InputEvent event = {};
+			event.type = InputEventType::MOUSE_MOVED;
+			event.timestamp = glfwGetTime();
+			event.cursorPosition = { (float)positionX, (float)positionY };
 
-	int InputSystem::GetGLFWMouseCode(MouseButtonCode button) const
-	{
-		switch (button)
+			eventQueue.Push(event);
+		}
+
+		static void GetScrollOffsetsCallback(GLFWwindow* /*window*/, double offsetX, double offsetY)
 		{
-			case MouseButtonCode::MOUSE_BUTTON_1: return GLFW_MOUSE_BUTTON_1;
-			case MouseButtonCode::MOUSE_BUTTON_2: return GLFW_MOUSE_BUTTON_2;
-			case MouseButtonCode::MOUSE_BUTTON_3: return GLFW_MOUSE_BUTTON_3;
-			case MouseButtonCode::MOUSE_BUTTON_4: return GLFW_MOUSE_BUTTON_4;
-			case MouseButtonCode::MOUSE_BUTTON_5: return GLFW_MOUSE_BUTTON_5;
-			case MouseButtonCode::MOUSE_BUTTON_6: return GLFW_MOUSE_BUTTON_6;
-			case MouseButtonCode::MOUSE_BUTTON_7: return GLFW_MOUSE_BUTTON_7;
-			case MouseButtonCode::MOUSE_BUTTON_8: return GLFW_MOUSE_BUTTON_8;
-			case MouseButtonCode::MOUSE_BUTTON_LAST: return GLFW_MOUSE_BUTTON_8;
-			case MouseButtonCode::MOUSE_BUTTON_LEFT: return GLFW_MOUSE_BUTTON_1;
-			case MouseButtonCode::MOUSE_BUTTON_RIGHT: return GLFW_MOUSE_BUTTON_2;
-			case MouseButtonCode::MOUSE_BUTTON_MIDDLE: return GLFW_MOUSE_BUTTON_3;
+			InputEvent event = {};
+			event.type = InputEventType::MOUSE_SCROLLED;
+			event.timestamp = glfwGetTime();
+			event.scrollOffset = { (float)offsetX, (float)offsetY };
+
+			eventQueue.Push(event);
 		}
+	}
+
+	InputSnapshot::InputSnapshot() :
+		m_cursorPosition({ 0.0f, 0.0f }), m_windowSize({ 0.0f, 0.0f }), m_scrollOffset({ 0.0f, 0.0f })
+	{}
+
+	bool InputSnapshot::IsKeyDown(KeyCode key) const { return (size_t)key < KEY_COUNT && m_keysDown[(size_t)key]; }
+
+	bool InputSnapshot::WasKeyPressedThisFrame(KeyCode key) const { return (size_t)key < KEY_COUNT && m_keysPressed[(size_t)key]; }
+
+	bool InputSnapshot::WasKeyReleasedThisFrame(KeyCode key) const { return (size_t)key < KEY_COUNT && m_keysReleased[(size_t)key]; }
 
-		return -1;
+	bool InputSnapshot::IsMouseButtonDown(MouseButtonCode button) const
+	{
+		return (size_t)button < mouseButtonIndices.size() && m_mouseButtonsDown[mouseButtonIndices[(size_t)button]];
 	}
 
-	bool InputSystem::WasKeyPressed(KeyCode key) const
+	bool InputSnapshot::WasMouseButtonPressedThisFrame(MouseButtonCode button) const
 	{
-		return glfwGetKey(m_glfwWindow, this->GetGLFWKeyCode(key));
+		return (size_t)button < mouseButtonIndices.size() && m_mouseButtonsPressed[mouseButtonIndices[(size_t)button]];
 	}
 
-	bool InputSystem::WasMouseButtonPressed(MouseButtonCode button) const
+	bool InputSnapshot::WasMouseButtonReleasedThisFrame(MouseButtonCode button) const
 	{
-		return glfwGetMouseButton(m_glfwWindow, this->GetGLFWMouseCode(button));
+		return (size_t)button < mouseButtonIndices.size() && m_mouseButtonsReleased[mouseButtonIndices[(size_t)button]];
+	}
+
+	glm::vec2 InputSnapshot::GetCursorPosition(const Viewport* viewport) const
+	{
+		// If a viewport camera was given then map the cursor position to it's dimensions
+		return viewport ? this->MapToViewport(m_cursorPosition, *viewport) : m_cursorPosition;
 	}
 
-	glm::vec2 InputSystem::GetCursorPosition(const Viewport* viewport) const
+	glm::vec2 InputSnapshot::MapToViewport(glm::vec2 windowPosition, const Viewport& viewport) const
 	{
-		// Get the current cursor position
+		if (m_windowSize.x <= 0.0f || m_windowSize.y <= 0.0f)
+			return windowPosition;
+
+		return glm::vec2(viewport.GetPosition().x + (windowPosition.x * (viewport.GetSize().x / m_windowSize.x)),
+			viewport.GetPosition().y + (windowPosition.y * (viewport.GetSize().y / m_windowSize.y)));
+	}
+
+	const glm::vec2& InputSnapshot::GetScrollOffset() const { return m_scrollOffset; }
+
+	InputSystem::InputSystem() :
+		m_glfwWindow(nullptr), m_nextCharacterEvent(0), m_scrollOffset({ 0.0f, 0.0f }), m_frameIndex(0)
+	{}
+
+	void InputSystem::InitGLFWImpl(GLFWwindow* window) 
+	{ 
+		m_glfwWindow = window; 
+
+		// The snapshot is only updated by events, so it starts off with the current cursor position and window size
 		double cursorPosX = 0.0, cursorPosY = 0.0;
-		glfwGetCursorPos(m_glfwWindow, &cursorPosX, &cursorPosY);
+		int windowWidth = 0, windowHeight = 0;
+		glfwGetCursorPos(window, &cursorPosX, &cursorPosY);
+		glfwGetWindowSize(window, &windowWidth, &windowHeight);
+		m_snapshot.m_cursorPosition = { (float)cursorPosX, (float)cursorPosY };
+		m_snapshot.m_windowSize = { (float)windowWidth, (float)windowHeight };
 
-		// If a viewport camera was given then map the cursor position to it's dimensions
-		if (viewport)
+		// Setup the callback functions
+		glfwSetCharCallback(window, Callbacks::PollTextInputCallback);
+		glfwSetKeyCallback(window, Callbacks::PollKeyCallback);
+		glfwSetMouseButtonCallback(window, Callbacks::PollMouseButtonCallback);
+		glfwSetCursorPosCallback(window, Callbacks::PollCursorPositionCallback);
+		glfwSetScrollCallback(window, Callbacks::GetScrollOffsetsCallback);
+	}
+
+	void InputSystem::NewFrame()
+	{
+		m_events.clear();
+		m_nextCharacterEvent = 0;
+		m_scrollOffset = { 0.0f, 0.0f };
+
+		// The held down states carry over from the previous frame, whereas the edges only cover this frame's events
+		m_snapshot.m_keysPressed.reset();
+		m_snapshot.m_keysReleased.reset();
+		m_snapshot.m_mouseButtonsPressed.reset();
+		m_snapshot.m_mouseButtonsReleased.reset();
+		m_snapshot.m_scrollOffset = { 0.0f, 0.0f };
+
+		if (m_glfwWindow)
 		{
 			int windowWidth = 0, windowHeight = 0;
 			glfwGetWindowSize(m_glfwWindow, &windowWidth, &windowHeight);
-			cursorPosX = viewport->GetPosition().x + (cursorPosX * (viewport->GetSize().x / (float)windowWidth));
-			cursorPosY = viewport->GetPosition().y + (cursorPosY * (viewport->GetSize().y / (float)windowHeight));
+			m_snapshot.m_windowSize = { (float)windowWidth, (float)windowHeight };
 		}
 
-		return glm::vec2((float)cursorPosX, (float)cursorPosY);
+		InputEvent event;
+		while (Callbacks::eventQueue.Pop(event))
+		{
+			this->ApplyEventToSnapshot(event);
+			if (event.type == InputEventType::MOUSE_SCROLLED)
+				m_scrollOffset += event.scrollOffset;
+
+			// Only the latest of several consecutive cursor motion events matters, and consecutive scroll events are summed into one
+			if (!m_events.empty() && m_events.back().type == event.type)
+			{
+				if (event.type == InputEventType::MOUSE_MOVED)
+				{
+					m_events.back() = event;
+					continue;
+				}
+				else if (event.type == InputEventType::MOUSE_SCROLLED)
+				{
+					m_events.back().scrollOffset += event.scrollOffset;
+					m_events.back().timestamp = event.timestamp;
+					continue;
+				}
+			}
+
+			m_events.push_back(event);
+		}
+
+		m_frameIndex++;
+	}
+
+	void InputSystem::ApplyEventToSnapshot(const InputEvent& event)
+	{
+		switch (event.type)
+		{
+			case InputEventType::KEY_DOWN:
+				m_snapshot.m_keysDown.set((size_t)event.key);
+				m_snapshot.m_keysPressed.set((size_t)event.key);
+				break;
+			case InputEventType::KEY_UP:
+				m_snapshot.m_keysDown.reset((size_t)event.key);
+				m_snapshot.m_keysReleased.set((size_t)event.key);
+				break;
+			case InputEventType::MOUSE_BUTTON_DOWN:
+				m_snapshot.m_mouseButtonsDown.set(mouseButtonIndices[(size_t)event.button]);
+				m_snapshot.m_mouseButtonsPressed.set(mouseButtonIndices[(size_t)event.button]);
+				break;
+			case InputEventType::MOUSE_BUTTON_UP:
+				m_snapshot.m_mouseButtonsDown.reset(mouseButtonIndices[(size_t)event.button]);
+				m_snapshot.m_mouseButtonsReleased.set(mouseButtonIndices[(size_t)event.button]);
+				break;
+			case InputEventType::MOUSE_MOVED:
+				m_snapshot.m_cursorPosition = event.cursorPosition;
+				break;
+			case InputEventType::MOUSE_SCROLLED:
+				m_snapshot.m_scrollOffset += event.scrollOffset;
+				break;
+			default:
+				break;
+		}
 	}
 
+	bool InputSystem::WasKeyPressed(KeyCode key) const { return m_snapshot.IsKeyDown(key); }
+
+	bool InputSystem::WasMouseButtonPressed(MouseButtonCode button) const { return m_snapshot.IsMouseButtonDown(button); }
+
+	glm::vec2 InputSystem::GetCursorPosition(const Viewport* viewport) const { return m_snapshot.GetCursorPosition(viewport); }
+
 	glm::vec2 InputSystem::GetScrollOffset() const
 	{
-		const glm::vec2 scrollOffset = Callbacks::scrollOffset;
-		Callbacks::scrollOffset = glm::vec2(0);
+		const glm::vec2 scrollOffset = m_scrollOffset;
+		m_scrollOffset = glm::vec2(0);
 		return scrollOffset;
 	}
 
 	uint32_t InputSystem::GetInputtedCharacter() const
 	{
-		const uint32_t character = Callbacks::characterInputted;
-		Callbacks::characterInputted = 0x0;
-		return character;
+		// Find the next character event of the current frame
+		for (; m_nextCharacterEvent < m_events.size(); m_nextCharacterEvent++)
+		{
+			if (m_events[m_nextCharacterEvent].type == InputEventType::CHARACTER)
+				return m_events[m_nextCharacterEvent++].codepoint;
+		}
+
+		return 0x0;
+	}
+
+	const std::vector<InputEvent>& InputSystem::GetEvents() const { return m_events; }
+
+	const InputSnapshot& InputSystem::GetSnapshot() const { return m_snapshot; }
+
+	uint64_t InputSystem::GetFrameIndex() const { return m_frameIndex; }
+
+	bool InputSystem::HasQueuedEvents() const { return !Callbacks::eventQueue.IsEmpty(); }
+
+	std::string InputSystem::GetClipboardText() const
+	{
+		const char* clipboardText = glfwGetClipboardString(m_glfwWindow);
+		return clipboardText ? std::string(clipboardText) : std::string();
 	}
 
 	InputSystem& InputSystem::GetInstance()
@@ -4,6 +4,9 @@
 #include <utilities/libexport.h>
 #include <graphics/viewport.h>
 #include <external/glm/glm/glm.hpp>
+#include <bitset>
+#include <string>
+#include <vector>
 
 struct GLFWwindow;
 
@@ -159,6 +162,138 @@ namespace GUILib
 		MOUSE_BUTTON_MIDDLE
 	};
 
+	/**
+	* @brief An enumeration representing the modifier keys held down when a key or mouse button event occurred.
+	*/
+	enum class KeyModifier : int { NONE = 0, SHIFT = 1, CONTROL = 2, ALT = 4, SUPER = 8 };
+
+	static inline KeyModifier operator|(KeyModifier left, KeyModifier right)
+	{
+		return (KeyModifier)((int)left | (int)right);
+	}
+
+	static inline bool operator&(KeyModifier left, KeyModifier right)
+	{
+		return ((int)left & (int)right) == (int)right;
+	}
+
+	/**
+	* @brief An enumeration representing the types of input events.
+	*/
+	enum class InputEventType { CHARACTER, KEY_DOWN, KEY_UP, MOUSE_BUTTON_DOWN, MOUSE_BUTTON_UP, MOUSE_MOVED, MOUSE_SCROLLED };
+
+	/**
+	* @brief A struct describing a single input event, only the members relevant to the event's type are assigned.
+	*/
+	struct InputEvent
+	{
+		InputEventType type;
+		double timestamp; // The time (in seconds since the window was created) when the event was received
+
+		uint32_t codepoint; // The unicode value of the inputted character (CHARACTER events)
+		KeyCode key; // The key pressed or released (KEY_DOWN and KEY_UP events)
+		MouseButtonCode button; // The mouse button pressed or released (MOUSE_BUTTON_DOWN and MOUSE_BUTTON_UP events)
+		KeyModifier modifiers; // The modifier keys held down (key and mouse button events)
+
+		glm::vec2 cursorPosition; // The cursor position relative to the window (MOUSE_MOVED events)
+		glm::vec2 scrollOffset; // The offset scrolled by the mouse/touchpad (MOUSE_SCROLLED events)
+	};
+
+	/**
+	* @brief An immutable snapshot of the input state of a frame, built once per frame from the frame's input events.
+	* Reading the snapshot never queries the platform, so components can look up the cursor, key and mouse button states as often as they
+	* need to. Along with whether each key and mouse button is held down, the snapshot records which of them went down or up during the frame.
+	*/
+	class LIB_DECLSPEC InputSnapshot
+	{
+	public:
+		InputSnapshot();
+
+		~InputSnapshot() = default;
+
+		/**
+		* @brief Checks whether or not the specified key is held down.
+		*
+		* @param[in] key - The key to be looked up.
+		* @return TRUE if the key is held down, FALSE otherwise.
+		*/
+		bool IsKeyDown(KeyCode key) const;
+
+		/**
+		* @brief Checks whether or not the specified key went down during this frame.
+		*
+		* @param[in] key - The key to be looked up.
+		* @return TRUE if the key was pressed this frame, FALSE otherwise.
+		*/
+		bool WasKeyPressedThisFrame(KeyCode key) const;
+
+		/**
+		* @brief Checks whether or not the specified key went up during this frame.
+		*
+		* @param[in] key - The key to be looked up.
+		* @return TRUE if the key was released this frame, FALSE otherwise.
+		*/
+		bool WasKeyReleasedThisFrame(KeyCode key) const;
+
+		/**
+		* @brief Checks whether or not the specified mouse button is held down.
+		*
+		* @param[in] button - The mouse button to be looked up.
+		* @return TRUE if the mouse button is held down, FALSE otherwise.
+		*/
+		bool IsMouseButtonDown(MouseButtonCode button) const;
+
+		/**
+		* @brief Checks whether or not the specified mouse button went down during this frame.
+		*
+		* @param[in] button - The mouse button to be looked up.
+		* @return TRUE if the mouse button was pressed this frame, FALSE otherwise.
+		*/
+		bool WasMouseButtonPressedThisFrame(MouseButtonCode button) const;
+
+		/**
+		* @brief Checks whether or not the specified mouse button went up during this frame.
+		*
+		* @param[in] button - The mouse button to be looked up.
+		* @return TRUE if the mouse button was released this frame, FALSE otherwise.
+		*/
+		bool WasMouseButtonReleasedThisFrame(MouseButtonCode button) const;
+
+		/**
+		* @brief Returns the position of the mouse cursor at the end of the frame's input events.
+		* By default, the coordinates are relative to the window, however if you provide a viewport then the cursor position is mapped to the
+		* viewport's coordinates.
+		*
+		* @param[in] viewport - The viewport to map the cursor position to (this is an optional parameter).
+		* @return A 2-dimensional vector representing the position of the cursor.
+		*/
+		glm::vec2 GetCursorPosition(const Viewport* viewport = nullptr) const;
+
+		/**
+		* @brief Maps a position relative to the window (such as the cursor position of a MOUSE_MOVED event) to the viewport's coordinates.
+		*
+		* @param[in] windowPosition - The position relative to the window.
+		* @param[in] viewport - The viewport to map the position to.
+		* @return A 2-dimensional vector representing the position in the viewport's coordinates.
+		*/
+		glm::vec2 MapToViewport(glm::vec2 windowPosition, const Viewport& viewport) const;
+
+		/**
+		* @brief Returns the total offset scrolled using the mouse/touchpad during this frame.
+		* @return A 2 dimensional vector representing the offset scrolled (vertically and/or horizontally) by the mouse/touchpad.
+		*/
+		const glm::vec2& GetScrollOffset() const;
+	private:
+		friend class InputSystem;
+
+		static constexpr size_t KEY_COUNT = (size_t)KeyCode::KEY_LAST;
+		static constexpr size_t MOUSE_BUTTON_COUNT = (size_t)MouseButtonCode::MOUSE_BUTTON_LAST;
+
+		std::bitset<KEY_COUNT> m_keysDown, m_keysPressed, m_keysReleased;
+		std::bitset<MOUSE_BUTTON_COUNT> m_mouseButtonsDown, m_mouseButtonsPressed, m_mouseButtonsReleased;
+		glm::vec2 m_cursorPosition, m_windowSize, m_scrollOffset;
+	};
+
 	class LIB_DECLSPEC InputSystem
 	{
 	public:
@@ -173,7 +308,16 @@ namespace GUILib
 		void InitGLFWImpl(GLFWwindow* window);
 
 		/**
-		* @brief Checks whether or not the specified key was pressed.
+		* @brief Starts a new input frame, taking every input event received since the previous frame from the input event queue.
+		* Consecutive cursor motion events are merged into the latest one, and consecutive scroll events are summed. The events are then
+		* applied to the input snapshot.
+		* This is automatically called once per loop by the InterfaceFrame::Update() method, so it only needs to be called when input is
+		* read without updating any interface frames.
+		*/
+		void NewFrame();
+
+		/**
+		* @brief Checks whether or not the specified key was pressed, according to the current frame's input snapshot.
 		* 
 		* @param[in] key - The key to be looked up.
 		* @return TRUE if the key pressed, FALSE otherwise.
@@ -181,7 +325,7 @@ namespace GUILib
 		bool WasKeyPressed(KeyCode key) const;
 
 		/**
-		* @brief Checks whether or not the specified mouse button was pressed.
+		* @brief Checks whether or not the specified mouse button was pressed, according to the current frame's input snapshot.
 		*
 		* @param[in] button - The mouse button to be looked up.
 		* @return TRUE if the mouse button pressed, FALSE otherwise.
@@ -189,7 +333,7 @@ namespace GUILib
 		bool WasMouseButtonPressed(MouseButtonCode button) const;
 
 		/**
-		* @brief Retrieves the current position of the mouse cursor.
+		* @brief Retrieves the position of the mouse cursor, according to the current frame's input snapshot.
 		* By default, the retrieved coordinates will be relative to the window, however if you provide a viewport then the cursor position will 
 		* be mapped to the viewport's coordinates.
 		* 
@@ -199,25 +343,66 @@ namespace GUILib
 		glm::vec2 GetCursorPosition(const Viewport* viewport = nullptr) const;
 
 		/**
-		* @brief Retrieves the offset the user scrolled using their mouse/touchpad.
+		* @brief Retrieves the offset the user scrolled using their mouse/touchpad during the current frame, this resets the offset to zero.
 		* @return A 2 dimensional vector representing the offset scrolled (vertically and/or horizontally) by the mouse/touchpad.
 		*/
 		glm::vec2 GetScrollOffset() const;
 
 		/**
-		* @brief Returns the unicode value of the next pending inputted text character.
+		* @brief Returns the unicode value of the next pending inputted text character of the current frame.
+		* Every character inputted since the previous frame is kept, so this should be called until it returns 0 to read all of them.
+		*
 		* @return Unicode value of the next pending inputted text character, if no characters are pending then 0 is returned.
 		*/
 		uint32_t GetInputtedCharacter() const;
 
+		/**
+		* @brief Returns the input events received during the current frame, in the order they were received.
+		* @return The current frame's input events.
+		*/
+		const std::vector<InputEvent>& GetEvents() const;
+
+		/**
+		* @brief Returns the input snapshot of the current frame.
+		* @return The current frame's input snapshot.
+		*/
+		const InputSnapshot& GetSnapshot() const;
+
+		/**
+		* @brief Returns the index of the current input frame, this is incremented by every NewFrame() call.
+		* @return The current input frame index.
+		*/
+		uint64_t GetFrameIndex() const;
+
+		/**
+		* @brief Checks whether or not any input events have been received since the current input frame started.
+		* @return TRUE if the input event queue holds events which the next NewFrame() call takes, FALSE otherwise.
+		*/
+		bool HasQueuedEvents() const;
+
+		/**
+		* @brief Returns the text currently stored in the system clipboard.
+		* @return The UTF-8 encoded clipboard text, this is empty if the clipboard doesn't contain any text.
+		*/
+		std::string GetClipboardText() const;
+
 		static InputSystem& GetInstance();
 	private:
-		InputSystem() = default;
+		InputSystem();
 
-		int GetGLFWKeyCode(KeyCode key) const;
-		int GetGLFWMouseCode(MouseButtonCode button) const;
+		/**
+		* @brief Updates the input snapshot's held down states and edges with the input event given.
+		*/
+		void ApplyEventToSnapshot(const InputEvent& event);
 	private:
 		GLFWwindow* m_glfwWindow;
+		InputSnapshot m_snapshot;
+
+		// The input events of the current frame, along with the position of the next character event to be returned
+		std::vector<InputEvent> m_events;
+		mutable size_t m_nextCharacterEvent;
+		mutable glm::vec2 m_scrollOffset;
+		uint64_t m_frameIndex;
 	};
 }
 
@@ -0,0 +1,245 @@
+#include <utilities/piece_table.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace GUILib
+{
+	namespace
+	{
+		/**
+		* @brief Appends the positions of every line break in the text given onto the line break index given.
+		*/
+		void IndexLineBreaks(std::string_view text, size_t bufferOffset, std::vector<size_t>& lineBreaks)
+		{
+			const char* position = text.data();
+			const char* end = text.data() + text.size();
+
+			while ((position = (const char*)std::memchr(position, '\n', end - position)) != nullptr)
+			{
+				lineBreaks.emplace_back(bufferOffset + (position - text.data()));
+				position++;
+			}
+		}
+	}
+
+	PieceTable::PieceTable(std::string_view text) :
+		m_length(0), m_lineBreakCount(0)
+	{
+		this->SetText(text);
+	}
+
+	void PieceTable::SetText(std::string_view text)
+	{
+		m_originalBuffer = text;
+		m_addBuffer.clear();
+
+		m_originalLineBreaks.clear();
+		m_addLineBreaks.clear();
+		IndexLineBreaks(m_originalBuffer, 0, m_originalLineBreaks);
+
+		m_pieces.clear();
+		if (!m_originalBuffer.empty())
+			m_pieces.push_back({ BufferType::ORIGINAL, 0, m_originalBuffer.size(), m_originalLineBreaks.size() });
+
+		m_length = m_originalBuffer.size();
+		m_lineBreakCount = m_originalLineBreaks.size();
+	}
+
+	void PieceTable::Insert(size_t offset, std::string_view text)
+	{
+		if (text.empty())
+			return;
+
+		offset = std::min(offset, m_length);
+
+		// Append the text onto the add buffer
+		const size_t addStart = m_addBuffer.size();
+		m_addBuffer.append(text);
+		IndexLineBreaks(text, addStart, m_addLineBreaks);
+
+		const Piece insertedPiece = this->CreatePiece(BufferType::ADD, addStart, text.size());
+		m_length += insertedPiece.length;
+		m_lineBreakCount += insertedPiece.lineBreakCount;
+
+		// When typing, each insertion directly follows the previous one, in which case the previous piece is extended instead
+		const size_t pieceIndex = this->SplitPieceAt(offset);
+		if (pieceIndex > 0)
+		{
+			Piece& previousPiece = m_pieces[pieceIndex - 1];
+			if (previousPiece.buffer == BufferType::ADD && previousPiece.start + previousPiece.length == addStart)
+			{
+				previousPiece.length += insertedPiece.length;
+				previousPiece.lineBreakCount += insertedPiece.lineBreakCount;
+				return;
+			}
+		}
+
+		m_pieces.insert(m_pieces.begin() + pieceIndex, insertedPiece);
+	}
+
+	void PieceTable::Erase(size_t offset, size_t length)
+	{
+		offset = std::min(offset, m_length);
+		length = std::min(length, m_length - offset);
+		if (length == 0)
+			return;
+
+		// Split the pieces at both ends of the range, then remove every piece in between
+		const size_t firstPiece = this->SplitPieceAt(offset);
+		const size_t lastPiece = this->SplitPieceAt(offset + length);
+
+		for (size_t i = firstPiece; i < lastPiece; i++)
+		{
+			m_length -= m_pieces[i].length;
+			m_lineBreakCount -= m_pieces[i].lineBreakCount;
+		}
+
+		m_pieces.erase(m_pieces.begin() + firstPiece, m_pieces.begin() + lastPiece);
+	}
+
+	std::string PieceTable::GetText(size_t offset, size_t length) const
+	{
+		std::string text;
+
+		offset = std::min(offset, m_length);
+		length = std::min(length, m_length - offset);
+		text.reserve(length);
+
+		size_t piecePosition = 0;
+		for (const Piece& piece : m_pieces)
+		{
+			if (length == 0)
+				break;
+
+			// Copy the part of the piece which overlaps the range
+			if (offset < piecePosition + piece.length)
+			{
+				const size_t copyStart = offset - piecePosition;
+				const size_t copyLength = std::min(piece.length - copyStart, length);
+				text.append(this->GetBuffer(piece.buffer), piece.start + copyStart, copyLength);
+
+				offset += copyLength;
+				length -= copyLength;
+			}
+
+			piecePosition += piece.length;
+		}
+
+		return text;
+	}
+
+	std::string PieceTable::GetText() const { return this->GetText(0, m_length); }
+
+	std::string PieceTable::GetLine(size_t line) const
+	{
+		if (line >= this->GetLineCount())
+			return std::string();
+
+		return this->GetText(this->GetLineStart(line), this->GetLineLength(line));
+	}
+
+	size_t PieceTable::GetLineStart(size_t line) const
+	{
+		if (line == 0)
+			return 0;
+		if (line > m_lineBreakCount)
+			return m_length;
+
+		// Skip over the pieces before the piece containing the line break ending the previous line
+		size_t lineBreaksRemaining = line, piecePosition = 0;
+		for (const Piece& piece : m_pieces)
+		{
+			if (lineBreaksRemaining <= piece.lineBreakCount)
+			{
+				const size_t lineBreak = this->GetLineBreaks(piece.buffer)[this->FindLineBreak(piece.buffer, piece.start) + lineBreaksRemaining - 1];
+				return piecePosition + (lineBreak - piece.start) + 1;
+			}
+
+			lineBreaksRemaining -= piece.lineBreakCount;
+			piecePosition += piece.length;
+		}
+
+		return m_length;
+	}
+
+	size_t PieceTable::GetLineLength(size_t line) const
+	{
+		const size_t lineStart = this->GetLineStart(line);
+		const size_t lineEnd = line < m_lineBreakCount ? this->GetLineStart(line + 1) - 1 : m_length;
+		return lineEnd - lineStart;
+	}
+
+	size_t PieceTable::GetLineFromOffset(size_t offset) const
+	{
+		offset = std::min(offset, m_length);
+
+		// Count the line breaks before the offset
+		size_t line = 0, piecePosition = 0;
+		for (const Piece& piece : m_pieces)
+		{
+			if (offset < piecePosition + piece.length)
+			{
+				const size_t firstLineBreak = this->FindLineBreak(piece.buffer, piece.start);
+				return line + (this->FindLineBreak(piece.buffer, piece.start + (offset - piecePosition)) - firstLineBreak);
+			}
+
+			line += piece.lineBreakCount;
+			piecePosition += piece.length;
+		}
+
+		return line;
+	}
+
+	size_t PieceTable::GetLineCount() const { return m_lineBreakCount + 1; }
+
+	size_t PieceTable::GetLength() const { return m_length; }
+
+	PieceTable::Piece PieceTable::CreatePiece(BufferType buffer, size_t start, size_t length) const
+	{
+		const size_t lineBreakCount = this->FindLineBreak(buffer, start + length) - this->FindLineBreak(buffer, start);
+		return { buffer, start, length, lineBreakCount };
+	}
+
+	size_t PieceTable::SplitPieceAt(size_t offset)
+	{
+		size_t piecePosition = 0;
+		for (size_t i = 0; i < m_pieces.size(); i++)
+		{
+			if (offset == piecePosition)
+				return i;
+
+			const Piece piece = m_pieces[i];
+			if (offset < piecePosition + piece.length)
+			{
+				// Split the piece into two pieces, the second one starting at the offset
+				const size_t splitLength = offset - piecePosition;
+				m_pieces[i] = this->CreatePiece(piece.buffer, piece.start, splitLength);
+				m_pieces.insert(m_pieces.begin() + i + 1,
+					this->CreatePiece(piece.buffer, piece.start + splitLength, piece.length - splitLength));
+
+				return i + 1;
+			}
+
+			piecePosition += piece.length;
+		}
+
+		return m_pieces.size();
+	}
+
+	size_t PieceTable::FindLineBreak(BufferType buffer, size_t position) const
+	{
+		const std::vector<size_t>& lineBreaks = this->GetLineBreaks(buffer);
+		return std::lower_bound(lineBreaks.begin(), lineBreaks.end(), position) - lineBreaks.begin();
+	}
+
+	const std::string& PieceTable::GetBuffer(BufferType buffer) const
+	{
+		return buffer == BufferType::ORIGINAL ? m_originalBuffer : m_addBuffer;
+	}
+
+	const std::vector<size_t>& PieceTable::GetLineBreaks(BufferType buffer) const
+	{
+		return buffer == BufferType::ORIGINAL ? m_originalLineBreaks : m_addLineBreaks;
+	}
+}
\ No newline at end of file
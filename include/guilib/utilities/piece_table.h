@@ -0,0 +1,151 @@
+#ifndef PIECE_TABLE_H
+#define PIECE_TABLE_H
+
+#include <utilities/libexport.h>
+#include <string_view>
+#include <string>
+#include <vector>
+
+namespace GUILib
+{
+	/**
+	* @brief This is a class for storing large, editable documents of text.
+	* The text is never moved once stored, instead the document is described by a list of pieces, each referring to a span of either the
+	* original text or an append-only buffer of inserted text. Inserting or erasing text only splits and removes pieces, so editing costs are
+	* proportional to the number of edits rather than the size of the document.
+	*
+	* The positions of the line breaks in both buffers are indexed, and each piece keeps a count of the line breaks it spans, so that lines
+	* can be looked up without scanning the text.
+	*/
+	class LIB_DECLSPEC PieceTable
+	{
+	public:
+		/**
+		* @brief This is a class constructor that sets up the document with the text given.
+		* @param[in] text - The initial text of the document.
+		*/
+		PieceTable(std::string_view text = "");
+
+		~PieceTable() = default;
+
+		/**
+		* @brief Replaces the whole document with the text given, discarding every edit made.
+		* @param[in] text - The new text of the document.
+		*/
+		void SetText(std::string_view text);
+
+		/**
+		* @brief Inserts the text given into the document.
+		*
+		* @param[in] offset - The byte offset where the text is inserted (clamped to the length of the document).
+		* @param[in] text - The text to be inserted.
+		*/
+		void Insert(size_t offset, std::string_view text);
+
+		/**
+		* @brief Erases a range of text from the document.
+		*
+		* @param[in] offset - The byte offset of the start of the range.
+		* @param[in] length - The length (in bytes) of the range, the range is clamped to the end of the document.
+		*/
+		void Erase(size_t offset, size_t length);
+
+		/**
+		* @brief Returns a range of text from the document.
+		*
+		* @param[in] offset - The byte offset of the start of the range.
+		* @param[in] length - The length (in bytes) of the range, the range is clamped to the end of the document.
+		* @return The text within the range.
+		*/
+		std::string GetText(size_t offset, size_t length) const;
+
+		/**
+		* @brief Returns the whole text of the document.
+		* @return The document's text.
+		*/
+		std::string GetText() const;
+
+		/**
+		* @brief Returns the text of the specified line, excluding the line break.
+		* @param[in] line - The index of the line.
+		* @return The line's text, this is empty if the line doesn't exist.
+		*/
+		std::string GetLine(size_t line) const;
+
+		/**
+		* @brief Returns the byte offset of the start of the specified line.
+		* @param[in] line - The index of the line.
+		* @return The offset of the line, or the length of the document if the line doesn't exist.
+		*/
+		size_t GetLineStart(size_t line) const;
+
+		/**
+		* @brief Returns the length of the specified line, excluding the line break.
+		* @param[in] line - The index of the line.
+		* @return The length (in bytes) of the line.
+		*/
+		size_t GetLineLength(size_t line) const;
+
+		/**
+		* @brief Returns the index of the line containing the byte offset given.
+		* @param[in] offset - The byte offset within the document.
+		* @return The index of the line.
+		*/
+		size_t GetLineFromOffset(size_t offset) const;
+
+		/**
+		* @brief Returns the number of lines in the document, this is always at least one.
+		* @return The line count.
+		*/
+		size_t GetLineCount() const;
+
+		/**
+		* @brief Returns the length of the document.
+		* @return The length (in bytes) of the document.
+		*/
+		size_t GetLength() const;
+	private:
+		/**
+		* @brief An enumeration specifying the buffer which a piece refers to.
+		*/
+		enum class BufferType { ORIGINAL, ADD };
+
+		/**
+		* @brief A struct describing a span of text within one of the buffers.
+		*/
+		struct Piece
+		{
+			BufferType buffer;
+			size_t start, length;
+			size_t lineBreakCount; // The number of line breaks within the span
+		};
+
+		/**
+		* @brief Creates a piece referring to the span of the buffer given, counting the line breaks within it.
+		*/
+		Piece CreatePiece(BufferType buffer, size_t start, size_t length) const;
+
+		/**
+		* @brief Makes sure that a piece starts at the byte offset given, splitting the piece containing the offset if required.
+		* @param[in] offset - The byte offset within the document.
+		* @return The index of the piece starting at the offset, or the number of pieces if the offset is the end of the document.
+		*/
+		size_t SplitPieceAt(size_t offset);
+
+		/**
+		* @brief Returns the index of the first line break at or after the buffer position given, within the buffer's line break index.
+		*/
+		size_t FindLineBreak(BufferType buffer, size_t position) const;
+
+		const std::string& GetBuffer(BufferType buffer) const;
+		const std::vector<size_t>& GetLineBreaks(BufferType buffer) const;
+	private:
+		std::string m_originalBuffer, m_addBuffer;
+		std::vector<size_t> m_originalLineBreaks, m_addLineBreaks; // The sorted positions of every line break in each buffer
+
+		std::vector<Piece> m_pieces;
+		size_t m_length, m_lineBreakCount;
+	};
+}
+
+#endif
\ No newline at end of file
@@ -1,27 +1,63 @@
 #include <utilities/resource_loader.h>
+#include <utilities/disk_cache.h>
 
 #include <external/stb/stb_image.h>
 #include <external/freetype/include/ft2build.h>
 #include <external/freetype/include/freetype/freetype.h>
 #include <external/freetype/include/freetype/ftmm.h>
+#include <external/freetype/include/freetype/ftmodapi.h>
 
 #include <fstream>
 #include <sstream>
+#include <iterator>
+#include <cstring>
+#include <algorithm>
+#include <memory>
 
 namespace GUILib
 {
+	namespace
+	{
+		/**
+		* @brief The header written at the start of every cached font entry.
+		*/
+		struct FontCacheHeader
+		{
+			static constexpr uint32_t magicValue = 0x43464C47; // "GLFC"
+			static constexpr uint32_t currentFormatVersion = 3;
+
+			uint32_t magic = magicValue;
+			uint32_t formatVersion = currentFormatVersion;
+			uint32_t glyphCount = 0;
+
+			// The metrics of the font face, so that a font loaded from the cache doesn't have to load its font face for them
+			int32_t lineHeight = 0, ascender = 0;
+			uint32_t hasKerning = 0;
+		};
+
+		/**
+		* @brief The serialized form of a glyph's metrics in a cached font entry.
+		*/
+		struct FontCacheGlyphRecord
+		{
+			uint32_t codepoint = 0;
+			int32_t size[2] = {}, bearing[2] = {}, advance[2] = {};
+		};
+	}
+
 	ResourceLoader::ResourceLoader() :
 		m_freetypeLib(nullptr)
 	{
 		// Initialize the FreeType library
 		this->CheckFTFunctionResult(FT_Init_FreeType(&m_freetypeLib));
+
+		// Set the distance field falloff used for signed distance field fonts, this has to match the glyph padding expected by the fonts
+		const FT_Int sdfSpread = ResourceConstants::fontSDFSpread;
+		FT_Property_Set(m_freetypeLib, "sdf", "spread", &sdfSpread);
 	}
 
 	void ResourceLoader::FreeResources()
 	{
-		// Clean up FreeType library
-		this->CheckFTFunctionResult(FT_Done_FreeType(m_freetypeLib));
-
 		// Free all shader resources
 		for (auto& shader : m_loadedShaders)
 		{
@@ -43,6 +79,9 @@ namespace GUILib
 				delete font.second;
 		}
 
+		// Clean up FreeType library, this has to be done after freeing the fonts since they hold onto FreeType font faces
+		this->CheckFTFunctionResult(FT_Done_FreeType(m_freetypeLib));
+
 		// Free all geometry resources
 		for (auto& geometry : m_storedGeometry)
 		{
@@ -140,63 +179,139 @@ namespace GUILib
 		return buffer;
 	}
 
-	void ResourceLoader::LoadFontFromFile(std::string_view id, std::string_view filepath)
+	void ResourceLoader::LoadFontFromFile(std::string_view id, std::string_view filepath, FontRenderMode renderMode)
 	{
 		// Make sure a font with the specified ID doesn't exist already
 		if (m_loadedFonts.find(id.data()) != m_loadedFonts.end())
 			return;
 
-		// Load the font face from file, throw exception if font face loading operation failed
-		FT_Face fontFace = nullptr;
-		this->CheckFTFunctionResult(FT_New_Face(m_freetypeLib, filepath.data(), 0, &fontFace));
-		this->CheckFTFunctionResult(FT_Set_Pixel_Sizes(fontFace, 0, 64));
+		// Read the font file into memory, its contents are used for both keying the font cache and loading the font face
+		std::ifstream fontFileStream(filepath.data(), std::ios::binary);
+		if (fontFileStream.fail())
+			throw std::exception((std::string("Failed to open the font file at path: ") + filepath.data()).c_str());
+
+		std::vector<uint8_t> fontFileData((std::istreambuf_iterator<char>(fontFileStream)), std::istreambuf_iterator<char>());
 
-		// Firstly load the glyph metrics of each ascii character
-		// These metrics will also be used to calculate how much memory to allocate for the texture buffer 
-		uint32_t textureAtlasWidth = 0, textureAtlasHeight = 0;
-		std::unordered_map<char, Font::GlyphMetrics> glyphMetricsSet;
+		// The cached glyphs depend on the contents of the font file, the glyph pixel size, the render mode and the library version
+		uint64_t cacheKey = DiskCache::HashBytes(fontFileData.data(), fontFileData.size());
+		cacheKey = DiskCache::HashBytes(&ResourceConstants::fontGlyphPixelSize, sizeof(ResourceConstants::fontGlyphPixelSize), cacheKey);
+		cacheKey = DiskCache::HashBytes(&renderMode, sizeof(renderMode), cacheKey);
+		cacheKey = DiskCache::HashBytes(&ResourceConstants::fontSDFSpread, sizeof(ResourceConstants::fontSDFSpread), cacheKey);
+		cacheKey = DiskCache::HashBytes(GUILIB_VERSION, sizeof(GUILIB_VERSION) - 1, cacheKey);
 
-		for (char asciiCode = 32; asciiCode < 127; asciiCode++)
+		// The font keeps the file's memory alive and only loads the font face from it once a glyph isn't in the cache (or on other first
+		// uses of the face), every pixel size the font is rasterized at shares that one face
+		std::unique_ptr<Font> font = std::make_unique<Font>(m_freetypeLib, std::move(fontFileData), renderMode);
+
+		// Preload the ascii glyphs from the cache if possible, otherwise rasterize them now and store the result in the cache
+		if (!this->LoadCachedGlyphs(cacheKey, *font))
 		{
-			this->CheckFTFunctionResult(FT_Load_Char(fontFace, asciiCode, FT_LOAD_BITMAP_METRICS_ONLY));
+			for (uint32_t asciiCode = 32; asciiCode < 127; asciiCode++)
+				font->GetGlyph(asciiCode);
 
-			// Store the glyph metrics of the ascii character
-			Font::GlyphMetrics metrics;
-			metrics.bearing = { fontFace->glyph->bitmap_left, fontFace->glyph->bitmap_top };
-			metrics.size = { fontFace->glyph->bitmap.width, fontFace->glyph->bitmap.rows };
-			metrics.advance = { (fontFace->glyph->advance.x >> 6), (fontFace->glyph->advance.y >> 6) };
-			metrics.atlasOffsetX = textureAtlasWidth;
-
-			glyphMetricsSet[asciiCode] = metrics;
-
-			// Update the texture atlas width and height counter variables
-			constexpr uint32_t glyphAtlasSpacing = 10;
-			textureAtlasWidth += ((uint32_t)metrics.size.x + glyphAtlasSpacing);
-			if (textureAtlasHeight < (uint32_t)metrics.size.y)
-				textureAtlasHeight = (uint32_t)metrics.size.y;
+			this->StoreCachedGlyphs(cacheKey, *font);
 		}
 
-		// Initialize the texture atlas buffer
-		TextureBuffer2D* textureAtlas = new TextureBuffer2D(GL_RED, textureAtlasWidth, textureAtlasHeight, GL_RED, GL_UNSIGNED_BYTE, 
-			nullptr, false);
+		// Add the loaded font to the unordered map
+		m_loadedFonts.insert({ id.data(), font.release() });
+	}
+
+	bool ResourceLoader::LoadCachedGlyphs(uint64_t cacheKey, const Font& font) const
+	{
+		std::vector<uint8_t> cacheData;
+		if (!DiskCache::GetInstance().Load("font", cacheKey, cacheData) || cacheData.size() < sizeof(FontCacheHeader))
+			return false;
+
+		// Validate the cache header, the cached entry is ignored if it doesn't match the expected format
+		FontCacheHeader header;
+		std::memcpy(&header, cacheData.data(), sizeof(FontCacheHeader));
+
+		const size_t recordsSize = sizeof(FontCacheHeader) + (header.glyphCount * sizeof(FontCacheGlyphRecord));
+		if (header.magic != FontCacheHeader::magicValue || header.formatVersion != FontCacheHeader::currentFormatVersion ||
+			cacheData.size() < recordsSize)
+			return false;
+
+		// Make sure the bitmaps of every record are present before adding any of the glyphs
+		size_t expectedSize = recordsSize;
+		for (uint32_t i = 0; i < header.glyphCount; i++)
+		{
+			FontCacheGlyphRecord record;
+			std::memcpy(&record, cacheData.data() + sizeof(FontCacheHeader) + (i * sizeof(FontCacheGlyphRecord)), sizeof(FontCacheGlyphRecord));
+			expectedSize += (size_t)std::max(record.size[0], 0) * std::max(record.size[1], 0);
+		}
 
-		glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // Disregard unpack byte-alignment
+		if (cacheData.size() != expectedSize)
+			return false;
 
-		// Generate bitmap for each glyph, and insert the bitmap pixel data into the texture buffer
-		textureAtlas->Bind();
-		for (char asciiCode = 32; asciiCode < 127; asciiCode++)
+		// Read the glyph metric records, each glyph's bitmap follows on from the previous glyph's bitmap
+		const uint8_t* bitmapPosition = cacheData.data() + recordsSize;
+		for (uint32_t i = 0; i < header.glyphCount; i++)
 		{
-			this->CheckFTFunctionResult(FT_Load_Char(fontFace, asciiCode, FT_LOAD_RENDER));
-			const Font::GlyphMetrics& metrics = glyphMetricsSet[asciiCode];
-			textureAtlas->Update(metrics.atlasOffsetX, 0, (uint32_t)metrics.size.x, (uint32_t)metrics.size.y, GL_RED,
-				GL_UNSIGNED_BYTE, fontFace->glyph->bitmap.buffer);
+			FontCacheGlyphRecord record;
+			std::memcpy(&record, cacheData.data() + sizeof(FontCacheHeader) + (i * sizeof(FontCacheGlyphRecord)), sizeof(FontCacheGlyphRecord));
+
+			Font::GlyphMetrics metrics;
+			metrics.size = glm::i16vec2(std::max(record.size[0], 0), std::max(record.size[1], 0));
+			metrics.bearing = glm::i16vec2(record.bearing[0], record.bearing[1]);
+			metrics.advance = (int16_t)record.advance[0];
+
+			font.AddGlyph(record.codepoint, metrics, bitmapPosition);
+			bitmapPosition += (size_t)metrics.size.x * metrics.size.y;
 		}
 
-		textureAtlas->SetWrapMode(GL_CLAMP_TO_BORDER, GL_CLAMP_TO_BORDER);
-		FT_Done_Face(fontFace); // Free the allocated freetype face 
+		Font::FaceMetrics faceMetrics;
+		faceMetrics.lineHeight = header.lineHeight;
+		faceMetrics.ascender = header.ascender;
+		faceMetrics.hasKerning = header.hasKerning != 0;
+		font.SetFaceMetrics(faceMetrics);
+		return true;
+	}
 
-		// Add the loaded font to the unordered map
-		m_loadedFonts.insert({ id.data(), new Font(textureAtlas, glyphMetricsSet) });
+	void ResourceLoader::StoreCachedGlyphs(uint64_t cacheKey, const Font& font) const
+	{
+		if (!DiskCache::GetInstance().IsEnabled())
+			return;
+
+		// Serialize the header, followed by the glyph metric records and then the glyph bitmaps
+		FontCacheHeader header;
+		const std::vector<uint32_t> codepoints = font.GetGlyphCodepoints();
+		header.glyphCount = (uint32_t)codepoints.size();
+
+		const Font::FaceMetrics faceMetrics = font.GetFaceMetrics();
+		header.lineHeight = faceMetrics.lineHeight;
+		header.ascender = faceMetrics.ascender;
+		header.hasKerning = faceMetrics.hasKerning ? 1 : 0;
+
+		std::vector<uint8_t> cacheData(sizeof(FontCacheHeader) + (header.glyphCount * sizeof(FontCacheGlyphRecord)));
+		std::memcpy(cacheData.data(), &header, sizeof(FontCacheHeader));
+
+		uint8_t* recordPosition = cacheData.data() + sizeof(FontCacheHeader);
+		std::vector<uint8_t> glyphBitmap;
+
+		for (const uint32_t codepoint : codepoints)
+		{
+			const Font::GlyphMetrics& glyph = font.GetGlyph(codepoint);
+
+			FontCacheGlyphRecord record;
+			record.codepoint = codepoint;
+			record.size[0] = glyph.size.x;
+			record.size[1] = glyph.size.y;
+			record.bearing[0] = glyph.bearing.x;
+			record.bearing[1] = glyph.bearing.y;
+			record.advance[0] = glyph.advance;
+			record.advance[1] = 0;
+
+			std::memcpy(recordPosition, &record, sizeof(FontCacheGlyphRecord));
+			recordPosition += sizeof(FontCacheGlyphRecord);
+
+			// Append the glyph's bitmap, which is copied back out of the font's texture atlas
+			font.GetGlyphBitmap(codepoint, glyphBitmap);
+			const size_t recordOffset = recordPosition - cacheData.data();
+			cacheData.insert(cacheData.end(), glyphBitmap.begin(), glyphBitmap.end());
+			recordPosition = cacheData.data() + recordOffset;
+		}
+
+		DiskCache::GetInstance().Store("font", cacheKey, cacheData.data(), cacheData.size());
 	}
 
 	void ResourceLoader::AddGeometry(std::string_view id, Geometry& geometry)
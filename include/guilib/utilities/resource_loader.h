@@ -84,11 +84,15 @@ namespace GUILib
 		* @brief Loads the font stored at the file path specified, the resulting loaded font will be stored by the resource loader.
 		* If an error occurs while loading the font, an exception will be thrown with an error log message.
 		* If a loaded font already exists with the given ID, then the given font will not be loaded and stored.
+		* The ascii glyphs are rasterized up front at the default pixel size and stored in the disk cache (see @ref GUILib::DiskCache), so loading
+		* the same font file again on later launches skips their rasterization entirely (the font face isn't even loaded until a glyph that
+		* isn't in the cache is used). Any other glyphs or pixel sizes are rasterized on first use.
 		*
 		* @param[in] id - The ID to be assigned to the newly added texture.
 		* @param[in] filepath - The file path of the font file to be loaded.
+		* @param[in] renderMode - Specifies how the glyphs of the font are rasterized (see @ref GUILib::FontRenderMode).
 		*/
-		void LoadFontFromFile(std::string_view id, std::string_view filepath);
+		void LoadFontFromFile(std::string_view id, std::string_view filepath, FontRenderMode renderMode = FontRenderMode::BITMAP);
 
 		/**
 		* @brief The resource loader stores the geometry object given.
@@ -148,6 +152,23 @@ namespace GUILib
 		* @param[in] resultCode - The code returned from the freetype function.
 		*/
 		void CheckFTFunctionResult(FT_Error resultCode) const;
+
+		/**
+		* @brief Adds the glyphs stored in the disk cache under the key given to the font.
+		* 
+		* @param[in] cacheKey - The key of the cached glyphs.
+		* @param[in] font - The font to add the cached glyphs to.
+		* @return TRUE if the cached glyphs were added, FALSE if the glyphs aren't cached or the cached entry is invalid.
+		*/
+		bool LoadCachedGlyphs(uint64_t cacheKey, const Font& font) const;
+
+		/**
+		* @brief Stores every glyph currently rasterized in the font given in the disk cache.
+		* 
+		* @param[in] cacheKey - The key which the glyphs will be stored under.
+		* @param[in] font - The font whose glyphs are to be stored.
+		*/
+		void StoreCachedGlyphs(uint64_t cacheKey, const Font& font) const;
 	private:
 		std::unordered_map<std::string, ShaderProgram*> m_loadedShaders;
 		std::unordered_map<std::string, TextureBuffer2D*> m_loadedTextures;
@@ -192,6 +213,21 @@ namespace GUILib
 
 		static constexpr float circleGeoemtryAngleStep = 2.0f;
 
+		static constexpr float pointerDragThreshold = 4.0f; // The distance (in pixels) which a pressed pointer moves before it starts dragging
+		static constexpr float pointerLongPressDuration = 0.5f;
+		static constexpr double pointerDoubleClickInterval = 0.4;
+
+		static constexpr uint32_t fontGlyphPixelSize = 64;
+		static constexpr uint32_t fontSizeBuckets[] = { 12, 16, 24, 32, 48, 64 };
+		static constexpr uint32_t fontGlyphAtlasSpacing = 2;
+		static constexpr uint32_t fontAtlasInitialPageSize = 256;
+		static constexpr uint32_t fontAtlasMaxPageSize = 2048;
+		static constexpr uint32_t fontAtlasMaxPages = 4;
+		static constexpr float fontAtlasEvictionFraction = 0.25f; // The fraction of a full atlas's glyphs evicted to make room for new glyphs
+		static constexpr size_t fontAtlasMemoryBudget = 16 * 1024 * 1024;
+		static constexpr size_t textLayoutCacheCapacity = 1024;
+		static constexpr int fontSDFSpread = 8;
+
 		static constexpr char* geometryVshSrc =
 		{
 			"#version 330 core\n"
@@ -215,17 +251,46 @@ namespace GUILib
 			"uniform sampler2D textureSampler;\n"
 			"uniform bool useTextures;\n"
 			"uniform bool enableColorMod;\n"
+			"uniform float time;\n"
+			"uniform bool useColorAnimation;\n"
+			"uniform vec4 animStartColor;\n"
+			"uniform vec4 animEndColor;\n"
+			"uniform float animStartTime;\n"
+			"uniform float animDuration;\n"
+			"uniform int animEasing;\n"
+			"uniform int animRepeat;\n"
+			"float Ease(float progress)\n"
+			"{\n"
+			"float inverse = 1.0f - progress;\n"
+			"if (animEasing == 1) return progress * progress;\n"
+			"if (animEasing == 2) return 1.0f - (inverse * inverse);\n"
+			"if (animEasing == 3) return progress < 0.5f ? 2.0f * progress * progress : 1.0f - (2.0f * inverse * inverse);\n"
+			"if (animEasing == 4) return 1.0f - (inverse * inverse * inverse);\n"
+			"return progress;\n"
+			"}\n"
+			"vec4 GetAnimatedColor()\n"
+			"{\n"
+			"float progress = animDuration > 0.0f ? max(time - animStartTime, 0.0f) / animDuration : 1.0f;\n"
+			"if (animRepeat == 1)\n"
+			"progress = fract(progress);\n"
+			"else if (animRepeat == 2)\n"
+			"progress = 1.0f - abs(mod(progress, 2.0f) - 1.0f);\n"
+			"else\n"
+			"progress = min(progress, 1.0f);\n"
+			"return mix(animStartColor, animEndColor, Ease(progress));\n"
+			"}\n"
 			"void main()\n"
 			"{\n"
+			"vec4 baseColor = useColorAnimation ? GetAnimatedColor() : color;\n"
 			"vec4 fragColor = vec4(1.0f);\n"
 			"if (useTextures)\n"
 			"{\n"
 			"fragColor = texture(textureSampler, uvOut);\n"
 			"if (enableColorMod)\n"
-			"fragColor *= color;\n"
+			"fragColor *= baseColor;\n"
 			"}\n"
 			"else\n"
-			"fragColor = color;\n"
+			"fragColor = baseColor;\n"
 			"gl_FragColor = fragColor;\n"
 			"}\n"
 		};
@@ -242,6 +307,21 @@ namespace GUILib
 			"gl_FragColor = texelSample * textColor;\n"
 			"}\n"
 		};
+
+		static constexpr char* textRenderSDFFshSrc =
+		{
+			"#version 330 core\n"
+			"in vec2 uvOut;\n"
+			"uniform sampler2D fontAtlasSampler;\n"
+			"uniform vec4 textColor;\n"
+			"void main()\n"
+			"{\n"
+			"float distance = texture(fontAtlasSampler, uvOut).r;\n"
+			"float edgeWidth = max(fwidth(distance), 0.0001f);\n"
+			"float coverage = smoothstep(0.5f - edgeWidth, 0.5f + edgeWidth, distance);\n"
+			"gl_FragColor = vec4(textColor.rgb, textColor.a * coverage);\n"
+			"}\n"
+		};
 	}
 }
 
@@ -0,0 +1,255 @@
+#include <utilities/spatial_index.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace GUILib
+{
+	namespace
+	{
+		// Entries overlapping more cells than this are kept in the oversized entry list rather than being recorded in every cell
+		constexpr int MAX_ENTRY_CELL_COUNT = 256;
+
+		/**
+		* @brief Checks whether or not the point given is within the bounds given (inclusive of the edges).
+		*/
+		bool ContainsPoint(glm::vec2 min, glm::vec2 max, glm::vec2 point)
+		{
+			return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y;
+		}
+	}
+
+	SpatialIndex::SpatialIndex(float cellSize) :
+		m_cellSize(std::max(cellSize, 1.0f)), m_nextOrder(0), m_cachedPoint({ 0.0f, 0.0f }), m_cachedTopmost(nullptr), m_isCacheValid(false),
+		m_queryStamp(0)
+	{}
+
+	size_t SpatialIndex::Insert(Component* component, glm::vec2 min, glm::vec2 max)
+	{
+		size_t entry = m_entries.size();
+		if (!m_freeEntries.empty())
+		{
+			entry = m_freeEntries.back();
+			m_freeEntries.pop_back();
+		}
+		else
+		{
+			m_entries.emplace_back();
+			m_entryQueryStamps.emplace_back(0);
+		}
+
+		m_entries[entry] = { component, min, max, this->GetCell(min), this->GetCell(max), m_nextOrder++, true, false };
+		this->AddToCells(entry);
+
+		m_isCacheValid = false;
+		return entry;
+	}
+
+	void SpatialIndex::Update(size_t entry, glm::vec2 min, glm::vec2 max)
+	{
+		if (entry >= m_entries.size() || !m_entries[entry].component)
+			return;
+
+		Entry& updatedEntry = m_entries[entry];
+		if (updatedEntry.min == min && updatedEntry.max == max)
+			return;
+
+		updatedEntry.min = min;
+		updatedEntry.max = max;
+		m_isCacheValid = false;
+
+		// The cells only have to be changed if the bounds have moved into a different range of cells
+		const glm::ivec2 firstCell = this->GetCell(min), lastCell = this->GetCell(max);
+		if (firstCell == updatedEntry.firstCell && lastCell == updatedEntry.lastCell)
+			return;
+
+		this->RemoveFromCells(entry);
+		updatedEntry.firstCell = firstCell;
+		updatedEntry.lastCell = lastCell;
+		this->AddToCells(entry);
+	}
+
+	void SpatialIndex::SetActive(size_t entry, bool active)
+	{
+		if (entry >= m_entries.size() || !m_entries[entry].component)
+			return;
+
+		m_entries[entry].active = active;
+		m_isCacheValid = false;
+	}
+
+	void SpatialIndex::SetOrder(size_t entry, uint64_t order)
+	{
+		if (entry >= m_entries.size() || !m_entries[entry].component)
+			return;
+
+		m_entries[entry].order = order;
+		m_isCacheValid = false;
+	}
+
+	void SpatialIndex::Remove(size_t entry)
+	{
+		if (entry >= m_entries.size() || !m_entries[entry].component)
+			return;
+
+		this->RemoveFromCells(entry);
+		m_entries[entry].component = nullptr;
+		m_freeEntries.emplace_back(entry);
+
+		m_isCacheValid = false;
+	}
+
+	void SpatialIndex::Clear()
+	{
+		m_entries.clear();
+		m_freeEntries.clear();
+		m_cells.clear();
+		m_oversizedEntries.clear();
+		m_entryQueryStamps.clear();
+		m_isCacheValid = false;
+	}
+
+	Component* SpatialIndex::QueryTopmost(glm::vec2 point) const
+	{
+		if (m_isCacheValid && m_cachedPoint == point)
+			return m_cachedTopmost;
+
+		const Entry* topmostEntry = nullptr;
+		const auto TestEntry = [&](size_t entry)
+		{
+			const Entry& testedEntry = m_entries[entry];
+			if (testedEntry.active && ContainsPoint(testedEntry.min, testedEntry.max, point) &&
+				(!topmostEntry || testedEntry.order > topmostEntry->order))
+				topmostEntry = &testedEntry;
+		};
+
+		// Only the entries recorded in the cell containing the point can contain the point
+		const glm::ivec2 cell = this->GetCell(point);
+		auto iterator = m_cells.find(GetCellKey(cell.x, cell.y));
+		if (iterator != m_cells.end())
+		{
+			for (size_t entry : iterator->second)
+				TestEntry(entry);
+		}
+
+		for (size_t entry : m_oversizedEntries)
+			TestEntry(entry);
+
+		m_cachedPoint = point;
+		m_cachedTopmost = topmostEntry ? topmostEntry->component : nullptr;
+		m_isCacheValid = true;
+		return m_cachedTopmost;
+	}
+
+	void SpatialIndex::QueryRegion(glm::vec2 min, glm::vec2 max, std::vector<Component*>& components) const
+	{
+		// Each entry can be recorded in several of the cells within the region, so entries are stamped when first found
+		m_queryStamp++;
+		std::vector<const Entry*> foundEntries;
+		const auto TestEntry = [&](size_t entry)
+		{
+			const Entry& testedEntry = m_entries[entry];
+			if (m_entryQueryStamps[entry] == m_queryStamp || !testedEntry.active)
+				return;
+
+			m_entryQueryStamps[entry] = m_queryStamp;
+			if (testedEntry.min.x <= max.x && testedEntry.max.x >= min.x && testedEntry.min.y <= max.y && testedEntry.max.y >= min.y)
+				foundEntries.emplace_back(&testedEntry);
+		};
+
+		const glm::ivec2 firstCell = this->GetCell(min), lastCell = this->GetCell(max);
+		if ((int64_t)(lastCell.x - firstCell.x + 1) * (lastCell.y - firstCell.y + 1) > (int64_t)m_cells.size())
+		{
+			// The region covers more cells than are occupied, so visit the occupied cells instead
+			for (const auto& cellPair : m_cells)
+			{
+				for (size_t entry : cellPair.second)
+					TestEntry(entry);
+			}
+		}
+		else
+		{
+			for (int cellY = firstCell.y; cellY <= lastCell.y; cellY++)
+			{
+				for (int cellX = firstCell.x; cellX <= lastCell.x; cellX++)
+				{
+					auto iterator = m_cells.find(GetCellKey(cellX, cellY));
+					if (iterator == m_cells.end())
+						continue;
+
+					for (size_t entry : iterator->second)
+						TestEntry(entry);
+				}
+			}
+		}
+
+		for (size_t entry : m_oversizedEntries)
+			TestEntry(entry);
+
+		std::sort(foundEntries.begin(), foundEntries.end(), [](const Entry* left, const Entry* right) { return left->order < right->order; });
+		for (const Entry* foundEntry : foundEntries)
+			components.emplace_back(foundEntry->component);
+	}
+
+	glm::ivec2 SpatialIndex::GetCell(glm::vec2 point) const
+	{
+		return { (int)std::floor(point.x / m_cellSize), (int)std::floor(point.y / m_cellSize) };
+	}
+
+	uint64_t SpatialIndex::GetCellKey(int cellX, int cellY)
+	{
+		return ((uint64_t)(uint32_t)cellX << 32) | (uint64_t)(uint32_t)cellY;
+	}
+
+	void SpatialIndex::AddToCells(size_t entry)
+	{
+		Entry& addedEntry = m_entries[entry];
+		const int64_t cellCount = (int64_t)(addedEntry.lastCell.x - addedEntry.firstCell.x + 1) *
+			(addedEntry.lastCell.y - addedEntry.firstCell.y + 1);
+
+		addedEntry.oversized = cellCount > MAX_ENTRY_CELL_COUNT;
+		if (addedEntry.oversized)
+		{
+			m_oversizedEntries.emplace_back(entry);
+			return;
+		}
+
+		for (int cellY = addedEntry.firstCell.y; cellY <= addedEntry.lastCell.y; cellY++)
+		{
+			for (int cellX = addedEntry.firstCell.x; cellX <= addedEntry.lastCell.x; cellX++)
+				m_cells[GetCellKey(cellX, cellY)].emplace_back(entry);
+		}
+	}
+
+	void SpatialIndex::RemoveFromCells(size_t entry)
+	{
+		const Entry& removedEntry = m_entries[entry];
+		if (removedEntry.oversized)
+		{
+			m_oversizedEntries.erase(std::find(m_oversizedEntries.begin(), m_oversizedEntries.end(), entry));
+			return;
+		}
+
+		for (int cellY = removedEntry.firstCell.y; cellY <= removedEntry.lastCell.y; cellY++)
+		{
+			for (int cellX = removedEntry.firstCell.x; cellX <= removedEntry.lastCell.x; cellX++)
+			{
+				auto iterator = m_cells.find(GetCellKey(cellX, cellY));
+				if (iterator == m_cells.end())
+					continue;
+
+				// The order of the entries within a cell doesn't matter, so the entry is swapped with the last one and popped
+				std::vector<size_t>& cellEntries = iterator->second;
+				auto entryIterator = std::find(cellEntries.begin(), cellEntries.end(), entry);
+				if (entryIterator != cellEntries.end())
+				{
+					*entryIterator = cellEntries.back();
+					cellEntries.pop_back();
+				}
+
+				if (cellEntries.empty())
+					m_cells.erase(iterator);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+#include <utilities/libexport.h>
+#include <external/glm/glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GUILib
+{
+	class Component;
+
+	/**
+	* @brief This is a class for looking up the components at a point or within a region, without testing every component's bounds.
+	* The space is divided into a uniform grid of square cells, and each component's bounds are recorded in every cell they overlap. A point
+	* query only has to test the components in the single cell containing the point, and moving or resizing a component only touches the
+	* cells it enters or leaves. Components covering a very large number of cells are kept in a separate list which every query tests.
+	*
+	* Each component is also given a stacking order when inserted, components inserted later are above those inserted earlier (unless the
+	* order is changed through SetOrder()).
+	*/
+	class LIB_DECLSPEC SpatialIndex
+	{
+	public:
+		static constexpr size_t INVALID_ENTRY = (size_t)-1;
+
+		/**
+		* @brief This is a class constructor that sets up an empty index.
+		* @param[in] cellSize - The width and height (in pixels) of each grid cell.
+		*/
+		SpatialIndex(float cellSize = 128.0f);
+
+		~SpatialIndex() = default;
+
+		/**
+		* @brief Adds a component to the index, above every component already within the index.
+		*
+		* @param[in] component - The component to be added.
+		* @param[in] min - The top-left corner of the component's bounds.
+		* @param[in] max - The bottom-right corner of the component's bounds.
+		* @return The entry of the component, which is used to update or remove it.
+		*/
+		size_t Insert(Component* component, glm::vec2 min, glm::vec2 max);
+
+		/**
+		* @brief Updates the bounds of the specified entry, only the grid cells entered or left by the bounds are changed.
+		*
+		* @param[in] entry - The entry of the component.
+		* @param[in] min - The new top-left corner of the component's bounds.
+		* @param[in] max - The new bottom-right corner of the component's bounds.
+		*/
+		void Update(size_t entry, glm::vec2 min, glm::vec2 max);
+
+		/**
+		* @brief Sets whether or not the specified entry can be found by queries, this is used to skip disabled components.
+		*
+		* @param[in] entry - The entry of the component.
+		* @param[in] active - Specifies whether or not the entry can be found by queries.
+		*/
+		void SetActive(size_t entry, bool active);
+
+		/**
+		* @brief Sets the stacking order of the specified entry, entries with a higher order are above those with a lower order.
+		*
+		* @param[in] entry - The entry of the component.
+		* @param[in] order - The new stacking order of the entry.
+		*/
+		void SetOrder(size_t entry, uint64_t order);
+
+		/**
+		* @brief Removes the specified entry from the index.
+		* @param[in] entry - The entry of the component.
+		*/
+		void Remove(size_t entry);
+
+		/**
+		* @brief Removes every entry from the index.
+		*/
+		void Clear();
+
+		/**
+		* @brief Returns the topmost component whose bounds contain the point given.
+		* The result of the most recent query is kept, so querying the same point again (e.g. the cursor position, from each component during a
+		* frame) costs nothing until the index is changed.
+		*
+		* @param[in] point - The point to be looked up.
+		* @return The topmost component at the point, or nullptr if there are no components at the point.
+		*/
+		Component* QueryTopmost(glm::vec2 point) const;
+
+		/**
+		* @brief Finds every component whose bounds overlap the region given.
+		*
+		* @param[in] min - The top-left corner of the region.
+		* @param[in] max - The bottom-right corner of the region.
+		* @param[out] components - The components found are appended onto this, from the bottommost to the topmost.
+		*/
+		void QueryRegion(glm::vec2 min, glm::vec2 max, std::vector<Component*>& components) const;
+	private:
+		/**
+		* @brief A struct describing a component within the index.
+		*/
+		struct Entry
+		{
+			Component* component; // The component, this is nullptr if the entry is unused
+			glm::vec2 min, max;
+			glm::ivec2 firstCell, lastCell; // The range of cells which the entry is recorded in
+			uint64_t order; // The stacking order, higher is above
+			bool active, oversized;
+		};
+
+		/**
+		* @brief Returns the cell containing the point given.
+		*/
+		glm::ivec2 GetCell(glm::vec2 point) const;
+
+		/**
+		* @brief Returns the key used to look up the cell given within the grid.
+		*/
+		static uint64_t GetCellKey(int cellX, int cellY);
+
+		/**
+		* @brief Records the specified entry in every cell within its cell range, or in the oversized entry list if the range is too large.
+		*/
+		void AddToCells(size_t entry);
+
+		/**
+		* @brief Removes the specified entry from every cell within its cell range, or from the oversized entry list.
+		*/
+		void RemoveFromCells(size_t entry);
+	private:
+		float m_cellSize;
+
+		std::vector<Entry> m_entries;
+		std::vector<size_t> m_freeEntries; // The unused entries, which are reused before new entries are added
+		std::unordered_map<uint64_t, std::vector<size_t>> m_cells; // The entries overlapping each non-empty cell
+		std::vector<size_t> m_oversizedEntries;
+		uint64_t m_nextOrder;
+
+		// The most recent topmost query, along with the query stamp of each entry (so region queries report each entry once)
+		mutable glm::vec2 m_cachedPoint;
+		mutable Component* m_cachedTopmost;
+		mutable bool m_isCacheValid;
+		mutable std::vector<uint64_t> m_entryQueryStamps;
+		mutable uint64_t m_queryStamp;
+	};
+}
+
+#endif
\ No newline at end of file
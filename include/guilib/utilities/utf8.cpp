@@ -0,0 +1,121 @@
+#include <utilities/utf8.h>
+
+namespace GUILib
+{
+	namespace
+	{
+		constexpr uint32_t replacementCharacter = 0xFFFD;
+
+		// Returns whether or not the byte given is a UTF-8 continuation byte (10xxxxxx)
+		constexpr bool IsContinuationByte(uint8_t byte) { return (byte & 0xC0) == 0x80; }
+	}
+
+	std::u32string DecodeUTF8(std::string_view text)
+	{
+		std::u32string codepoints;
+		codepoints.reserve(text.size());
+
+		size_t index = 0;
+		while (index < text.size())
+		{
+			const uint8_t leadByte = (uint8_t)text[index];
+
+			// Determine the length of the byte sequence and the payload bits of the lead byte
+			uint32_t sequenceLength = 0, codepoint = 0;
+			if (leadByte < 0x80)
+			{
+				sequenceLength = 1;
+				codepoint = leadByte;
+			}
+			else if ((leadByte & 0xE0) == 0xC0)
+			{
+				sequenceLength = 2;
+				codepoint = leadByte & 0x1F;
+			}
+			else if ((leadByte & 0xF0) == 0xE0)
+			{
+				sequenceLength = 3;
+				codepoint = leadByte & 0x0F;
+			}
+			else if ((leadByte & 0xF8) == 0xF0)
+			{
+				sequenceLength = 4;
+				codepoint = leadByte & 0x07;
+			}
+			else // Stray continuation byte or invalid lead byte
+			{
+				codepoints += replacementCharacter;
+				index++;
+				continue;
+			}
+
+			// Accumulate the payload bits of the continuation bytes
+			uint32_t byteIndex = 1;
+			for (; byteIndex < sequenceLength && index + byteIndex < text.size(); byteIndex++)
+			{
+				const uint8_t continuationByte = (uint8_t)text[index + byteIndex];
+				if (!IsContinuationByte(continuationByte))
+					break;
+
+				codepoint = (codepoint << 6) | (continuationByte & 0x3F);
+			}
+
+			if (byteIndex != sequenceLength || codepoint > 0x10FFFF)
+				codepoint = replacementCharacter;
+
+			codepoints += (char32_t)codepoint;
+			index += byteIndex;
+		}
+
+		return codepoints;
+	}
+
+	void AppendUTF8(std::string& text, uint32_t codepoint)
+	{
+		if (codepoint > 0x10FFFF)
+			codepoint = replacementCharacter;
+
+		if (codepoint < 0x80)
+			text += (char)codepoint;
+		else if (codepoint < 0x800)
+		{
+			text += (char)(0xC0 | (codepoint >> 6));
+			text += (char)(0x80 | (codepoint & 0x3F));
+		}
+		else if (codepoint < 0x10000)
+		{
+			text += (char)(0xE0 | (codepoint >> 12));
+			text += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+			text += (char)(0x80 | (codepoint & 0x3F));
+		}
+		else
+		{
+			text += (char)(0xF0 | (codepoint >> 18));
+			text += (char)(0x80 | ((codepoint >> 12) & 0x3F));
+			text += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+			text += (char)(0x80 | (codepoint & 0x3F));
+		}
+	}
+
+	void PopBackUTF8(std::string& text)
+	{
+		// Remove the trailing continuation bytes, followed by the lead byte of the sequence
+		while (!text.empty() && IsContinuationByte((uint8_t)text.back()))
+			text.pop_back();
+
+		if (!text.empty())
+			text.pop_back();
+	}
+
+	size_t GetUTF8Length(std::string_view text)
+	{
+		size_t length = 0;
+		for (const char byte : text)
+		{
+			if (!IsContinuationByte((uint8_t)byte))
+				length++;
+		}
+
+		return length;
+	}
+}
\ No newline at end of file
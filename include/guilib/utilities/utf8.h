@@ -0,0 +1,42 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <utilities/libexport.h>
+#include <string_view>
+#include <string>
+#include <stdint.h>
+
+namespace GUILib
+{
+	/**
+	* @brief Decodes the UTF-8 encoded text given into a string of unicode codepoints.
+	* Malformed byte sequences are decoded as the unicode replacement character (U+FFFD).
+	* 
+	* @param[in] text - The UTF-8 encoded text to be decoded.
+	* @return A string containing the decoded unicode codepoints.
+	*/
+	LIB_DECLSPEC extern std::u32string DecodeUTF8(std::string_view text);
+
+	/**
+	* @brief Encodes the unicode codepoint given as UTF-8 and appends it onto the end of the string given.
+	* 
+	* @param[in] text - The UTF-8 encoded string to append the codepoint onto.
+	* @param[in] codepoint - The unicode codepoint to be appended.
+	*/
+	LIB_DECLSPEC extern void AppendUTF8(std::string& text, uint32_t codepoint);
+
+	/**
+	* @brief Removes the last encoded codepoint from the end of the UTF-8 encoded string given.
+	* @param[in] text - The UTF-8 encoded string to remove the last codepoint from.
+	*/
+	LIB_DECLSPEC extern void PopBackUTF8(std::string& text);
+
+	/**
+	* @brief Returns the number of unicode codepoints encoded in the UTF-8 encoded text given.
+	* @param[in] text - The UTF-8 encoded text.
+	* @return The number of codepoints in the text.
+	*/
+	LIB_DECLSPEC extern size_t GetUTF8Length(std::string_view text);
+}
+
+#endif
\ No newline at end of file
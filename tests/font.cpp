@@ -4,6 +4,7 @@
 #include <assets_path.h>
 #include <GLFW/glfw3.h>
 #include <iostream>
+#include <algorithm>
 
 int main(int argc, char** argv)
 {
@@ -30,11 +31,20 @@ int main(int argc, char** argv)
 		GUILib::ResourceLoader::GetInstance().LoadFontFromFile("Arial", LIB_TEST_ASSETS_PATH + std::string("arial.ttf"));
 		const GUILib::Font* font = GUILib::ResourceLoader::GetInstance().GetFont("Arial");
 
-		// Setup user interface consisting of image components displaying the loaded font's texture atlas
+		// Rasterize a few non-ascii glyphs on demand, then upload them to the texture atlas
+		for (const uint32_t codepoint : { 0x00E9u, 0x00F1u, 0x00DFu, 0x03A9u, 0x0416u, 0x20ACu })
+			font->GetGlyph(codepoint);
+
+		font->FlushAtlasUpdates();
+
+		// Setup user interface consisting of image components displaying the first page of the loaded font's texture atlas
 		GUILib::InterfaceFrame* frame = new GUILib::InterfaceFrame(GUILib::Viewport({ 0, 0 }, { 800, 600 }));
-		GUILib::Image* imageComponent = new GUILib::Image(font->GetTextureAtlas());
-		imageComponent->SetPosition({ 400, 200 });
-		imageComponent->SetSize({ 800, 50 });
+		const GUILib::TextureBuffer2D* textureAtlas = font->GetTextureAtlas();
+		const float atlasAspectRatio = (float)textureAtlas->GetWidth() / (float)textureAtlas->GetHeight();
+
+		GUILib::Image* imageComponent = new GUILib::Image(textureAtlas);
+		imageComponent->SetPosition({ 400, 300 });
+		imageComponent->SetSize({ (int)(550 * std::min(atlasAspectRatio, 1.0f)), (int)(550 / std::max(atlasAspectRatio, 1.0f)) });
 
 		frame->AddComponent("FontImageAtlas", imageComponent);
 		
@@ -0,0 +1,119 @@
+#include <guilib/components/checkbox.h>
+#include <guilib/components/push_button.h>
+#include <guilib/components/label.h>
+#include <guilib/utilities/input_system.h>
+#include <guilib/guilib.h>
+#include <assets_path.h>
+#include <GLFW/glfw3.h>
+#include <iostream>
+#include <algorithm>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		// Initialize GLFW library
+		if (!glfwInit())
+			throw std::exception("Failed to initialize GLFW");
+
+		// Setup window hints and create GLFW window
+		glfwWindowHint(GLFW_RESIZABLE, false);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+
+		GLFWwindow* window = glfwCreateWindow(600, 600, "Hit Testing Test", nullptr, nullptr);
+		if (!window)
+			throw std::exception("Failed to create GLFW window");
+
+		glfwMakeContextCurrent(window);
+		GUILib::InitLibraryGLFWImpl(window, (GLADloadproc)glfwGetProcAddress);
+
+		// Load arial font
+		GUILib::ResourceLoader::GetInstance().LoadFontFromFile("Arial", LIB_TEST_ASSETS_PATH + std::string("arial.ttf"));
+		const GUILib::Font* font = GUILib::ResourceLoader::GetInstance().GetFont("Arial");
+
+		// Setup user interface, a grid of 2,000 checkboxes with two overlapping buttons on top
+		GUILib::InterfaceFrame* frame = new GUILib::InterfaceFrame();
+		std::vector<GUILib::Component*> cells;
+
+		for (int row = 0; row < 40; row++)
+		{
+			for (int column = 0; column < 50; column++)
+			{
+				GUILib::Checkbox* checkbox = new GUILib::Checkbox();
+				checkbox->SetScaleSize(8);
+				checkbox->SetBorderThickness(2);
+				checkbox->SetPosition({ 55 + (column * 10), 110 + (row * 10) });
+
+				frame->AddComponent("Cell" + std::to_string(cells.size()), checkbox);
+				cells.push_back(checkbox);
+			}
+		}
+
+		GUILib::PushButton* lowerButton = new GUILib::PushButton("Lower Button", font, 25);
+		lowerButton->SetPosition({ 250, 300 });
+		GUILib::PushButton* upperButton = new GUILib::PushButton("Upper Button", font, 25);
+		upperButton->SetPosition({ 350, 340 });
+
+		const GUILib::ComponentHandle lowerHandle = frame->AddComponent("LowerButton", lowerButton, 1);
+		const GUILib::ComponentHandle upperHandle = frame->AddComponent("UpperButton", upperButton, 1);
+
+		// Clicking either button brings it to the front, swapping which of the buttons is hit where they overlap
+		lowerButton->SetClickCallback([=]() { frame->SetZOrder(lowerHandle, 1); });
+		upperButton->SetClickCallback([=]() { frame->SetZOrder(upperHandle, 1); });
+
+		GUILib::Label* hoveredLabel = new GUILib::Label("", { 1.0f, 0.0f, 1.0f, 1.0f }, font, 25);
+		GUILib::Label* regionLabel = new GUILib::Label("", { 1.0f, 0.0f, 1.0f, 1.0f }, font, 25);
+		frame->AddComponent("HoveredComponent", hoveredLabel);
+		frame->AddComponent("RegionCount", regionLabel);
+
+		std::vector<GUILib::Component*> regionComponents;
+		while (!glfwWindowShouldClose(window))
+		{
+			// Do GUI stuff here
+			frame->Update();
+
+			// Only the topmost component under the cursor responds, the overlapping buttons never both highlight
+			const glm::vec2 cursorPosition = GUILib::InputSystem::GetInstance().GetSnapshot().GetCursorPosition(&frame->GetViewport());
+			const GUILib::Component* hovered = frame->GetComponentAt(cursorPosition);
+
+			std::string hoveredText = "Hovered: None";
+			if (hovered == lowerButton)
+				hoveredText = "Hovered: Lower Button";
+			else if (hovered == upperButton)
+				hoveredText = "Hovered: Upper Button";
+			else if (hovered)
+				hoveredText = "Hovered: Cell " + std::to_string(std::find(cells.begin(), cells.end(), hovered) - cells.begin());
+
+			// Count the components within a 50x50 region around the cursor
+			regionComponents.clear();
+			frame->GetComponentsInRegion(cursorPosition - 25.0f, cursorPosition + 25.0f, regionComponents);
+
+			hoveredLabel->SetText(hoveredText);
+			regionLabel->SetText("Components near cursor: " + std::to_string(regionComponents.size()));
+			hoveredLabel->SetPosition({ 300 - (hoveredLabel->GetSize().x / 2), 40 });
+			regionLabel->SetPosition({ 300 - (regionLabel->GetSize().x / 2), 80 });
+
+			frame->Render();
+
+			// Poll for events and swap render buffers
+			glfwPollEvents();
+			glfwSwapBuffers(window);
+		}
+
+		delete frame;
+		GUILib::FreeLibrary();
+
+		// Cleanup application
+		glfwDestroyWindow(window);
+		glfwTerminate();
+	}
+	catch (std::exception& ex)
+	{
+		std::cout << ex.what();
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
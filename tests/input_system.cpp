@@ -54,7 +54,6 @@ int main(int argc, char** argv)
 			// Do GUI stuff here
 			scrollOffsetTotal += GUILib::InputSystem::GetInstance().GetScrollOffset();
 			const glm::vec2 cursorPosition = GUILib::InputSystem::GetInstance().GetCursorPosition(&frame->GetViewport());
-			const char inputtedChar = (char)GUILib::InputSystem::GetInstance().GetInputtedCharacter();
 
 			cursorPosLabel->SetText("Current Cursor Position: { " + std::to_string((int)cursorPosition.x) + ", " + 
 				std::to_string((int)cursorPosition.y) + " }");
@@ -62,8 +61,10 @@ int main(int argc, char** argv)
 			scrollOffsetLabel->SetText("Scroll Offset Total: { " + std::to_string(scrollOffsetTotal.x) + ", " + 
 				std::to_string(scrollOffsetTotal.y) + " }");
 
-			if (inputtedChar > 0)
-				enteredCharsLabel->SetText(enteredCharsLabel->GetText() + inputtedChar);
+			// Every character typed since the previous frame is kept, so none are lost when typing faster than the frame rate
+			for (uint32_t inputtedChar = GUILib::InputSystem::GetInstance().GetInputtedCharacter(); inputtedChar > 0; 
+				inputtedChar = GUILib::InputSystem::GetInstance().GetInputtedCharacter())
+				enteredCharsLabel->SetText(enteredCharsLabel->GetText() + (char)inputtedChar);
 
 			cursorPosLabel->SetPosition({ 300 - (cursorPosLabel->GetSize().x / 2), 75 });
 			scrollOffsetLabel->SetPosition({ 300 - (scrollOffsetLabel->GetSize().x / 2), 150 });
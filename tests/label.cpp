@@ -25,23 +25,42 @@ int main(int argc, char** argv)
 		glfwMakeContextCurrent(window);
 		GUILib::InitLibraryGLFWImpl(window, (GLADloadproc)glfwGetProcAddress);
 
-		// Load the arial font from file
+		// Load the arial font from file, once as bitmap glyphs and once as signed distance field glyphs
 		GUILib::ResourceLoader::GetInstance().LoadFontFromFile("Arial", LIB_TEST_ASSETS_PATH + std::string("arial.ttf"));
+		GUILib::ResourceLoader::GetInstance().LoadFontFromFile("ArialSDF", LIB_TEST_ASSETS_PATH + std::string("arial.ttf"),
+			GUILib::FontRenderMode::SIGNED_DISTANCE_FIELD);
+
 		const GUILib::Font* font = GUILib::ResourceLoader::GetInstance().GetFont("Arial");
+		const GUILib::Font* sdfFont = GUILib::ResourceLoader::GetInstance().GetFont("ArialSDF");
 
-		// Setup user interface consisting of 3 labels
+		// Setup user interface consisting of 6 labels, the fourth and fifth use the signed distance field font at a small and large size and the
+		// last one wraps a couple of paragraphs of text
 		GUILib::InterfaceFrame* frame = new GUILib::InterfaceFrame();
 		GUILib::Label* label = new GUILib::Label("Hello World", { 1.0f, 0.0f, 0.0f, 1.0f }, font, 64);
 		GUILib::Label* label2 = new GUILib::Label("Another string of text?", { 0.0f, 1.0f, 0.0f, 1.0f }, font, 48);
 		GUILib::Label* label3 = new GUILib::Label("Why not?", { 1.0f, 0.0f, 1.0f, 1.0f }, font, 32);
+		GUILib::Label* label4 = new GUILib::Label("Small distance field text", { 1.0f, 1.0f, 1.0f, 1.0f }, sdfFont, 12);
+		GUILib::Label* label5 = new GUILib::Label("Big SDF", { 0.0f, 0.5f, 1.0f, 1.0f }, sdfFont, 96);
+		GUILib::Label* label6 = new GUILib::Label("This label wraps its text to a maximum width, breaking lines between words.\n"
+			"A new paragraph starts after every newline character.", { 1.0f, 1.0f, 0.0f, 1.0f }, font, 16);
+
+		label6->SetMaxWidth(260);
+		label6->SetTextAlignment(GUILib::TextAlignment::CENTER);
+		label6->SetLineSpacing(1.2f);
 
 		label->SetPosition({0, label->GetSize().y});
 		label2->SetPosition({ 300 - (label2->GetSize().x / 2), 300 + (label2->GetSize().y / 2) });
 		label3->SetPosition({600 - label3->GetSize().x, 595});
+		label4->SetPosition({ 10, 400 });
+		label5->SetPosition({ 10, 500 });
+		label6->SetPosition({ 330, 110 });
 
 		frame->AddComponent("Label1", label);
 		frame->AddComponent("Label2", label2);
 		frame->AddComponent("Label3", label3);
+		frame->AddComponent("Label4", label4);
+		frame->AddComponent("Label5", label5);
+		frame->AddComponent("Label6", label6);
 
 		while (!glfwWindowShouldClose(window))
 		{
@@ -0,0 +1,72 @@
+#include <guilib/guilib.h>
+#include <guilib/components/text_area.h>
+#include <assets_path.h>
+#include <GLFW/glfw3.h>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		// Initialize GLFW library
+		if (!glfwInit())
+			throw std::exception("Failed to initialize GLFW");
+
+		// Setup window hints and create GLFW window
+		glfwWindowHint(GLFW_RESIZABLE, false);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+
+		GLFWwindow* window = glfwCreateWindow(600, 600, "Text Area Test", nullptr, nullptr);
+		if (!window)
+			throw std::exception("Failed to create GLFW window");
+
+		glfwMakeContextCurrent(window);
+		GUILib::InitLibraryGLFWImpl(window, (GLADloadproc)glfwGetProcAddress);
+
+		// Load the arial font from file
+		GUILib::ResourceLoader::GetInstance().LoadFontFromFile("Arial", LIB_TEST_ASSETS_PATH + std::string("arial.ttf"));
+		const GUILib::Font* font = GUILib::ResourceLoader::GetInstance().GetFont("Arial");
+
+		// Generate a large document of 100,000 lines, only the visible lines are ever turned into text geometry
+		std::string document;
+		for (int i = 1; i <= 100000; i++)
+			document += "Line " + std::to_string(i) + ": The quick brown fox jumps over the lazy dog.\n";
+
+		// Setup user interface consisting of a single text area filling most of the window
+		GUILib::InterfaceFrame* frame = new GUILib::InterfaceFrame();
+		GUILib::TextArea* textArea = new GUILib::TextArea(font, 18);
+
+		textArea->SetPosition({ 300, 300 });
+		textArea->SetSize({ 560, 560 });
+		textArea->SetText(document);
+
+		frame->AddComponent("TextArea", textArea);
+
+		while (!glfwWindowShouldClose(window))
+		{
+			// Do GUI stuff here
+			frame->Update();
+			frame->Render();
+
+			// Poll for events and swap render buffers
+			glfwPollEvents();
+			glfwSwapBuffers(window);
+		}
+
+		delete frame;
+		GUILib::FreeLibrary();
+
+		// Cleanup application
+		glfwDestroyWindow(window);
+		glfwTerminate();
+	}
+	catch (std::exception& ex)
+	{
+		std::cout << ex.what();
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file